@@ -0,0 +1,689 @@
+// bench/BookingBench.cpp
+// ─────────────────────────────────────────────────────────────────────────────
+// Hot-path cost of the domain objects and the in-memory repository.
+//
+// Every case runs on 1, 2, 4 … hardware_concurrency threads; the table
+// reports the mean ns/op seen by one thread and, in the last column, heap
+// allocations per operation (counted by this binary's operator new).
+//
+//   theater.*   one Theater.  "hit" books fresh seats (each thread walks its
+//               own pool of halls, so the lock is uncontended); "taken"
+//               retries a sold-out seat on one shared hall; freeSeats runs
+//               on a shared hall with 20 / 10 / 1 seats left; quote sums
+//               the price column under a varying seat mask
+//   seat.*      Seat::fromIndex
+//   repo.*      InMemoryRepository with a catalog of C movies (two halls
+//               each beyond the seed data); book/freeSeats/theaters pick a
+//               random hall or movie, movies() copies the whole list,
+//               quote prices a 2-seat group in a random hall.  book
+//               runs on its own copy (mostly sold-out seats after the first
+//               few thousand calls), the read cases on untouched halls
+//   catalog.*   InMemoryRepository with the largest --catalog size of movies
+//               carrying a 2-5 word title and a 24-word synopsis each:
+//               "scan" copies movies() and reads the first and last byte of
+//               every title and synopsis.  The live heap the catalog holds
+//               per movie (with and without its search index) and that of
+//               one movies() copy are printed below the table (glibc only)
+//   hot.*       8 hot halls booked from every thread, one random seat per
+//               request (sold out after warm-up, so mostly the refusal
+//               path): "shared" books under the hall lock on the calling
+//               thread; "owned" hands each request to the hall's pinned
+//               owner (HallExecutor, hw/2 workers) and waits for it;
+//               "owned-async" posts all requests and waits once at the end
+//   busy.*      H halls all booked at once, each thread cycling through its
+//               own halls (hall i belongs to thread i mod T, so neighbouring
+//               halls are booked by different threads and no hall lock is
+//               ever contended), one random seat per request: what is left
+//               is the cost of the halls' cache lines moving between cores
+//   index.*     MovieIndex over 50k generated titles (2-4 words from a 20k
+//               word vocabulary): 3-letter prefix, whole word, one-typo
+//               word and two-word queries, 20 results each
+//
+// Theater::kCapacity is a compile-time constant, so "hall size" is varied
+// as occupancy (seats left) and seats per booking request instead.
+//
+//   booking_bench [--ops 200000] [--threads 1,2,4] [--catalog 2,100,1000]
+//                 [--filter <substr>] [--json <file>]
+//   booking_bench --compare <base.json> <head.json> [--threshold 10]
+//
+// --compare prints the per-case delta of two --json runs and exits non-zero
+// when any case got slower by more than <threshold> percent or allocates
+// more per operation.
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include "booking/domain/Seat.hpp"
+#include "booking/domain/Theater.hpp"
+#include "booking/service/BookingManager.hpp"
+#include "booking/service/HallExecutor.hpp"
+#include "booking/service/IBookingRepository.hpp"
+#include "booking/service/MovieIndex.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <new>
+#include <random>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifdef __GLIBC__
+#include <malloc.h>
+#endif
+
+namespace booking::service {
+std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+// ─────────────────────────────────────────────────────────────── allocations
+namespace {
+thread_local std::uint64_t tAllocs = 0;        // per-thread, no contention
+}
+
+void* operator new(std::size_t n)
+{
+    ++tAllocs;
+    if (void* p = std::malloc(n ? n : 1)) return p;
+    throw std::bad_alloc{};
+}
+void operator delete(void* p) noexcept              { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+using booking::domain::BookStatus;
+using booking::domain::Movie;
+using booking::domain::Seat;
+using booking::domain::Theater;
+using Clock = std::chrono::steady_clock;
+
+namespace {            // ─────────────────────────── harness
+
+struct Case {
+    std::string   name;
+    std::uint64_t ops;                                          // per thread
+    std::function<void(unsigned threads)>              setup;   // untimed
+    std::function<void(unsigned t, std::uint64_t n)>   body;
+};
+
+struct Result {
+    std::string name;
+    unsigned    threads      = 0;
+    double      nsPerOp      = 0;
+    double      allocsPerOp  = 0;
+};
+
+/// Mean ns/op and allocations/op over @p threads threads.
+Result measure(const Case& c, unsigned threads)
+{
+    if (c.setup) c.setup(threads);
+
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool>     go{false};
+    std::vector<double>   ns(threads), allocs(threads);
+    std::vector<std::thread> ts;
+
+    for (unsigned t = 0; t < threads; ++t)
+        ts.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {}
+            const auto a0 = tAllocs;
+            const auto t0 = Clock::now();
+            c.body(t, c.ops);
+            ns[t]     = std::chrono::duration<double, std::nano>(Clock::now() - t0).count();
+            allocs[t] = static_cast<double>(tAllocs - a0);
+        });
+
+    while (ready.load() != threads) {}
+    go.store(true, std::memory_order_release);
+    for (auto& t : ts) t.join();
+
+    Result r{c.name, threads};
+    for (unsigned t = 0; t < threads; ++t) {
+        r.nsPerOp     += ns[t] / static_cast<double>(c.ops);
+        r.allocsPerOp += allocs[t] / static_cast<double>(c.ops);
+    }
+    r.nsPerOp     /= threads;
+    r.allocsPerOp /= threads;
+    return r;
+}
+
+std::vector<unsigned> parseList(const std::string& s)
+{
+    std::vector<unsigned> v;
+    std::istringstream in{s};
+    std::string item;
+    while (std::getline(in, item, ','))
+        v.push_back(static_cast<unsigned>(std::stoul(item)));
+    return v;
+}
+
+// ─────────────────────────────────────────────────────────────── fixtures
+/// Seed data plus movies 1000… with two halls each, up to @p movies total.
+std::shared_ptr<booking::service::IBookingRepository> makeCatalog(unsigned movies)
+{
+    auto repo = booking::service::makeInMemoryRepository();
+    for (Movie::Id m = 1000; repo->movies().size() < movies; ++m) {
+        const auto title = "Movie " + std::to_string(m);
+        repo->addMovie({m, title});
+        repo->addScreening(m, m * 10 + 1, "Hall-" + std::to_string(m) + "-1");
+        repo->addScreening(m, m * 10 + 2, "Hall-" + std::to_string(m) + "-2");
+    }
+    return repo;
+}
+
+struct Halls { std::vector<std::pair<Movie::Id, Theater::Id>> all; std::vector<Movie::Id> movies; };
+
+Halls hallsOf(const booking::service::IBookingRepository& repo)
+{
+    Halls h;
+    for (const auto& m : repo.movies()) {
+        h.movies.push_back(m.id());
+        for (const auto& t : repo.theaters(m.id())) h.all.emplace_back(m.id(), t->id());
+    }
+    return h;
+}
+
+void theaterCases(std::vector<Case>& cases, std::uint64_t ops)
+{
+    // hit: per-thread pool of fresh halls, `k` seats per request; `ruled`
+    // halls check no-single-gap + a wheelchair bay (left to right never
+    // strands a seat, so every request still succeeds)
+    Theater::Rules rules;
+    rules.noSingleGaps = true;
+    rules.accessible   = Theater::SeatMask{1} << (Theater::kCapacity - 1);
+    auto pools = std::make_shared<std::vector<std::vector<std::unique_ptr<Theater>>>>();
+    for (const auto& [k, ruled] : {std::pair{1u, false}, std::pair{4u, false}, std::pair{1u, true}}) {
+        const std::uint64_t n = ops / 4;
+        cases.push_back({std::string{ruled ? "theater.book(hit,rules," : "theater.tryBook(hit,"}
+                         + std::to_string(k) + ")", n,
+            [pools, n, k = k, ruled = ruled, rules](unsigned threads) {
+                pools->clear();
+                pools->resize(threads);
+                const std::uint64_t perHall = Theater::kCapacity / k;
+                for (auto& p : *pools)
+                    for (std::uint64_t i = 0; i < n / perHall + 1; ++i)
+                        p.push_back(std::make_unique<Theater>(static_cast<Theater::Id>(i + 1), "H",
+                                                              Theater::Pricing::standard(),
+                                                              ruled ? rules : Theater::Rules{}));
+            },
+            [pools, k = k, ruled = ruled](unsigned t, std::uint64_t n) {
+                auto& pool = (*pools)[t];
+                const std::uint64_t perHall = Theater::kCapacity / k;
+                std::vector<Seat> req(k);
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    const auto base = static_cast<std::uint8_t>((i % perHall) * k);
+                    for (unsigned s = 0; s < k; ++s) req[s].index = static_cast<std::uint8_t>(base + s);
+                    const bool ok = ruled ? pool[i / perHall]->book(req, true) == BookStatus::Booked
+                                          : pool[i / perHall]->tryBook(req);
+                    if (!ok) std::abort();
+                }
+            }});
+    }
+
+    auto full = std::make_shared<Theater>(1, "Full");
+    for (std::uint8_t i = 0; i < Theater::kCapacity; ++i) full->tryBook({Seat::fromIndex(i)});
+    cases.push_back({"theater.tryBook(taken,1)", ops, nullptr,
+        [full](unsigned, std::uint64_t n) {
+            const std::vector<Seat> req{Seat::fromIndex(7)};
+            for (std::uint64_t i = 0; i < n; ++i)
+                if (full->tryBook(req)) std::abort();
+        }});
+
+    for (std::size_t left : {std::size_t{20}, std::size_t{10}, std::size_t{1}}) {
+        auto hall = std::make_shared<Theater>(2, "Partial");
+        for (std::size_t i = left; i < Theater::kCapacity; ++i)
+            hall->tryBook({Seat::fromIndex(static_cast<std::uint8_t>(i))});
+        cases.push_back({"theater.freeSeats(free=" + std::to_string(left) + ")", ops / 4, nullptr,
+            [hall, left](unsigned, std::uint64_t n) {
+                for (std::uint64_t i = 0; i < n; ++i)
+                    if (hall->freeSeats().size() != left) std::abort();
+            }});
+    }
+
+    auto priced = std::make_shared<Theater>(3, "Priced");
+    cases.push_back({"theater.quote(mask)", ops * 4, nullptr,
+        [priced](unsigned, std::uint64_t n) {
+            std::uint64_t sink = 0;
+            for (std::uint64_t i = 0; i < n; ++i)
+                sink += priced->quote(static_cast<Theater::SeatMask>(i * 2654435761u) & 0xFFFFFu);
+            if (sink == 1) std::cout << ' ';                       // keep the loop alive
+        }});
+
+    auto ruledHall = std::make_shared<Theater>(4, "Ruled", Theater::Pricing::standard(),
+                                               Theater::Rules{true, 1, Theater::SeatMask{1}});
+    cases.push_back({"theater.admits(rules)", ops * 4, nullptr,
+        [ruledHall](unsigned, std::uint64_t n) {
+            std::uint64_t sink = 0;
+            for (std::uint64_t i = 0; i < n; ++i) {
+                const auto taken = static_cast<Theater::SeatMask>(i * 2654435761u) & 0xF0F0Fu;
+                sink += static_cast<unsigned>(ruledHall->admits(taken, Theater::SeatMask{1} << (i % 20), false));
+            }
+            if (sink == 1) std::cout << ' ';                       // keep the loop alive
+        }});
+
+    cases.push_back({"seat.fromIndex", ops * 4, nullptr,
+        [](unsigned, std::uint64_t n) {
+            std::size_t sink = 0;
+            for (std::uint64_t i = 0; i < n; ++i)
+                sink += Seat::fromIndex(static_cast<std::uint8_t>(i % Theater::kCapacity)).label.size();
+            if (sink == 1) std::cout << ' ';                       // keep the loop alive
+        }});
+}
+
+void repositoryCases(std::vector<Case>& cases, std::uint64_t ops, unsigned movies)
+{
+    // book() fills its own copy, so the read cases always see empty halls
+    const auto booked = makeCatalog(movies);
+    const auto repo   = makeCatalog(movies);
+    const auto halls  = std::make_shared<Halls>(hallsOf(*repo));
+    const std::string sfx = "(C=" + std::to_string(halls->movies.size()) + ")";
+
+    cases.push_back({"repo.book" + sfx, ops, nullptr,
+        [repo = booked, halls](unsigned t, std::uint64_t n) {
+            std::mt19937 rng{t};
+            std::uniform_int_distribution<std::size_t> pick(0, halls->all.size() - 1);
+            std::uniform_int_distribution<unsigned>    seat(0, Theater::kCapacity - 1);
+            std::vector<Seat> req(1);
+            for (std::uint64_t i = 0; i < n; ++i) {
+                const auto& [m, h] = halls->all[pick(rng)];
+                req[0].index = static_cast<std::uint8_t>(seat(rng));
+                repo->book(m, h, req);                             // mostly taken after warm-up
+            }
+        }});
+    cases.push_back({"repo.freeSeats" + sfx, ops / 4, nullptr,
+        [repo, halls](unsigned t, std::uint64_t n) {
+            std::mt19937 rng{t};
+            std::uniform_int_distribution<std::size_t> pick(0, halls->all.size() - 1);
+            for (std::uint64_t i = 0; i < n; ++i) {
+                const auto& [m, h] = halls->all[pick(rng)];
+                (void)repo->freeSeats(m, h);
+            }
+        }});
+    cases.push_back({"repo.theaters" + sfx, ops / 4, nullptr,
+        [repo, halls](unsigned t, std::uint64_t n) {
+            std::mt19937 rng{t};
+            std::uniform_int_distribution<std::size_t> pick(0, halls->movies.size() - 1);
+            for (std::uint64_t i = 0; i < n; ++i)
+                (void)repo->theaters(halls->movies[pick(rng)]);
+        }});
+    cases.push_back({"repo.quote" + sfx, ops, nullptr,
+        [repo, halls](unsigned t, std::uint64_t n) {
+            std::mt19937 rng{t};
+            std::uniform_int_distribution<std::size_t> pick(0, halls->all.size() - 1);
+            std::vector<Seat> req{Seat::fromIndex(3), Seat::fromIndex(4)};
+            for (std::uint64_t i = 0; i < n; ++i) {
+                const auto& [m, h] = halls->all[pick(rng)];
+                if (!repo->quote(m, h, req)) std::abort();
+            }
+        }});
+    const std::uint64_t listOps = std::max<std::uint64_t>(1000, ops * 4 / movies);
+    cases.push_back({"repo.movies" + sfx, listOps, nullptr,
+        [repo](unsigned, std::uint64_t n) {
+            for (std::uint64_t i = 0; i < n; ++i) (void)repo->movies();
+        }});
+}
+
+/// Heap bytes in use (glibc), 0 where unknown.
+std::size_t heapInUse()
+{
+#if defined(__GLIBC__) && (__GLIBC__ > 2 || __GLIBC_MINOR__ >= 33)
+    const auto mi = mallinfo2();
+    return mi.uordblks + mi.hblkhd;
+#else
+    return 0;
+#endif
+}
+
+/// Seed data plus @p movies generated movies with titles and synopses;
+/// @p index, when given, also gets every movie.
+std::shared_ptr<booking::service::IBookingRepository>
+makeTextCatalog(unsigned movies, booking::service::MovieIndex* index = nullptr)
+{
+    static const char* const syl[] = {"ka", "lo", "mi", "ter", "stel", "ran", "dor", "vi",
+                                      "ne", "qua", "sol", "ber", "tha", "us", "ion", "gar"};
+    std::mt19937 rng{7};
+    std::uniform_int_distribution<int> pickSyl(0, 15), sylls(2, 4), titleWords(2, 5);
+    const auto word = [&] {
+        std::string w;
+        for (int n = sylls(rng); n > 0; --n) w += syl[pickSyl(rng)];
+        return w;
+    };
+
+    auto repo = booking::service::makeInMemoryRepository();
+    for (Movie::Id m = 1000; m < 1000 + movies; ++m) {
+        std::string title, synopsis;
+        for (int n = titleWords(rng); n > 0; --n) title += (title.empty() ? "" : " ") + word();
+        for (int n = 24; n > 0; --n) synopsis += (synopsis.empty() ? "" : " ") + word();
+        repo->addMovie({m, title, synopsis});
+        if (index) index->add({m, title, synopsis});
+    }
+    return repo;
+}
+
+void catalogCases(std::vector<Case>& cases, std::uint64_t ops, unsigned movies,
+                  std::string& footprint)
+{
+    std::size_t indexBytes = 0;                           // the same movies' MovieIndex alone
+    {
+        const auto start = heapInUse();
+        booking::service::MovieIndex index;
+        (void)makeTextCatalog(movies, &index);            // repository dropped at once
+        indexBytes = heapInUse() - start;
+    }
+    const auto before = heapInUse();
+    const auto repo   = makeTextCatalog(movies);
+    const auto built  = heapInUse();
+    const auto copy   = repo->movies();
+    if (const auto copied = heapInUse(); built > before + indexBytes && copied > built)
+        footprint = "catalog footprint (C=" + std::to_string(movies) + "): "
+                  + std::to_string((built - before) / movies) + " heap bytes/movie, "
+                  + std::to_string((built - before - indexBytes) / movies)
+                  + " without the search index; movies() copy "
+                  + std::to_string((copied - built) / copy.size()) + " bytes/movie\n";
+
+    cases.push_back({"catalog.scan(C=" + std::to_string(movies) + ")",
+                     std::max<std::uint64_t>(100, ops / movies), nullptr,
+        [repo](unsigned, std::uint64_t n) {
+            std::size_t sink = 0;
+            for (std::uint64_t i = 0; i < n; ++i)
+                for (const auto& m : repo->movies())
+                    sink += static_cast<std::size_t>(m.title().empty() ? 0 : m.title().back())
+                          + static_cast<std::size_t>(m.desc().empty()  ? 0 : m.desc().front());
+            if (sink == 1) std::cout << ' ';                       // keep the loop alive
+        }});
+}
+
+void ownershipCases(std::vector<Case>& cases, std::uint64_t ops)
+{
+    using booking::service::BookingManager;
+    using booking::service::HallExecutor;
+
+    // one catalog per mode, 8 halls (seed data + 3 movies with two halls)
+    struct Mode
+    {
+        std::shared_ptr<BookingManager>                    mgr;
+        std::vector<std::pair<Movie::Id, Theater::Id>>     halls;
+    };
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    const auto make = [hw](bool owned) {
+        auto repo  = makeCatalog(5);
+        auto exec  = owned ? std::make_shared<HallExecutor>(std::max(1u, hw / 2)) : nullptr;
+        auto mode  = std::make_shared<Mode>();
+        mode->mgr   = std::make_shared<BookingManager>(repo, std::move(exec));
+        mode->halls = hallsOf(*repo).all;
+        mode->halls.resize(8);
+        return mode;
+    };
+    const auto shared = make(false);
+    const auto owned  = make(true);
+
+    const auto sync = [](const std::shared_ptr<Mode>& mode) {
+        return [mode](unsigned t, std::uint64_t n) {
+            std::mt19937 rng{t};
+            std::uniform_int_distribution<std::size_t> pick(0, mode->halls.size() - 1);
+            std::uniform_int_distribution<unsigned>    seat(0, Theater::kCapacity - 1);
+            std::vector<Seat> req(1);
+            for (std::uint64_t i = 0; i < n; ++i) {
+                const auto& [m, h] = mode->halls[pick(rng)];
+                req[0].index = static_cast<std::uint8_t>(seat(rng));
+                (void)mode->mgr->reserve(m, h, req);
+            }
+        };
+    };
+    cases.push_back({"hot.book(shared)", ops, nullptr, sync(shared)});
+    cases.push_back({"hot.book(owned)",  ops / 4, nullptr, sync(owned)});
+    cases.push_back({"hot.book(owned-async)", ops, nullptr,
+        [owned](unsigned t, std::uint64_t n) {
+            std::mt19937 rng{t};
+            std::uniform_int_distribution<std::size_t> pick(0, owned->halls.size() - 1);
+            std::uniform_int_distribution<unsigned>    seat(0, Theater::kCapacity - 1);
+            auto finished = std::make_shared<std::atomic<std::uint64_t>>(0);
+            for (std::uint64_t i = 0; i < n; ++i) {
+                const auto& [m, h] = owned->halls[pick(rng)];
+                owned->mgr->reserveAsync(m, h, {Seat{static_cast<std::uint8_t>(seat(rng)), {}}}, false,
+                                         [finished](booking::service::Reservation) {
+                                             finished->fetch_add(1, std::memory_order_release);
+                                         });
+            }
+            while (finished->load(std::memory_order_acquire) != n) std::this_thread::yield();
+        }});
+}
+
+void busyCases(std::vector<Case>& cases, std::uint64_t ops)
+{
+    for (unsigned movies : {32u, 128u}) {
+        auto repo  = makeCatalog(movies);
+        auto halls = std::make_shared<Halls>(hallsOf(*repo));
+        auto split = std::make_shared<std::vector<std::vector<std::pair<Movie::Id, Theater::Id>>>>();
+        cases.push_back({"busy.book(H=" + std::to_string(halls->all.size()) + ")", ops,
+            [halls, split](unsigned threads) {
+                split->assign(threads, {});
+                for (std::size_t i = 0; i < std::max<std::size_t>(halls->all.size(), threads); ++i)
+                    (*split)[i % threads].push_back(halls->all[i % halls->all.size()]);
+            },
+            [repo, split](unsigned t, std::uint64_t n) {
+                std::mt19937 rng{t};
+                std::uniform_int_distribution<unsigned> seat(0, Theater::kCapacity - 1);
+                const auto& mine = (*split)[t];
+                std::vector<Seat> req(1);
+                for (std::uint64_t i = 0; i < n; ++i) {
+                    const auto& [m, h] = mine[i % mine.size()];
+                    req[0].index = static_cast<std::uint8_t>(seat(rng));
+                    (void)repo->reserve(m, h, req, false);         // mostly taken after warm-up
+                }
+            }});
+    }
+}
+
+void searchCases(std::vector<Case>& cases, std::uint64_t ops)
+{
+    struct Corpus { booking::service::MovieIndex index; std::vector<std::vector<std::string>> titles; };
+    auto corpus = std::make_shared<Corpus>();
+    const auto build = [corpus](unsigned) {
+        if (!corpus->titles.empty()) return;
+        static const char* const syl[] = {"ka", "lo", "mi", "ter", "stel", "ran", "dor", "vi",
+                                          "ne", "qua", "sol", "ber", "tha", "us", "ion", "gar"};
+        std::mt19937 rng{42};
+        std::uniform_int_distribution<int> pickSyl(0, 15), sylls(2, 4), words(2, 4);
+        std::vector<std::string> vocab(20000);
+        for (auto& w : vocab)
+            for (int s = sylls(rng); s > 0; --s) w += syl[pickSyl(rng)];
+        std::uniform_int_distribution<std::size_t> pickWord(0, vocab.size() - 1);
+        for (Movie::Id id = 1; id <= 50000; ++id) {
+            std::vector<std::string> t;
+            std::string title;
+            for (int n = words(rng); n > 0; --n) {
+                t.push_back(vocab[pickWord(rng)]);
+                title += (title.empty() ? "" : " ") + t.back();
+            }
+            corpus->index.add({id, title});
+            corpus->titles.push_back(std::move(t));
+        }
+    };
+    // query `i` built from the words of title `i`
+    const std::pair<const char*, std::string (*)(const std::vector<std::string>&)> kinds[] = {
+        {"index.search(prefix3)", [](const std::vector<std::string>& t) { return t[0].substr(0, 3); }},
+        {"index.search(word)",    [](const std::vector<std::string>& t) { return t[0]; }},
+        {"index.search(typo)",    [](const std::vector<std::string>& t) {
+                                      std::string w = t[0];
+                                      std::swap(w[1], w[2]);
+                                      return w; }},
+        {"index.search(2 words)", [](const std::vector<std::string>& t) { return t[0] + " " + t[1]; }},
+    };
+    for (const auto& [name, make] : kinds)
+        cases.push_back({name, ops / 50, build,
+            [corpus, make = make](unsigned t, std::uint64_t n) {
+                std::mt19937 rng{t};
+                std::uniform_int_distribution<std::size_t> pick(0, corpus->titles.size() - 1);
+                for (std::uint64_t i = 0; i < n; ++i)
+                    if (corpus->index.search(make(corpus->titles[pick(rng)])).empty())
+                        std::abort();                              // every query has a hit
+            }});
+}
+
+// ─────────────────────────────────────────────────────────────── JSON
+void writeJson(std::ostream& os, const std::vector<Result>& results)
+{
+    os << "{\"bench\":\"booking_bench\",\"results\":[\n";
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        os << "  {\"name\":\"" << r.name << "\",\"threads\":" << r.threads
+           << std::fixed << std::setprecision(2)
+           << ",\"ns_per_op\":" << r.nsPerOp
+           << ",\"allocs_per_op\":" << r.allocsPerOp << '}'
+           << (i + 1 < results.size() ? ",\n" : "\n");
+    }
+    os << "]}\n";
+}
+
+/// Reads the one-result-per-line layout produced by writeJson().
+std::vector<Result> readJson(const std::string& path)
+{
+    std::ifstream in{path};
+    if (!in) throw std::runtime_error("cannot open " + path);
+
+    auto field = [](const std::string& line, const std::string& key) {
+        const auto at = line.find("\"" + key + "\":");
+        if (at == std::string::npos) throw std::runtime_error("missing " + key + " in: " + line);
+        return line.substr(at + key.size() + 3);
+    };
+
+    std::vector<Result> out;
+    for (std::string line; std::getline(in, line);) {
+        if (line.find("\"name\":") == std::string::npos) continue;
+        Result r;
+        const auto name = field(line, "name");
+        r.name        = name.substr(1, name.find('"', 1) - 1);
+        r.threads     = static_cast<unsigned>(std::stoul(field(line, "threads")));
+        r.nsPerOp     = std::stod(field(line, "ns_per_op"));
+        r.allocsPerOp = std::stod(field(line, "allocs_per_op"));
+        out.push_back(std::move(r));
+    }
+    return out;
+}
+
+int compare(const std::string& basePath, const std::string& headPath, double threshold)
+{
+    std::map<std::pair<std::string, unsigned>, Result> base;
+    for (auto& r : readJson(basePath)) base[{r.name, r.threads}] = r;
+
+    std::cout << std::left << std::setw(32) << "case" << std::right << std::setw(4) << "T"
+              << std::setw(12) << "base ns" << std::setw(12) << "head ns" << std::setw(10) << "delta"
+              << std::setw(18) << "allocs/op" << '\n';
+
+    int regressions = 0;
+    for (const auto& h : readJson(headPath)) {
+        const auto it = base.find({h.name, h.threads});
+        if (it == base.end()) {
+            std::cout << std::left << std::setw(32) << h.name << std::right << std::setw(4)
+                      << h.threads << "   (new)\n";
+            continue;
+        }
+        const auto& b     = it->second;
+        const double delta = b.nsPerOp > 0 ? (h.nsPerOp - b.nsPerOp) / b.nsPerOp * 100.0 : 0.0;
+        const bool slower  = delta > threshold;
+        const bool allocs  = h.allocsPerOp > b.allocsPerOp + 0.01;
+        regressions += slower || allocs;
+
+        std::ostringstream a;
+        a << std::fixed << std::setprecision(2) << b.allocsPerOp << " -> " << h.allocsPerOp;
+        std::cout << std::left << std::setw(32) << h.name << std::right << std::setw(4) << h.threads
+                  << std::fixed << std::setprecision(1)
+                  << std::setw(12) << b.nsPerOp << std::setw(12) << h.nsPerOp
+                  << std::setw(9) << std::showpos << delta << std::noshowpos << '%'
+                  << std::setw(18) << a.str()
+                  << (slower || allocs ? "  << regression" : "") << '\n';
+    }
+
+    std::cout << (regressions ? "FAIL" : "PASS") << ": " << regressions
+              << " regression(s) at threshold " << threshold << "%\n";
+    return regressions ? 1 : 0;
+}
+
+} // namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+int main(int argc, char** argv)
+try {
+    std::uint64_t         ops = 200'000;
+    std::vector<unsigned> threadCounts;
+    std::vector<unsigned> catalogs{2, 100, 1000};
+    std::string           filter, jsonPath;
+    double                threshold = 10.0;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string arg{argv[i]};
+        auto next = [&]() -> std::string {
+            if (++i >= argc) throw std::runtime_error("no value for " + arg);
+            return argv[i];
+        };
+        if      (arg == "--ops")       ops          = std::stoull(next());
+        else if (arg == "--threads")   threadCounts = parseList(next());
+        else if (arg == "--catalog")   catalogs     = parseList(next());
+        else if (arg == "--filter")    filter       = next();
+        else if (arg == "--json")      jsonPath     = next();
+        else if (arg == "--threshold") threshold    = std::stod(next());
+        else if (arg == "--compare") {
+            const std::string base = next(), head = next();
+            for (int j = i + 1; j + 1 < argc; ++j)
+                if (std::string{argv[j]} == "--threshold") threshold = std::stod(argv[j + 1]);
+            return compare(base, head, threshold);
+        }
+        else throw std::runtime_error("unknown option " + arg);
+    }
+
+    if (threadCounts.empty()) {
+        const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+        for (unsigned t = 1; t < hw; t *= 2) threadCounts.push_back(t);
+        threadCounts.push_back(hw);
+    }
+
+    std::vector<Case> cases;
+    std::string footprint;
+    theaterCases(cases, ops);
+    for (unsigned c : catalogs) repositoryCases(cases, ops, std::max(2u, c));
+    catalogCases(cases, ops, std::max(2u, *std::max_element(catalogs.begin(), catalogs.end())),
+                 footprint);
+    ownershipCases(cases, ops);
+    busyCases(cases, ops);
+    searchCases(cases, ops);
+
+    std::cout << std::left << std::setw(32) << "case";
+    for (unsigned t : threadCounts) std::cout << std::right << std::setw(10) << (std::to_string(t) + "T");
+    std::cout << std::setw(12) << "allocs/op" << "   (ns/op)\n";
+
+    std::vector<Result> results;
+    for (const auto& c : cases) {
+        if (!filter.empty() && c.name.find(filter) == std::string::npos) continue;
+        std::cout << std::left << std::setw(32) << c.name << std::right << std::fixed;
+        double allocs = 0;
+        for (unsigned t : threadCounts) {
+            results.push_back(measure(c, t));
+            std::cout << std::setprecision(1) << std::setw(10) << results.back().nsPerOp << std::flush;
+            allocs = std::max(allocs, results.back().allocsPerOp);
+        }
+        std::cout << std::setprecision(2) << std::setw(12) << allocs << '\n';
+    }
+    if (std::string{"catalog.scan"}.find(filter) != std::string::npos) std::cout << footprint;
+
+    if (!jsonPath.empty()) {
+        std::ofstream out{jsonPath};
+        writeJson(out, results);
+        std::cout << "wrote " << results.size() << " results to " << jsonPath << '\n';
+    }
+    return 0;
+}
+catch (const std::exception& e) {
+    std::cerr << "error: " << e.what() << '\n';
+    return 1;
+}
@@ -0,0 +1,136 @@
+// bench/MetricsBench.cpp
+// ─────────────────────────────────────────────────────────────────────────────
+// Hot-path cost of the telemetry primitives used by BookingServiceImpl.
+//
+// For 1, 2, 4 … hardware_concurrency threads every primitive is hammered in
+// a tight loop; the table reports the mean cost per operation as seen by one
+// thread.  Recording (Counter::inc, Histogram::record) must stay well under
+// the 100 ns budget, as must CounterSet::inc (the per-movie sales counters)
+// and ScopedTimer, the per-RPC latency probe.  ScopedTimer's budget is
+// 100 ns plus the two steady_clock reads it cannot avoid, measured first on
+// the same host and thread count; a disabled ScopedTimer gets the bare
+// 100 ns.  The exit code is non-zero if any budgeted row exceeds its budget
+// at any thread count.
+// The trace rows time one request shape as used by BookSeats (root + 3
+// spans) with tracing off, sampled 1 in 100 and sampled on every request.
+//
+//   metrics_bench [--ops 2000000]
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include "booking/telemetry/Metrics.hpp"
+#include "booking/telemetry/Tracer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace booking::telemetry;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr double kBudgetNs = 100.0;
+
+/// Root request plus three child spans (BookSeats shape).
+void tracedRequests(std::uint64_t n, std::uint32_t every)
+{
+    Tracer::instance().setSampling(every);
+    for (std::uint64_t i = 0; i < n; ++i) {
+        TraceRequest r{"bench"};
+        { TraceSpan a{"admission"}; }
+        { TraceSpan b{"validate"}; }
+        { TraceSpan c{"theater.tryBook"}; }
+    }
+}
+
+/// Mean ns/op over @p threads threads each running @p ops iterations.
+double measure(unsigned threads, std::uint64_t ops,
+               const std::function<void(std::uint64_t)>& body)
+{
+    std::atomic<unsigned> ready{0};
+    std::atomic<bool>     go{false};
+    std::vector<double>   perThread(threads);
+    std::vector<std::thread> ts;
+
+    for (unsigned t = 0; t < threads; ++t)
+        ts.emplace_back([&, t] {
+            ready.fetch_add(1);
+            while (!go.load(std::memory_order_acquire)) {}
+            const auto t0 = Clock::now();
+            body(ops);
+            perThread[t] = std::chrono::duration<double, std::nano>(Clock::now() - t0).count()
+                           / static_cast<double>(ops);
+        });
+
+    while (ready.load() != threads) {}
+    go.store(true, std::memory_order_release);
+    for (auto& t : ts) t.join();
+
+    double sum = 0;
+    for (double v : perThread) sum += v;
+    return sum / threads;
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::uint64_t ops = 2'000'000;
+    for (int i = 1; i + 1 < argc; ++i)
+        if (std::string{argv[i]} == "--ops") ops = std::stoull(argv[++i]);
+
+    Counter       counter;
+    Histogram     hist;
+    CounterSet<6> sales;
+
+    // clockReads: steady_clock reads added to the budget; -1 = not budgeted.
+    struct Case { const char* name; std::function<void(std::uint64_t)> body; int clockReads = -1; };
+    const std::vector<Case> cases = {
+        {"steady_clock::now",   [&](std::uint64_t n) {
+            std::int64_t sink = 0;
+            for (std::uint64_t i = 0; i < n; ++i) sink += Clock::now().time_since_epoch().count();
+            if (sink == 42) std::cout << ' ';                      // keep the loop alive
+        }},
+        {"Counter::inc",        [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) counter.inc(); }, 0},
+        {"CounterSet::inc",     [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) sales.inc(i % 6); }, 0},
+        {"Histogram::record",   [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) hist.record(i & 0xFFFFF); }, 0},
+        {"ScopedTimer",         [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) { ScopedTimer t{&hist}; } }, 2},
+        {"ScopedTimer(off)",    [&](std::uint64_t n) { for (std::uint64_t i = 0; i < n; ++i) { ScopedTimer t{nullptr}; } }, 0},
+        {"trace(off)",          [&](std::uint64_t n) { tracedRequests(n, 0); }},
+        {"trace(1/100)",        [&](std::uint64_t n) { tracedRequests(n, 100); }},
+        {"trace(1/1)",          [&](std::uint64_t n) { tracedRequests(n, 1); }},
+    };
+
+    const unsigned hw = std::max(1u, std::thread::hardware_concurrency());
+    std::vector<unsigned> threadCounts;
+    for (unsigned t = 1; t < hw; t *= 2) threadCounts.push_back(t);
+    threadCounts.push_back(hw);
+
+    std::cout << std::left << std::setw(20) << "primitive";
+    for (unsigned t : threadCounts) std::cout << std::right << std::setw(10) << (std::to_string(t) + "T");
+    std::cout << "   (ns/op)\n";
+
+    bool ok = true;
+    std::vector<double> clockNs(threadCounts.size());           // first row
+    for (const auto& c : cases) {
+        std::cout << std::left << std::setw(20) << c.name << std::right << std::fixed << std::setprecision(1);
+        for (std::size_t i = 0; i < threadCounts.size(); ++i) {
+            const double ns = measure(threadCounts[i], ops, c.body);
+            std::cout << std::setw(10) << ns;
+            if (&c == &cases.front()) clockNs[i] = ns;
+            if (c.clockReads >= 0 && ns > kBudgetNs + c.clockReads * clockNs[i]) ok = false;
+        }
+        std::cout << '\n';
+    }
+
+    std::cout << (ok ? "PASS" : "FAIL") << ": recording budget "
+              << kBudgetNs << " ns/op (ScopedTimer: + 2 clock reads)\n";
+    return ok ? 0 : 1;
+}
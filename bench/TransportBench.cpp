@@ -0,0 +1,237 @@
+// bench/TransportBench.cpp
+// ─────────────────────────────────────────────────────────────────────────────
+// Per-call latency of the booking RPCs over the three client transports:
+//
+//   inproc   transport::makeInProcessChannel() to an EmbeddedServer
+//   uds      Unix-domain socket (transport::makeLocalChannel)
+//   tcp      loopback TCP        (transport::makeNetworkChannel)
+//   shm      shared-memory rings (transport::shm::Client -> ShmServer),
+//            Linux only; FreeSeats / Book only
+//
+// One EmbeddedServer (plus a ShmServer on its manager) serves them all, so the service code, the manager
+// and the catalog are identical and only the transport differs.  Calls are
+// issued back to back from one thread (latency, not throughput); admission
+// control is off.
+//
+//   rpc.movies   ListMovies
+//   rpc.seats    ListFreeSeats on a 20-seat hall
+//   rpc.book     BookSeats of one seat; every transport books its own
+//                pre-created halls so no call conflicts
+//
+//   transport_bench [--calls 20000] [--warmup 1000] [--ipc /tmp/booking_bench.sock]
+//                   [--shm /tmp/booking_bench.shm] [--filter <substr>]
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include "EmbeddedServer.hpp"
+#include "ShmServer.hpp"
+#include "booking/domain/Theater.hpp"
+#include "booking/telemetry/Metrics.hpp"
+#include "transport/ChannelFactory.hpp"
+#include "transport/ShmClient.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+using booking::domain::Theater;
+
+namespace {            // ─────────────────────────── helpers / CLI
+using Clock = std::chrono::steady_clock;
+
+struct Cmd {
+    int         calls  = 20000;
+    int         warmup = 1000;
+    std::string ipc    = "/tmp/booking_bench.sock";
+    std::string shm    = "/tmp/booking_bench.shm";
+    std::string filter;
+};
+
+Cmd parse(int argc, char** argv)
+{
+    Cmd cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{argv[i]};
+        auto next = [&] {
+            if (++i >= argc)
+                throw std::runtime_error("no value for " + arg);
+            return std::string{argv[i]};
+        };
+        if      (arg == "--calls")  cfg.calls  = std::stoi(next());
+        else if (arg == "--warmup") cfg.warmup = std::stoi(next());
+        else if (arg == "--ipc")    cfg.ipc    = next();
+        else if (arg == "--shm")    cfg.shm    = next();
+        else if (arg == "--filter") cfg.filter = next();
+        else if (arg == "--help") {
+            std::cout << "transport_bench [--calls <n>] [--warmup <n>] [--ipc <path>] "
+                         "[--shm <path>] [--filter <substr>]\n";
+            std::exit(0);
+        } else {
+            throw std::runtime_error("unknown option " + arg);
+        }
+    }
+    return cfg;
+}
+
+struct Transport {
+    const char*                    name;
+    std::shared_ptr<grpc::Channel> channel;  ///< `nullptr` -> shm transport
+    booking::domain::Movie::Id     movie;    ///< owns the halls rpc.book uses
+};
+
+/// One RPC kind; `call(stub, transport, i)` returns the call status, `shm`
+/// is the same operation on the shared-memory client (empty: unsupported).
+struct Rpc {
+    const char* name;
+    std::function<grpc::Status(booking::Booking::Stub&, const Transport&, int)> call;
+#ifdef __linux__
+    std::function<bool(transport::shm::Client&, const Transport&, int)> shm;
+#endif
+};
+
+/// Hall and seat that call @p i of rpc.book takes.
+std::uint32_t bookHall(int i) { return static_cast<std::uint32_t>(i / static_cast<int>(Theater::kCapacity) + 1); }
+int           bookSeat(int i) { return i % static_cast<int>(Theater::kCapacity); }
+
+void report(const std::string& lbl, const booking::telemetry::Histogram& h, std::uint64_t errors)
+{
+    const auto s  = h.snapshot();
+    const auto us = [&](double q) { return static_cast<double>(s.quantile(q)) / 1000.0; };
+    const double mean = s.count ? static_cast<double>(s.sum) / static_cast<double>(s.count) / 1000.0 : 0;
+    std::cout << std::left << std::setw(20) << lbl << std::right << std::fixed << std::setprecision(1)
+              << " mean=" << std::setw(7) << mean << "us"
+              << " p50=" << std::setw(7) << us(0.50) << "us"
+              << " p99=" << std::setw(7) << us(0.99) << "us"
+              << std::setprecision(0)
+              << " calls/s=" << std::setw(7) << (mean > 0 ? 1e6 / mean : 0)
+              << " errors=" << errors << '\n';
+}
+// ---------------------------------------------------------------------------
+} // unnamed namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+int main(int argc, char** argv)
+try {
+    const Cmd cfg = parse(argc, argv);
+
+    EmbeddedOptions opts;
+    opts.service.admission.enabled = false;
+    opts.tcp = "127.0.0.1:0";
+#ifndef _WIN32
+    opts.ipc = cfg.ipc;
+#endif
+    EmbeddedServer server{opts};
+#ifdef __linux__
+    ShmServer shmServer{server.manager(), {cfg.shm}};
+#endif
+
+    std::vector<Transport> transports{
+        {"inproc", server.channel(), 9001},
+#ifndef _WIN32
+        {"uds",    transport::makeLocalChannel(cfg.ipc), 9002},
+#endif
+        {"tcp",    transport::makeNetworkChannel("127.0.0.1", server.tcpPort()), 9003},
+#ifdef __linux__
+        {"shm",    nullptr, 9004},
+#endif
+    };
+
+    // rpc.book needs one fresh seat per call: halls 1, 2, … of a private movie
+    const int total = cfg.calls + cfg.warmup;
+    const int halls = (total + static_cast<int>(Theater::kCapacity) - 1)
+                      / static_cast<int>(Theater::kCapacity);
+    auto& mgr = *server.manager();
+    for (const auto& t : transports) {
+        const auto title = std::string{"bench-"} + t.name;
+        mgr.addMovie({t.movie, title});
+        for (int h = 1; h <= halls; ++h)
+            mgr.addScreening(t.movie, static_cast<Theater::Id>(h), "Hall-" + std::to_string(h));
+    }
+
+    const std::vector<Rpc> rpcs{
+        {"rpc.movies", [](booking::Booking::Stub& stub, const Transport&, int) {
+             grpc::ClientContext ctx;
+             booking::MovieList rep;
+             return stub.ListMovies(&ctx, booking::ListMoviesReq{}, &rep);
+         }
+#ifdef __linux__
+         , {}
+#endif
+        },
+        {"rpc.seats", [](booking::Booking::Stub& stub, const Transport&, int) {
+             grpc::ClientContext ctx;
+             booking::TheaterReq req;
+             req.set_movie_id(1);
+             req.set_theater_id(101);
+             booking::SeatList rep;
+             return stub.ListFreeSeats(&ctx, req, &rep);
+         }
+#ifdef __linux__
+         , [](transport::shm::Client& c, const Transport&, int) {
+             std::uint32_t mask = 0;
+             return c.freeSeats(1, 101, mask) == transport::shm::Status::Ok;
+         }
+#endif
+        },
+        {"rpc.book", [](booking::Booking::Stub& stub, const Transport& t, int i) {
+             grpc::ClientContext ctx;
+             booking::BookingReq req;
+             req.set_movie_id(t.movie);
+             req.set_theater_id(bookHall(i));
+             auto* s = req.add_seats();
+             s->set_index(static_cast<std::uint32_t>(bookSeat(i)));
+             s->set_label("A" + std::to_string(bookSeat(i) + 1));
+             booking::BookingRep rep;
+             return stub.BookSeats(&ctx, req, &rep);
+         }
+#ifdef __linux__
+         , [](transport::shm::Client& c, const Transport& t, int i) {
+             return c.book(t.movie, bookHall(i), 1u << bookSeat(i)) == transport::shm::Status::Ok;
+         }
+#endif
+        },
+    };
+
+    std::cout << cfg.calls << " sequential calls per case (" << cfg.warmup << " warm-up)\n";
+    for (const auto& rpc : rpcs)
+        for (const auto& t : transports) {
+            const std::string lbl = std::string{rpc.name} + '/' + t.name;
+            if (!cfg.filter.empty() && lbl.find(cfg.filter) == std::string::npos) continue;
+
+            std::function<bool(int)> call;
+            std::unique_ptr<booking::Booking::Stub> stub;
+#ifdef __linux__
+            std::unique_ptr<transport::shm::Client> shm;
+            if (!t.channel) {
+                if (!rpc.shm) continue;
+                shm  = std::make_unique<transport::shm::Client>(cfg.shm);
+                call = [&](int i) { return rpc.shm(*shm, t, i); };
+            }
+#endif
+            if (t.channel) {
+                stub = booking::Booking::NewStub(t.channel);
+                call = [&](int i) { return rpc.call(*stub, t, i).ok(); };
+            }
+
+            booking::telemetry::Histogram latency;
+            std::uint64_t errors = 0;
+            for (int i = 0; i < total; ++i) {
+                const auto t0 = Clock::now();
+                const bool ok = call(i);
+                if (i < cfg.warmup) continue;
+                latency.record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - t0).count()));
+                if (!ok) ++errors;
+            }
+            report(lbl, latency, errors);
+        }
+    return 0;
+}
+catch (const std::exception& e) {
+    std::cerr << "error: " << e.what() << '\n';
+    return 1;
+}
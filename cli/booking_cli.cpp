@@ -3,9 +3,23 @@
 // Small CLI talking to the Booking gRPC service.
 //
 //   booking_client list-movies                        [... global opts]
+//   booking_client search      --query "interstel" [--top 20]
 //   booking_client list-theaters --movie 2
 //   booking_client list-seats  --movie 2 --theater 201
 //   booking_client book        --movie 2 --theater 201 --seat A7[,A8…]
+//   booking_client quote       --movie 2 --theater 201 --seat A7[,A8…]
+//   booking_client join-queue  --movie 2          (hot events, prints token)
+//   booking_client metrics                        (Prometheus text)
+//   booking_client lock-report [--top 10]         (lock contention profile)
+//   booking_client trace       --every 100        (sample 1 in N, 0 = off)
+//   booking_client trace-dump  > trace.json       (Chrome / Perfetto JSON)
+//   booking_client stats       [--movie 1] [--every 1000]   (sales per hall)
+//   booking_client add-movie   --movie 3 --title "Dune" [--desc "..."]
+//   booking_client add-screening    --movie 3 --theater 301 --name Hall3
+//   booking_client retire-screening --movie 3 --theater 301
+//   booking_client promote                        (standby becomes primary)
+//   booking_client batch [--file cmds.txt] [--window 64]
+//                                                 (many commands, one channel)
 //
 // Global options may go *anywhere*:
 //   --host <addr>   (default 127.0.0.1)
@@ -24,6 +38,15 @@
 *    booking_client list-seats --movie 2 --theater 201
 *    booking_client book --movie 2 --theater 201 --seat A1,A2
 *
+*    # hot on-sale movie: wait in the queue, then book with the token
+*    booking_client join-queue --movie 1
+*    booking_client book --movie 1 --theater 101 --seat A1 --token <token>
+*
+*    # bulk-book from a file, 128 RPCs in flight, results in input order
+*    #   book --movie 1 --theater 101 --seat A1
+*    #   list-seats --movie 1 --theater 101
+*    booking_client batch --file cmds.txt --window 128
+*
 *    # built-in help
 *    booking_client --help 
 **/
@@ -34,10 +57,15 @@
 
 #include <getopt.h>     // POSIX   (see fallback below for MSVC)
 #include <cstdlib>
+#include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <map>
 #include <sstream>
 #include <vector>
 #include <cstring>
+#include <chrono>
+#include <thread>
 
 #ifdef _WIN32
 /* ------------------------------------------------------------------------
@@ -76,10 +104,21 @@ struct Config {
     uint32_t    movie   = 0;
     uint32_t    theater = 0;
     std::vector<std::string> seats; // for booking
+    uint64_t    token   = 0;        // waiting-room token
+    bool        accessible = false; // book: wheelchair bays allowed
+    std::string key;                // book: idempotency key
+    uint32_t    top     = 0;        // lock-report rows per site family / search hits
+    std::string query;              // search text
+    uint32_t    pageSize = 0;       // list-* rows per RPC, 0 = all at once
+    uint32_t    every   = 0;        // trace sampling interval / stats push period (ms)
+    std::string title, desc, name;  // catalog maintenance
+    std::string file;               // batch input, empty = stdin
+    uint32_t    window  = 64;       // batch RPCs in flight
 
     std::string host = "127.0.0.1";
     int         port = 50051;
     std::string ipc  = "/tmp/booking.sock";
+    std::string admin = "127.0.0.1:50052";   // BookingAdmin listener
 };
 
 static void usage(const char* prog)
@@ -89,15 +128,42 @@ R"(Usage:
   )" << prog << R"( <command> [options]
 
 Commands
-  list-movies
-  list-theaters   --movie <id>
+  list-movies     [--page-size <n>]
+  search          --query <text> [--top <n>]
+                  (title / description, prefix and typo tolerant)
+  list-theaters   --movie <id> [--page-size <n>]
+                  (--page-size fetches the listing n rows per RPC)
   list-seats      --movie <id> --theater <id>
   book            --movie <id> --theater <id> --seat <label>[,<label>...]
+                  [--token <queue token>] [--accessible] [--key <text>]
+                  (--accessible: party may use wheelchair bays;
+                   --key: idempotency key, a retry gets the first reply)
+  quote           --movie <id> --theater <id> --seat <label>[,<label>...]
+                  (price of the seats, booked or not)
+  join-queue      --movie <id>     (waits until admitted, prints the token)
+  metrics                          (server metrics, Prometheus text format)
+  lock-report     [--top <n>]      (most contended halls / catalog lock)
+  trace           --every <n>      (trace 1 in n requests, 0 switches off)
+  trace-dump                       (buffered spans as Chrome trace JSON)
+  stats           [--movie <id>] [--every <ms>]
+                  (sales and sell-through per hall; --every keeps
+                   printing a fresh table every <ms> until interrupted)
+  add-movie       --movie <id> --title <text> [--desc <text>]
+  add-screening   --movie <id> --theater <id> --name <hall name>
+  retire-screening --movie <id> --theater <id>
+  promote                          (standby stops following and takes writes)
+  batch           [--file <path>] [--window <n>]
+                  (one list-movies / list-theaters / list-seats / book
+                   command per line, read from stdin by default; up to
+                   <n> RPCs in flight on one channel, output in input order;
+                   commands within the window run concurrently)
 
 Global connection options
   --host  <addr>   (default 127.0.0.1)
   --port  <num>    (default 50051)
   --ipc   <path>   (default /tmp/booking.sock, Linux only)
+  --admin <addr>   server's admin listener, used by metrics ... promote
+                   (default 127.0.0.1:50052, or unix:/path)
 
 Misc
   -h, --help       Show this help and exit
@@ -113,9 +179,22 @@ static Config parse(int argc, char** argv)
         {"movie",   required_argument, nullptr, 'm'},
         {"theater", required_argument, nullptr, 't'},
         {"seat",    required_argument, nullptr, 's'},
+        {"token",   required_argument, nullptr, 'T'},
+        {"top",     required_argument, nullptr, 'n'},
+        {"every",   required_argument, nullptr, 'e'},
+        {"title",   required_argument, nullptr, 'L'},
+        {"query",   required_argument, nullptr, 'Q'},
+        {"page-size", required_argument, nullptr, 'S'},
+        {"desc",    required_argument, nullptr, 'D'},
+        {"name",    required_argument, nullptr, 'N'},
+        {"file",    required_argument, nullptr, 'f'},
+        {"window",  required_argument, nullptr, 'w'},
         {"host",    required_argument, nullptr, 'H'},
         {"port",    required_argument, nullptr, 'P'},
         {"ipc",     required_argument, nullptr, 'I'},
+        {"admin",   required_argument, nullptr, 'a'},
+        {"accessible", no_argument,    nullptr, 'A'},
+        {"key",     required_argument, nullptr, 'K'},
         {"help",    no_argument,       nullptr, 'h'},
         {nullptr,   0,                 nullptr,  0 }
     };
@@ -123,7 +202,7 @@ static Config parse(int argc, char** argv)
     /* first pass just to grab global flags independent of position */
     optind = 1;                     // reset (for shim / POSIX alike)
     while (true) {
-        int c = getopt_long(argc, argv, "m:t:s:H:P:I:h", opts, &longidx);
+        int c = getopt_long(argc, argv, "m:t:s:T:n:e:L:Q:S:D:N:f:w:H:P:I:a:AK:h", opts, &longidx);
         if (c == -1) break;
         switch (c) {
             case 'm': cfg.movie   = std::stoul(optarg);            break;
@@ -133,9 +212,22 @@ static Config parse(int argc, char** argv)
                 while (std::getline(ss, tok, ',')) cfg.seats.push_back(tok);
                 break;
             }
+            case 'T': cfg.token   = std::stoull(optarg);           break;
+            case 'n': cfg.top     = std::stoul(optarg);            break;
+            case 'e': cfg.every   = std::stoul(optarg);            break;
+            case 'L': cfg.title   = optarg;                        break;
+            case 'Q': cfg.query   = optarg;                        break;
+            case 'S': cfg.pageSize = std::stoul(optarg);           break;
+            case 'D': cfg.desc    = optarg;                        break;
+            case 'N': cfg.name    = optarg;                        break;
+            case 'f': cfg.file    = optarg;                        break;
+            case 'w': cfg.window  = std::stoul(optarg);            break;
             case 'H': cfg.host = optarg;                           break;
             case 'P': cfg.port = std::stoi(optarg);                break;
             case 'I': cfg.ipc  = optarg;                           break;
+            case 'a': cfg.admin = optarg;                          break;
+            case 'A': cfg.accessible = true;                       break;
+            case 'K': cfg.key  = optarg;                           break;
             case 'h': usage(argv[0]); std::exit(0);
             default : usage(argv[0]); std::exit(1);
         }
@@ -158,29 +250,303 @@ static std::shared_ptr<grpc::Channel> makeChannel(const Config& c)
     return transport::makeNetworkChannel(c.host, c.port);
 }
 
+/// Channel to the server's admin listener (BookingAdmin).
+static std::shared_ptr<grpc::Channel> makeAdminChannel(const Config& c)
+{
+    return grpc::CreateChannel(c.admin, grpc::InsecureChannelCredentials());
+}
+
+/// Appends seat @p lbl ("A17" -> index 16) to @p req.
+static void addSeat(booking::BookingReq& req, const std::string& lbl)
+{
+    auto* seat = req.add_seats();
+    seat->set_label(lbl);
+    int n = 0;
+    if (lbl.size() > 1 && std::isdigit(static_cast<unsigned char>(lbl[1])))
+        n = std::stoi(lbl.substr(1));  // "A17" -> 17
+    seat->set_index(n - 1);
+}
+
+/// 1250 -> "12.50"
+static std::string money(std::uint64_t cents)
+{
+    std::ostringstream os;
+    os << cents / 100 << '.' << std::setw(2) << std::setfill('0') << cents % 100;
+    return os.str();
+}
+
+static void printStats(const booking::Stats& st)
+{
+    const auto row = [](const std::string& what, const booking::SalesCounters& c) {
+        std::cout << std::left << std::setw(14) << what << std::right
+                  << std::setw(9) << c.bookings() << std::setw(7) << c.seats_sold()
+                  << std::setw(10) << c.conflicts() << std::setw(8) << c.refused()
+                  << std::setw(12) << money(c.revenue_cents()) << '\n';
+    };
+    std::cout << std::left << std::setw(14) << "" << std::right
+              << std::setw(9) << "bookings" << std::setw(7) << "seats"
+              << std::setw(10) << "conflicts" << std::setw(8) << "refused"
+              << std::setw(12) << "revenue" << '\n';
+    for (const auto& m : st.movies()) {
+        row("movie " + std::to_string(m.movie_id()), m.sales());
+        for (const auto& h : m.halls()) {
+            const auto pct = h.capacity() ? 100 * h.sales().seats_sold() / h.capacity() : 0;
+            row("  hall " + std::to_string(h.theater_id()) + " " + std::to_string(pct) + "%",
+                h.sales());
+        }
+    }
+    row("total", st.total());
+}
+
+/* ---------- batch mode ------------------------------------------------------ */
+namespace batch {
+
+/// One outstanding RPC; `tag` for the completion queue.
+struct Call {
+    std::uint64_t       seq = 0;
+    grpc::ClientContext ctx;
+    grpc::Status        status;
+    virtual ~Call() = default;
+    virtual std::string render() const = 0;       // output for an OK status
+};
+
+template <class Rep, class Fmt>
+struct Rpc final : Call {
+    Rep rep;
+    Fmt fmt;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<Rep>> reader;
+    explicit Rpc(Fmt f) : fmt{std::move(f)} {}
+    std::string render() const override { return fmt(rep); }
+};
+
+template <class Rep, class Fmt, class Start>
+void launch(std::uint64_t seq, grpc::CompletionQueue& cq, Fmt fmt, Start start)
+{
+    auto* c   = new Rpc<Rep, Fmt>{std::move(fmt)};    // owned by the completion loop
+    c->seq    = seq;
+    c->reader = start(&c->ctx, &cq);
+    c->reader->Finish(&c->rep, &c->status, static_cast<Call*>(c));
+}
+
+/// Splits @p line on blanks; "double quotes" group words.
+static std::vector<std::string> words(const std::string& line)
+{
+    std::vector<std::string> out;
+    std::string cur;
+    bool quoted = false, any = false;
+    for (char ch : line) {
+        if (ch == '"') { quoted = !quoted; any = true; continue; }
+        if (!quoted && std::isspace(static_cast<unsigned char>(ch))) {
+            if (any) out.push_back(cur);
+            cur.clear(); any = false;
+            continue;
+        }
+        cur += ch; any = true;
+    }
+    if (quoted) throw std::runtime_error("unterminated quote");
+    if (any) out.push_back(cur);
+    return out;
+}
+
+/**
+ * Issues the command on @p line asynchronously; returns false with @p err
+ * set when the line cannot be turned into an RPC.
+ */
+static bool issue(booking::Booking::Stub& stub, grpc::CompletionQueue& cq,
+                  std::uint64_t seq, const std::string& line, std::string& err)
+try {
+    const auto w = words(line);
+    Config c;
+    for (std::size_t i = 1; i < w.size(); i += 2) {
+        if (i + 1 >= w.size()) throw std::runtime_error("no value for " + w[i]);
+        const auto& key = w[i];
+        const auto& val = w[i + 1];
+        if      (key == "--movie")   c.movie   = std::stoul(val);
+        else if (key == "--theater") c.theater = std::stoul(val);
+        else if (key == "--token")   c.token   = std::stoull(val);
+        else if (key == "--seat") {
+            std::stringstream ss(val); std::string tok;
+            while (std::getline(ss, tok, ',')) c.seats.push_back(tok);
+        }
+        else throw std::runtime_error("unknown option " + key);
+    }
+
+    const auto& cmd = w.front();
+    if (cmd == "list-movies") {
+        launch<booking::MovieList>(seq, cq, [](const booking::MovieList& r) {
+            std::string out;
+            for (auto& m : r.movies()) out += std::to_string(m.id()) + '\t' + m.title() + '\n';
+            return out;
+        }, [&](grpc::ClientContext* ctx, grpc::CompletionQueue* q) {
+            return stub.AsyncListMovies(ctx, booking::ListMoviesReq{}, q);
+        });
+    }
+    else if (cmd == "list-theaters") {
+        if (!c.movie) throw std::runtime_error("--movie required");
+        booking::ListTheatersReq mid; mid.set_movie_id(c.movie);
+        launch<booking::TheaterList>(seq, cq, [](const booking::TheaterList& r) {
+            std::string out;
+            for (auto& t : r.theaters()) out += std::to_string(t.id()) + '\t' + t.name() + '\n';
+            return out;
+        }, [&](grpc::ClientContext* ctx, grpc::CompletionQueue* q) {
+            return stub.AsyncListTheaters(ctx, mid, q);
+        });
+    }
+    else if (cmd == "list-seats") {
+        if (!c.movie || !c.theater) throw std::runtime_error("--movie and --theater required");
+        booking::TheaterReq req;
+        req.set_movie_id(c.movie);
+        req.set_theater_id(c.theater);
+        launch<booking::SeatList>(seq, cq, [](const booking::SeatList& r) {
+            std::string out;
+            for (auto& s : r.seats()) out += s.label() + ' ';
+            return out + '\n';
+        }, [&](grpc::ClientContext* ctx, grpc::CompletionQueue* q) {
+            return stub.AsyncListFreeSeats(ctx, req, q);
+        });
+    }
+    else if (cmd == "book") {
+        if (!c.movie || !c.theater || c.seats.empty())
+            throw std::runtime_error("--movie --theater --seat required");
+        booking::BookingReq req;
+        req.set_movie_id(c.movie);
+        req.set_theater_id(c.theater);
+        req.set_queue_token(c.token);
+        for (auto& lbl : c.seats) addSeat(req, lbl);
+        launch<booking::BookingRep>(seq, cq, [](const booking::BookingRep& r) {
+            return std::string{r.success() ? "booked\n" : "booking failed\n"};
+        }, [&](grpc::ClientContext* ctx, grpc::CompletionQueue* q) {
+            return stub.AsyncBookSeats(ctx, req, q);
+        });
+    }
+    else throw std::runtime_error("'" + cmd + "' is not available in batch mode");
+    return true;
+}
+catch (const std::exception& e) {
+    err = e.what();
+    return false;
+}
+
+/**
+ * Runs every command from @p in over one channel with at most @p window
+ * commands issued but not yet printed.  Returns the number of failures.
+ */
+static std::size_t run(booking::Booking::Stub& stub, std::istream& in, std::uint32_t window)
+{
+    grpc::CompletionQueue cq;
+    std::map<std::uint64_t, std::string> done;     // finished, waiting for their turn
+    std::uint64_t issued = 0, printed = 0, lineNo = 0;
+    std::size_t   inflight = 0, failed = 0;
+    bool          eof = false;
+
+    auto flush = [&] {
+        for (auto it = done.begin(); it != done.end() && it->first == printed;
+             it = done.erase(it), ++printed)
+            std::cout << it->second;
+        std::cout.flush();
+    };
+
+    while (!eof || inflight > 0) {
+        while (!eof && issued - printed < std::max<std::uint32_t>(1, window)) {
+            std::string line;
+            if (!std::getline(in, line)) { eof = true; break; }
+            ++lineNo;
+            const auto first = line.find_first_not_of(" \t\r");
+            if (first == std::string::npos || line[first] == '#') continue;
+
+            std::string err;
+            if (issue(stub, cq, issued, line, err)) {
+                ++inflight;
+            } else {
+                done[issued] = "error: line " + std::to_string(lineNo) + ": " + err + '\n';
+                ++failed;
+            }
+            ++issued;
+        }
+        flush();
+        if (inflight == 0) continue;
+
+        void* tag = nullptr;
+        bool  ok  = false;
+        if (!cq.Next(&tag, &ok)) break;
+        std::unique_ptr<Call> c{static_cast<Call*>(tag)};
+        --inflight;
+        if (c->status.ok()) {
+            done[c->seq] = c->render();
+        } else {
+            done[c->seq] = "error: " + c->status.error_message() + '\n';
+            ++failed;
+        }
+        flush();
+    }
+    cq.Shutdown();
+    return failed;
+}
+
+} // namespace batch
+
 int main(int argc, char** argv)
 try {
     Config cfg = parse(argc, argv);
     auto stub  = booking::Booking::NewStub(makeChannel(cfg));
     grpc::ClientContext ctx;
 
+    if (cfg.cmd == "batch") {
+        std::ifstream file;
+        if (!cfg.file.empty()) {
+            file.open(cfg.file);
+            if (!file) throw std::runtime_error("cannot open " + cfg.file);
+        }
+        const auto t0     = std::chrono::steady_clock::now();
+        const auto failed = batch::run(*stub, cfg.file.empty() ? std::cin : file, cfg.window);
+        std::cerr << failed << " failed, "
+                  << std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count()
+                  << " s\n";
+        return failed ? 1 : 0;
+    }
+
     if (cfg.cmd == "list-movies") {
-        booking::Empty req; booking::MovieList resp;
-        if (!stub->ListMovies(&ctx, req, &resp).ok())
-            throw std::runtime_error("ListMovies RPC failed");
+        booking::ListMoviesReq req;
+        req.set_page_size(cfg.pageSize);
+        req.add_fields("title");
+        do {                                            // one RPC per page
+            grpc::ClientContext page;
+            booking::MovieList resp;
+            if (!stub->ListMovies(&page, req, &resp).ok())
+                throw std::runtime_error("ListMovies RPC failed");
+
+            for (auto& m : resp.movies())
+                std::cout << m.id() << '\t' << m.title() << '\n';
+            req.set_page_token(resp.next_page_token());
+        } while (!req.page_token().empty());
+    }
+    else if (cfg.cmd == "search") {
+        if (cfg.query.empty()) { std::cerr << "--query required\n"; return 1; }
+        booking::SearchReq req;
+        req.set_query(cfg.query);
+        req.set_limit(cfg.top);
+        booking::MovieList resp;
+        if (!stub->SearchMovies(&ctx, req, &resp).ok())
+            throw std::runtime_error("SearchMovies RPC failed");
 
         for (auto& m : resp.movies())
             std::cout << m.id() << '\t' << m.title() << '\n';
     }
     else if (cfg.cmd == "list-theaters") {
         if (!cfg.movie) { std::cerr << "--movie required\n"; return 1; }
-        booking::MovieId mid; mid.set_id(cfg.movie);
-        booking::TheaterList resp;
-        if (!stub->ListTheaters(&ctx, mid, &resp).ok())
-            throw std::runtime_error("ListTheaters RPC failed");
+        booking::ListTheatersReq req;
+        req.set_movie_id(cfg.movie);
+        req.set_page_size(cfg.pageSize);
+        do {
+            grpc::ClientContext page;
+            booking::TheaterList resp;
+            if (!stub->ListTheaters(&page, req, &resp).ok())
+                throw std::runtime_error("ListTheaters RPC failed");
 
-        for (auto& t : resp.theaters())
-            std::cout << t.id() << '\t' << t.name() << '\n';
+            for (auto& t : resp.theaters())
+                std::cout << t.id() << '\t' << t.name() << '\n';
+            req.set_page_token(resp.next_page_token());
+        } while (!req.page_token().empty());
     }
     else if (cfg.cmd == "list-seats") {
         if (!cfg.movie || !cfg.theater) {
@@ -201,19 +567,143 @@ try {
         booking::BookingReq req;
         req.set_movie_id(cfg.movie);
         req.set_theater_id(cfg.theater);
-        for (auto& lbl : cfg.seats) {
-            auto* seat = req.add_seats();
-            seat->set_label(lbl);
-            int n = 0;
-            if (lbl.size() > 1 && std::isdigit(lbl[1]))
-                n = std::stoi(lbl.substr(1));  // "A17" -> 17
-            seat->set_index(n - 1);    
-        }
+        req.set_queue_token(cfg.token);
+        req.set_accessible(cfg.accessible);
+        req.set_idempotency_key(cfg.key);
+        for (auto& lbl : cfg.seats) addSeat(req, lbl);
 
         booking::BookingRep rep;
-        if (!stub->BookSeats(&ctx, req, &rep).ok())
-            throw std::runtime_error("BookSeats failed");
-        std::cout << (rep.success() ? "booked\n" : "booking failed\n");
+        if (const auto st = stub->BookSeats(&ctx, req, &rep); !st.ok())
+            throw std::runtime_error("BookSeats failed: " + st.error_message());
+        if (rep.success())
+            std::cout << "booked, total " << money(rep.total_cents()) << '\n';
+        else
+            std::cout << "booking failed\n";
+    }
+    else if (cfg.cmd == "quote") {
+        if (!cfg.movie || !cfg.theater || cfg.seats.empty()) {
+            std::cerr << "--movie --theater --seat required\n"; return 1; }
+        booking::BookingReq req;
+        req.set_movie_id(cfg.movie);
+        req.set_theater_id(cfg.theater);
+        for (auto& lbl : cfg.seats) addSeat(req, lbl);
+
+        booking::PriceQuote q;
+        if (!stub->QuotePrice(&ctx, req, &q).ok())
+            throw std::runtime_error("QuotePrice RPC failed");
+        std::cout << money(q.total_cents()) << '\n';
+    }
+    else if (cfg.cmd == "join-queue") {
+        if (!cfg.movie) { std::cerr << "--movie required\n"; return 1; }
+        booking::QueueReq req; req.set_movie_id(cfg.movie);
+        booking::QueueTicket t;
+        if (!stub->JoinQueue(&ctx, req, &t).ok())
+            throw std::runtime_error("JoinQueue RPC failed");
+
+        while (!t.admitted()) {
+            std::cerr << "position " << t.position() << '\n';
+            std::this_thread::sleep_for(std::chrono::milliseconds(t.retry_after_ms()));
+            grpc::ClientContext poll;
+            booking::TicketReq tr;
+            tr.set_movie_id(cfg.movie);
+            tr.set_token(t.token());
+            if (!stub->QueueStatus(&poll, tr, &t).ok())
+                throw std::runtime_error("QueueStatus RPC failed");
+        }
+        std::cout << t.token() << '\n';
+    }
+    else if (cfg.cmd == "metrics") {
+        auto admin = booking::BookingAdmin::NewStub(makeAdminChannel(cfg));
+        booking::MetricsText resp;
+        if (!admin->GetMetrics(&ctx, booking::Empty{}, &resp).ok())
+            throw std::runtime_error("GetMetrics RPC failed");
+        std::cout << resp.text();
+    }
+    else if (cfg.cmd == "lock-report") {
+        auto admin = booking::BookingAdmin::NewStub(makeAdminChannel(cfg));
+        booking::LockReportReq req;
+        req.set_top(cfg.top);
+        booking::LockReport resp;
+        if (!admin->GetLockReport(&ctx, req, &resp).ok())
+            throw std::runtime_error("GetLockReport RPC failed");
+        std::cout << resp.text();
+    }
+    else if (cfg.cmd == "trace") {
+        auto admin = booking::BookingAdmin::NewStub(makeAdminChannel(cfg));
+        booking::TracingReq req;
+        req.set_sample_every(cfg.every);
+        booking::Empty resp;
+        if (!admin->SetTracing(&ctx, req, &resp).ok())
+            throw std::runtime_error("SetTracing RPC failed");
+        std::cerr << (cfg.every ? "tracing 1 in " + std::to_string(cfg.every) + " requests\n"
+                                : std::string{"tracing off\n"});
+    }
+    else if (cfg.cmd == "trace-dump") {
+        auto admin = booking::BookingAdmin::NewStub(makeAdminChannel(cfg));
+        booking::TraceDump resp;
+        if (!admin->DumpTrace(&ctx, booking::TraceDumpReq{}, &resp).ok())
+            throw std::runtime_error("DumpTrace RPC failed");
+        std::cout << resp.json();
+        std::cerr << resp.events() << " events\n";
+    }
+    else if (cfg.cmd == "stats") {
+        auto admin = booking::BookingAdmin::NewStub(makeAdminChannel(cfg));
+        booking::StatsReq req;
+        req.set_movie_id(cfg.movie);
+        booking::Stats resp;
+        if (cfg.every == 0) {
+            const auto st = admin->GetStats(&ctx, req, &resp);
+            if (!st.ok()) throw std::runtime_error("GetStats failed: " + st.error_message());
+            printStats(resp);
+        } else {
+            req.set_interval_ms(cfg.every);
+            auto reader = admin->WatchStats(&ctx, req);
+            while (reader->Read(&resp)) {
+                printStats(resp);
+                std::cout << std::endl;
+            }
+            const auto st = reader->Finish();
+            if (!st.ok()) throw std::runtime_error("WatchStats failed: " + st.error_message());
+        }
+    }
+    else if (cfg.cmd == "add-movie") {
+        auto admin = booking::BookingAdmin::NewStub(makeAdminChannel(cfg));
+        booking::Movie req;
+        req.set_id(cfg.movie);
+        req.set_title(cfg.title);
+        req.set_description(cfg.desc);
+        booking::Empty resp;
+        const auto st = admin->AddMovie(&ctx, req, &resp);
+        if (!st.ok()) throw std::runtime_error("AddMovie failed: " + st.error_message());
+        std::cout << "Movie " << cfg.movie << " added\n";
+    }
+    else if (cfg.cmd == "add-screening") {
+        auto admin = booking::BookingAdmin::NewStub(makeAdminChannel(cfg));
+        booking::ScreeningReq req;
+        req.set_movie_id(cfg.movie);
+        req.set_theater_id(cfg.theater);
+        req.set_name(cfg.name);
+        booking::Empty resp;
+        const auto st = admin->AddScreening(&ctx, req, &resp);
+        if (!st.ok()) throw std::runtime_error("AddScreening failed: " + st.error_message());
+        std::cout << "Theater " << cfg.theater << " now screens movie " << cfg.movie << '\n';
+    }
+    else if (cfg.cmd == "retire-screening") {
+        auto admin = booking::BookingAdmin::NewStub(makeAdminChannel(cfg));
+        booking::TheaterReq req;
+        req.set_movie_id(cfg.movie);
+        req.set_theater_id(cfg.theater);
+        booking::Empty resp;
+        const auto st = admin->RetireScreening(&ctx, req, &resp);
+        if (!st.ok()) throw std::runtime_error("RetireScreening failed: " + st.error_message());
+        std::cout << "Theater " << cfg.theater << " retired for movie " << cfg.movie << '\n';
+    }
+    else if (cfg.cmd == "promote") {
+        auto admin = booking::BookingAdmin::NewStub(makeAdminChannel(cfg));
+        booking::Empty req, resp;
+        const auto st = admin->Promote(&ctx, req, &resp);
+        if (!st.ok()) throw std::runtime_error("Promote failed: " + st.error_message());
+        std::cout << "Promoted to primary\n";
     }
     else {
         std::cerr << "Unknown command '" << cfg.cmd << "'\n";
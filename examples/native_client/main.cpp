@@ -10,9 +10,9 @@ int main()
     auto channel = transport::makeNetworkChannel("127.0.0.1", 50051);
     auto stub    = booking::Booking::NewStub(channel);
 
-    booking::Empty      req;
-    booking::MovieList  resp;
-    grpc::ClientContext ctx;
+    booking::ListMoviesReq req;
+    booking::MovieList     resp;
+    grpc::ClientContext    ctx;
 
     auto status = stub->ListMovies(&ctx, req, &resp);
     if (!status.ok()) {
@@ -0,0 +1,192 @@
+// grpc/AdmissionControl.cpp
+#include "AdmissionControl.hpp"
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::int64_t nowNs() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               Clock::now().time_since_epoch()).count();
+}
+
+/// CAS helper for the `double` limit - C++17 has no atomic<double>::fetch_add.
+template <class F>
+void updateDouble(std::atomic<double>& a, F&& f) noexcept
+{
+    double cur = a.load(std::memory_order_relaxed);
+    while (!a.compare_exchange_weak(cur, f(cur), std::memory_order_relaxed)) {}
+}
+
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// AimdLimiter
+// ────────────────────────────────────────────────────────────────────────────
+AimdLimiter::AimdLimiter(Config cfg)
+    : cfg_{cfg},
+      limit_{std::clamp(cfg.initialLimit, cfg.minLimit, cfg.maxLimit)} {}
+
+bool AimdLimiter::tryAcquire() noexcept
+{
+    const auto cap = static_cast<std::size_t>(limit_.load(std::memory_order_relaxed));
+    if (inflight_.fetch_add(1, std::memory_order_acq_rel) >= cap) {
+        inflight_.fetch_sub(1, std::memory_order_acq_rel);
+        return false;
+    }
+    return true;
+}
+
+void AimdLimiter::release(std::chrono::nanoseconds latency) noexcept
+{
+    const auto used = inflight_.fetch_sub(1, std::memory_order_acq_rel);
+
+    // EWMA with alpha = 1/8; a lost race only drops one sample
+    const std::int64_t sample = latency.count();
+    std::int64_t prev = ewmaNs_.load(std::memory_order_relaxed);
+    const std::int64_t next = prev == 0 ? sample : prev + (sample - prev) / 8;
+    ewmaNs_.compare_exchange_strong(prev, next, std::memory_order_relaxed);
+
+    if (latency > cfg_.latencyTarget) {
+        const auto now = nowNs();
+        lastSlowNs_.store(now, std::memory_order_relaxed);
+        decrease(now);
+    } else {
+        // grow only while the limit is actually being exercised
+        if (static_cast<double>(used) * 2 >= limit_.load(std::memory_order_relaxed))
+            increase();
+    }
+}
+
+bool AimdLimiter::congested() const noexcept
+{
+    const auto hold = 4 * std::chrono::duration_cast<std::chrono::nanoseconds>(
+                              cfg_.latencyTarget).count();
+    return nowNs() - lastSlowNs_.load(std::memory_order_relaxed) < hold ||
+           static_cast<double>(inflight()) >= std::floor(limit());
+}
+
+void AimdLimiter::increase() noexcept
+{
+    updateDouble(limit_, [&](double l) {
+        return std::min(cfg_.maxLimit, l + 1.0 / l);
+    });
+}
+
+void AimdLimiter::decrease(std::int64_t now) noexcept
+{
+    // at most one back-off per latency-target window, otherwise a burst of
+    // slow completions would collapse the limit to the floor at once
+    const auto window = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            cfg_.latencyTarget).count();
+    std::int64_t last = lastDecreaseNs_.load(std::memory_order_relaxed);
+    if (now - last < window ||
+        !lastDecreaseNs_.compare_exchange_strong(last, now, std::memory_order_relaxed))
+        return;
+
+    updateDouble(limit_, [&](double l) {
+        return std::max(cfg_.minLimit, l * cfg_.backoff);
+    });
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// AdmissionController::Permit
+// ────────────────────────────────────────────────────────────────────────────
+AdmissionController::Permit::Permit(AimdLimiter* l, grpc::Status st)
+    : limiter_{l}, status_{std::move(st)}, start_{Clock::now()} {}
+
+AdmissionController::Permit::Permit(Permit&& o) noexcept
+    : limiter_{o.limiter_}, status_{std::move(o.status_)}, start_{o.start_}
+{
+    o.limiter_ = nullptr;
+}
+
+AdmissionController::Permit::~Permit()
+{
+    if (limiter_)
+        limiter_->release(Clock::now() - start_);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// AdmissionController
+// ────────────────────────────────────────────────────────────────────────────
+AdmissionController::AdmissionController(Config cfg)
+    : cfg_{cfg},
+      limiters_{makeLimiters(cfg, std::make_index_sequence<kKinds>{})} {}
+
+const char* AdmissionController::nameOf(RpcKind k) noexcept
+{
+    switch (k) {
+        case RpcKind::ListMovies:    return "list_movies";
+        case RpcKind::SearchMovies:  return "search_movies";
+        case RpcKind::ListTheaters:  return "list_theaters";
+        case RpcKind::ListFreeSeats: return "list_free_seats";
+        case RpcKind::BookSeats:     return "book_seats";
+        case RpcKind::QuotePrice:    return "quote_price";
+        case RpcKind::JoinQueue:     return "join_queue";
+        case RpcKind::QueueStatus:   return "queue_status";
+        default:                     return "unknown";
+    }
+}
+
+void AdmissionController::attach(booking::telemetry::Registry& reg)
+{
+    for (std::size_t i = 0; i < kKinds; ++i)
+        shed_[i] = &reg.counter("booking_rpc_shed_total",
+                                "Calls rejected by admission control",
+                                {{"rpc", nameOf(static_cast<RpcKind>(i))}});
+}
+
+AdmissionController::Permit
+AdmissionController::reject(RpcKind k, grpc::StatusCode code, std::string msg)
+{
+    if (auto* c = shed_[static_cast<std::size_t>(k)]) c->inc();
+    return Permit{nullptr, grpc::Status(code, std::move(msg))};
+}
+
+bool AdmissionController::writesCongested() const noexcept
+{
+    for (std::size_t i = 0; i < kKinds; ++i)
+        if (priorityOf(static_cast<RpcKind>(i)) == RpcPriority::Write &&
+            limiters_[i].congested())
+            return true;
+    return false;
+}
+
+AdmissionController::Permit
+AdmissionController::admit(RpcKind k, const grpc::ServerContext* ctx)
+{
+    if (!cfg_.enabled)
+        return Permit{nullptr, grpc::Status::OK};
+
+    auto& lim = limiters_[static_cast<std::size_t>(k)];
+
+    // a) deadline budget - don't start work the client will never see
+    if (ctx) {
+        const auto deadline = ctx->deadline();
+        if (deadline != std::chrono::system_clock::time_point::max()) {
+            const auto remaining = deadline - std::chrono::system_clock::now();
+            const auto budget    = std::max<std::chrono::nanoseconds>(
+                                       cfg_.minDeadlineBudget, lim.smoothedLatency());
+            if (remaining < budget)
+                return reject(k, grpc::StatusCode::DEADLINE_EXCEEDED,
+                              std::string{"remaining deadline too short for "} + nameOf(k));
+        }
+    }
+
+    // b) priority - reads yield while bookings are queueing or slow
+    if (priorityOf(k) == RpcPriority::Read && writesCongested())
+        return reject(k, grpc::StatusCode::RESOURCE_EXHAUSTED,
+                      std::string{"load shed ("} + nameOf(k) + "): write path congested");
+
+    // c) per-kind adaptive concurrency limit
+    if (!lim.tryAcquire())
+        return reject(k, grpc::StatusCode::RESOURCE_EXHAUSTED,
+                      std::string{"load shed ("} + nameOf(k) + "): concurrency limit reached");
+
+    return Permit{&lim, grpc::Status::OK};
+}
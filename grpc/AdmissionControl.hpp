@@ -0,0 +1,201 @@
+#ifndef ADMISSION_CONTROL_HPP
+#define ADMISSION_CONTROL_HPP
+
+#include "booking/telemetry/Metrics.hpp"
+#include <grpcpp/grpcpp.h>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <utility>
+
+/**
+ * @file AdmissionControl.hpp
+ * @brief Per-RPC concurrency limits and priority-aware load shedding for
+ *        the gRPC layer.
+ *
+ * Every incoming call first asks the @ref AdmissionController for a
+ * @ref AdmissionController::Permit.  A request is shed *before* it touches
+ * the `BookingManager` when
+ *
+ *  1. its remaining deadline is shorter than the time the RPC usually takes
+ *     (`DEADLINE_EXCEEDED` - it would fail anyway), or
+ *  2. the concurrency limit of its RPC kind is reached, or
+ *  3. it is a low-priority read while the write path is congested
+ *     (`RESOURCE_EXHAUSTED` in both cases).
+ *
+ * Limits adapt with **AIMD** from the latencies reported back when a permit
+ * is released: +1 per "limit" fast completions, ×`backoff` when a completion
+ * exceeds the latency target.
+ */
+
+/// RPC kinds that have their own limiter (order == proto declaration order).
+enum class RpcKind : std::uint8_t
+{
+    ListMovies = 0,
+    SearchMovies,
+    ListTheaters,
+    ListFreeSeats,
+    BookSeats,
+    QuotePrice,
+    JoinQueue,
+    QueueStatus,
+    Count_                       ///< number of kinds - keep last
+};
+
+/// Scheduling class - writes are never starved by read polling.
+enum class RpcPriority : std::uint8_t { Read, Write };
+
+/**
+ * @class AimdLimiter
+ * @brief Lock-free adaptive concurrency limit for a single RPC kind.
+ *
+ * `tryAcquire()` / `release()` are wait-free on the fast path; the limit
+ * itself is a `double` updated with a CAS loop so that fractional additive
+ * increases (`1/limit` per completion) accumulate correctly.
+ */
+class AimdLimiter
+{
+public:
+    /// Tunables for one limiter.
+    struct Config
+    {
+        double                    initialLimit  = 64;    ///< starting concurrency
+        double                    minLimit      = 4;     ///< floor - never shed below
+        double                    maxLimit      = 1024;  ///< ceiling
+        double                    backoff       = 0.9;   ///< multiplicative decrease
+        std::chrono::microseconds latencyTarget{5000};   ///< "too slow" threshold
+    };
+
+    explicit AimdLimiter(Config cfg);
+
+    /// Reserve one concurrency slot; `false` if the limit is reached.
+    [[nodiscard]] bool tryAcquire() noexcept;
+
+    /// Return a slot and feed the observed service latency back.
+    void release(std::chrono::nanoseconds latency) noexcept;
+
+    [[nodiscard]] std::size_t inflight()   const noexcept { return inflight_.load(std::memory_order_relaxed); }
+    [[nodiscard]] double      limit()      const noexcept { return limit_.load(std::memory_order_relaxed); }
+
+    /// Exponentially smoothed service latency (0 until the first sample).
+    [[nodiscard]] std::chrono::nanoseconds smoothedLatency() const noexcept
+    {
+        return std::chrono::nanoseconds{ewmaNs_.load(std::memory_order_relaxed)};
+    }
+
+    /// `true` while the limiter is saturated or a recent sample was too slow
+    /// (a slow sample counts for four latency-target windows).
+    [[nodiscard]] bool congested() const noexcept;
+
+private:
+    void increase() noexcept;
+    void decrease(std::int64_t nowNs) noexcept;
+
+    Config                    cfg_;
+    std::atomic<std::size_t>  inflight_{0};
+    std::atomic<double>       limit_;
+    std::atomic<std::int64_t> ewmaNs_{0};
+    std::atomic<std::int64_t> lastDecreaseNs_{0};
+    std::atomic<std::int64_t> lastSlowNs_{std::numeric_limits<std::int64_t>::min() / 2};
+};
+
+/**
+ * @class AdmissionController
+ * @brief Front door of `BookingServiceImpl` - one @ref AimdLimiter per
+ *        @ref RpcKind plus write-over-read prioritisation.
+ */
+class AdmissionController
+{
+public:
+    /// Global switch plus per-kind limiter settings.
+    struct Config
+    {
+        bool enabled = true;
+
+        /// Never admit a call with less remaining deadline than this, even
+        /// before any latency has been observed.
+        std::chrono::microseconds minDeadlineBudget{500};
+
+        AimdLimiter::Config reads  {  64, 4, 1024, 0.9, std::chrono::microseconds{5000}  };
+        AimdLimiter::Config writes {  32, 2,  512, 0.9, std::chrono::microseconds{10000} };
+    };
+
+    /**
+     * @class Permit
+     * @brief RAII admission ticket - releases its slot (and reports the
+     *        latency) when it goes out of scope.
+     */
+    class Permit
+    {
+    public:
+        Permit(Permit&& o) noexcept;
+        Permit& operator=(Permit&&) = delete;
+        Permit(const Permit&)            = delete;
+        Permit& operator=(const Permit&) = delete;
+        ~Permit();
+
+        /// `true` if the call may proceed.
+        explicit operator bool() const noexcept { return status_.ok(); }
+
+        /// Rejection status to return from the handler (OK when admitted).
+        [[nodiscard]] const grpc::Status& status() const noexcept { return status_; }
+
+    private:
+        friend class AdmissionController;
+        Permit(AimdLimiter* l, grpc::Status st);
+
+        AimdLimiter*                          limiter_;
+        grpc::Status                          status_;
+        std::chrono::steady_clock::time_point start_;
+    };
+
+    explicit AdmissionController(Config cfg);
+
+    /**
+     * @brief Decide whether a call of kind @p k may run now.
+     * @param k   RPC kind (selects limiter + priority).
+     * @param ctx Server context for deadline inspection; may be `nullptr`.
+     */
+    [[nodiscard]] Permit admit(RpcKind k, const grpc::ServerContext* ctx);
+
+    /// Count rejections per kind in @p reg (`booking_rpc_shed_total`).
+    void attach(booking::telemetry::Registry& reg);
+
+    /// Read-only access for diagnostics / tests.
+    [[nodiscard]] const AimdLimiter& limiter(RpcKind k) const
+    {
+        return limiters_[static_cast<std::size_t>(k)];
+    }
+
+    [[nodiscard]] static RpcPriority priorityOf(RpcKind k) noexcept
+    {
+        return k == RpcKind::BookSeats ? RpcPriority::Write : RpcPriority::Read;
+    }
+
+    /// Stable lower-case label used in log lines and rejection messages.
+    [[nodiscard]] static const char* nameOf(RpcKind k) noexcept;
+
+private:
+    static constexpr std::size_t kKinds = static_cast<std::size_t>(RpcKind::Count_);
+
+    template <std::size_t... I>
+    static std::array<AimdLimiter, kKinds> makeLimiters(const Config& c, std::index_sequence<I...>)
+    {
+        return {{ AimdLimiter{priorityOf(static_cast<RpcKind>(I)) == RpcPriority::Write
+                                  ? c.writes : c.reads}... }};
+    }
+
+    [[nodiscard]] bool writesCongested() const noexcept;
+    [[nodiscard]] Permit reject(RpcKind k, grpc::StatusCode code, std::string msg);
+
+    Config                          cfg_;
+    std::array<AimdLimiter, kKinds> limiters_;
+    std::array<booking::telemetry::Counter*, kKinds> shed_{};   ///< optional
+
+};
+
+#endif //ADMISSION_CONTROL_HPP
@@ -0,0 +1,251 @@
+// grpc/BookingAdminImpl.cpp
+#include "BookingAdminImpl.hpp"
+#include "booking/telemetry/LockProfiler.hpp"
+#include "booking/telemetry/Tracer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1) GetMetrics
+// ────────────────────────────────────────────────────────────────────────────
+grpc::Status BookingAdminImpl::GetMetrics(
+        grpc::ServerContext*,
+        const booking::Empty*,
+        booking::MetricsText* out)
+{
+    if (!metrics_)
+        return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                            "metrics disabled (--no-metrics)");
+
+    out->set_text(metrics_->exposition());
+    return grpc::Status::OK;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2) GetLockReport
+// ────────────────────────────────────────────────────────────────────────────
+grpc::Status BookingAdminImpl::GetLockReport(
+        grpc::ServerContext*,
+        const booking::LockReportReq* in,
+        booking::LockReport* out)
+{
+    auto& profiler = booking::telemetry::LockProfiler::instance();
+
+    std::ostringstream os;
+    profiler.report(os, in->top() ? in->top() : 10);
+    if (in->reset()) profiler.reset();
+
+    out->set_text(os.str());
+    out->set_profiling(booking::telemetry::kLockProfiling);
+    return grpc::Status::OK;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3) SetTracing / DumpTrace
+// ────────────────────────────────────────────────────────────────────────────
+grpc::Status BookingAdminImpl::SetTracing(
+        grpc::ServerContext*,
+        const booking::TracingReq* in,
+        booking::Empty*)
+{
+    booking::telemetry::Tracer::instance().setSampling(in->sample_every());
+    return grpc::Status::OK;
+}
+
+grpc::Status BookingAdminImpl::DumpTrace(
+        grpc::ServerContext*,
+        const booking::TraceDumpReq* in,
+        booking::TraceDump* out)
+{
+    auto& tracer = booking::telemetry::Tracer::instance();
+
+    std::ostringstream os;
+    out->set_events(static_cast<std::uint32_t>(tracer.writeChromeJson(os)));
+    if (in->clear()) tracer.clear();
+
+    out->set_json(os.str());
+    return grpc::Status::OK;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4) GetStats / WatchStats
+// ────────────────────────────────────────────────────────────────────────────
+namespace {
+void fillSales(const booking::domain::Sales& in, booking::SalesCounters* out)
+{
+    out->set_attempts(in.attempts);
+    out->set_bookings(in.bookings);
+    out->set_seats_sold(in.seatsSold);
+    out->set_conflicts(in.conflicts);
+    out->set_refused(in.refused);
+    out->set_revenue_cents(in.revenueCents);
+}
+
+/// false for an unknown movie filter.
+bool fillStats(const booking::service::BookingManager& mgr,
+               booking::domain::Movie::Id movie, booking::Stats* out)
+{
+    const auto sales = mgr.sales(movie);
+    if (movie != 0 && sales.empty()) return false;
+
+    booking::domain::Sales total;
+    for (const auto& ms : sales) {
+        auto* m = out->add_movies();
+        m->set_movie_id(ms.id);
+        fillSales(ms.total, m->mutable_sales());
+        for (const auto& [tid, hall] : ms.halls) {
+            auto* h = m->add_halls();
+            h->set_theater_id(tid);
+            h->set_capacity(static_cast<std::uint32_t>(booking::domain::Theater::kCapacity));
+            fillSales(hall, h->mutable_sales());
+        }
+        total += ms.total;
+    }
+    fillSales(total, out->mutable_total());
+    return true;
+}
+
+/// Wakes a WatchStats loop when the catalog feed closes.
+class StopSignal final : public CatalogFeed::Watcher
+{
+public:
+    void onVersion(std::uint64_t) override {}
+    void onClose() override
+    {
+        const std::lock_guard lock{mtx_};
+        closed_ = true;
+        cv_.notify_all();
+    }
+
+    /// Sleep up to @p d; true once the feed has closed.
+    bool waitFor(std::chrono::milliseconds d)
+    {
+        std::unique_lock lock{mtx_};
+        return cv_.wait_for(lock, d, [this] { return closed_; });
+    }
+
+private:
+    std::mutex              mtx_;
+    std::condition_variable cv_;
+    bool                    closed_ = false;
+};
+} // namespace
+
+grpc::Status BookingAdminImpl::GetStats(
+        grpc::ServerContext*,
+        const booking::StatsReq* in,
+        booking::Stats* out)
+{
+    if (!fillStats(*mgr_, in->movie_id(), out))
+        return grpc::Status(grpc::StatusCode::NOT_FOUND, "movie not found");
+    return grpc::Status::OK;
+}
+
+grpc::Status BookingAdminImpl::WatchStats(
+        grpc::ServerContext* ctx,
+        const booking::StatsReq* in,
+        grpc::ServerWriter<booking::Stats>* out)
+{
+    if (!catalog_)
+        return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "catalog feed disabled");
+    const std::chrono::milliseconds every{
+        in->interval_ms() == 0 ? 1000u : std::clamp(in->interval_ms(), 50u, 60000u)};
+
+    StopSignal stop;
+    if (!catalog_->subscribe(&stop))
+        return grpc::Status(grpc::StatusCode::UNAVAILABLE, "server shutting down");
+    struct Unsubscribe
+    {
+        CatalogFeed& feed;
+        StopSignal&  w;
+        ~Unsubscribe() { feed.unsubscribe(&w); }
+    } unsubscribe{*catalog_, stop};
+
+    booking::Stats msg;
+    do {
+        msg.Clear();
+        if (!fillStats(*mgr_, in->movie_id(), &msg))
+            return grpc::Status(grpc::StatusCode::NOT_FOUND, "movie not found");
+        if (!out->Write(msg)) break;                   // client went away
+    } while (!stop.waitFor(every) && !ctx->IsCancelled());
+    return grpc::Status::OK;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 5) Catalog maintenance
+// ────────────────────────────────────────────────────────────────────────────
+namespace {
+grpc::Status toStatus(booking::service::CatalogStatus st, const char* what)
+{
+    using booking::service::CatalogStatus;
+    switch (st) {
+        case CatalogStatus::Ok:
+            return grpc::Status::OK;
+        case CatalogStatus::NotFound:
+            return grpc::Status(grpc::StatusCode::NOT_FOUND, std::string{what} + " not found");
+        case CatalogStatus::AlreadyExists:
+            return grpc::Status(grpc::StatusCode::ALREADY_EXISTS, std::string{what} + " already exists");
+        case CatalogStatus::ReadOnly:
+            return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, "server is a read-only standby");
+        case CatalogStatus::Unreplicated:
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "no standby confirmed the change");
+        case CatalogStatus::Invalid:
+            break;
+    }
+    return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "id must be non-zero");
+}
+} // namespace
+
+booking::service::CatalogStatus BookingAdminImpl::published(booking::service::CatalogStatus st)
+{
+    if (st == booking::service::CatalogStatus::Ok && catalog_) catalog_->bump();
+    return st;
+}
+
+grpc::Status BookingAdminImpl::AddMovie(
+        grpc::ServerContext*,
+        const booking::Movie* in,
+        booking::Empty*)
+{
+    const TrafficCapture::Call capture{capture_.get(), transport::capture::Method::AddMovie, *in};
+    return toStatus(published(mgr_->addMovie({in->id(), in->title(), in->description()})), "movie");
+}
+
+grpc::Status BookingAdminImpl::AddScreening(
+        grpc::ServerContext*,
+        const booking::ScreeningReq* in,
+        booking::Empty*)
+{
+    const TrafficCapture::Call capture{capture_.get(), transport::capture::Method::AddScreening, *in};
+    const auto st = published(mgr_->addScreening(in->movie_id(), in->theater_id(), in->name()));
+    return toStatus(st, st == booking::service::CatalogStatus::NotFound ? "movie" : "screening");
+}
+
+grpc::Status BookingAdminImpl::RetireScreening(
+        grpc::ServerContext*,
+        const booking::TheaterReq* in,
+        booking::Empty*)
+{
+    const TrafficCapture::Call capture{capture_.get(), transport::capture::Method::RetireScreening, *in};
+    return toStatus(published(mgr_->retireScreening(in->movie_id(), in->theater_id())), "screening");
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 6) Promote
+// ────────────────────────────────────────────────────────────────────────────
+grpc::Status BookingAdminImpl::Promote(
+        grpc::ServerContext*,
+        const booking::Empty*,
+        booking::Empty*)
+{
+    if (!standby_)
+        return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                            "not a standby (--standby-of)");
+    if (!standby_->promote())
+        return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, "already promoted");
+    return grpc::Status::OK;
+}
@@ -0,0 +1,173 @@
+#ifndef BOOKING_ADMIN_IMPL_HPP
+#define BOOKING_ADMIN_IMPL_HPP
+
+#include "CatalogFeed.hpp"
+#include "Standby.hpp"
+#include "TrafficCapture.hpp"
+#include "booking/service/BookingManager.hpp"
+#include "booking/telemetry/Metrics.hpp"
+#include "booking.grpc.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <memory>
+
+/**
+ * @file BookingAdminImpl.hpp
+ * @brief Operator-facing gRPC service (*booking.BookingAdmin*) - metrics
+ *        scraping, diagnostics and live catalog maintenance that customer
+ *        clients never call.
+ *
+ * Kept separate from @ref BookingServiceImpl so that deployments can
+ * expose it on a trusted listener only, and so that diagnostics never
+ * compete with booking traffic for admission-control permits.
+ */
+class BookingAdminImpl final : public booking::BookingAdmin::Service
+{
+public:
+    /**
+     * @brief Construct the admin service.
+     * @param mgr     Booking façade the catalog RPCs operate on.
+     * @param metrics Registry rendered by `GetMetrics` (may be `nullptr`,
+     *                then the RPC answers `FAILED_PRECONDITION`).
+     * @param catalog Feed bumped after every successful catalog change
+     *                (may be `nullptr`).
+     * @param capture Request log the catalog RPCs are appended to (may be
+     *                `nullptr`).
+     * @param standby Replica `Promote` acts on (`nullptr` on a primary).
+     */
+    BookingAdminImpl(std::shared_ptr<booking::service::BookingManager> mgr,
+                     std::shared_ptr<booking::telemetry::Registry>     metrics,
+                     std::shared_ptr<CatalogFeed>                      catalog = nullptr,
+                     std::shared_ptr<TrafficCapture>                   capture = nullptr,
+                     std::shared_ptr<Standby>                          standby = nullptr)
+        : mgr_(std::move(mgr)), metrics_(std::move(metrics)), catalog_(std::move(catalog)),
+          capture_(std::move(capture)), standby_(std::move(standby)) {}
+
+    /**
+     * @brief Render all registered metrics in Prometheus text format.
+     * @param ctx   gRPC server context (unused).
+     * @param in    Empty request message.
+     * @param out   Exposition text.
+     */
+    grpc::Status GetMetrics(
+        grpc::ServerContext*           ctx,
+        const booking::Empty*          in,
+        booking::MetricsText*          out) override;
+
+    /**
+     * @brief Dump the lock contention profile (top contended halls first).
+     * @param ctx   gRPC server context (unused).
+     * @param in    Rows per site family and optional counter reset.
+     * @param out   Report text; `profiling == false` when the server was
+     *              built without `BOOKING_LOCK_PROFILING`.
+     */
+    grpc::Status GetLockReport(
+        grpc::ServerContext*           ctx,
+        const booking::LockReportReq*  in,
+        booking::LockReport*           out) override;
+
+    /**
+     * @brief Switch request tracing on (sample 1 in N) or off (0).
+     * @param ctx   gRPC server context (unused).
+     * @param in    Sampling interval.
+     * @param out   Empty reply.
+     */
+    grpc::Status SetTracing(
+        grpc::ServerContext*           ctx,
+        const booking::TracingReq*     in,
+        booking::Empty*                out) override;
+
+    /**
+     * @brief Dump buffered request spans as Chrome trace-event JSON.
+     * @param ctx   gRPC server context (unused).
+     * @param in    Optionally clear the buffers after dumping.
+     * @param out   JSON document + event count.
+     */
+    grpc::Status DumpTrace(
+        grpc::ServerContext*           ctx,
+        const booking::TraceDumpReq*   in,
+        booking::TraceDump*            out) override;
+
+    /**
+     * @brief Sales counters per movie and hall, summed from per-core slots.
+     * @param ctx   gRPC server context (unused).
+     * @param in    Movie filter (0 = all).
+     * @param out   Per-movie totals (retired halls included), current
+     *              halls and a grand total; `NOT_FOUND` for an unknown
+     *              movie.
+     */
+    grpc::Status GetStats(
+        grpc::ServerContext*           ctx,
+        const booking::StatsReq*       in,
+        booking::Stats*                out) override;
+
+    /**
+     * @brief GetStats() now and then every `interval_ms` (50 ms … 60 s).
+     *
+     * A plain synchronous stream - it holds one server thread while open,
+     * which is fine for the handful of dashboards on the admin listener.
+     * Ends when the client cancels or the catalog feed closes (shutdown);
+     * `UNIMPLEMENTED` without a feed.
+     */
+    grpc::Status WatchStats(
+        grpc::ServerContext*                ctx,
+        const booking::StatsReq*            in,
+        grpc::ServerWriter<booking::Stats>* out) override;
+
+    /**
+     * @brief Publish a new movie (no screenings yet).
+     * @param ctx   gRPC server context (unused).
+     * @param in    Movie id (≠ 0), title and description.
+     * @param out   Empty reply; `ALREADY_EXISTS` if the id is taken.
+     */
+    grpc::Status AddMovie(
+        grpc::ServerContext*           ctx,
+        const booking::Movie*          in,
+        booking::Empty*                out) override;
+
+    /**
+     * @brief Open a hall with an empty seat map for a movie.
+     * @param ctx   gRPC server context (unused).
+     * @param in    Movie id, hall id (≠ 0) and display name.
+     * @param out   Empty reply; `NOT_FOUND` / `ALREADY_EXISTS` on conflict.
+     */
+    grpc::Status AddScreening(
+        grpc::ServerContext*           ctx,
+        const booking::ScreeningReq*   in,
+        booking::Empty*                out) override;
+
+    /**
+     * @brief Withdraw a screening; its bookings are discarded.
+     * @param ctx   gRPC server context (unused).
+     * @param in    Movie id + hall id.
+     * @param out   Empty reply; `NOT_FOUND` if not screened there.
+     */
+    grpc::Status RetireScreening(
+        grpc::ServerContext*           ctx,
+        const booking::TheaterReq*     in,
+        booking::Empty*                out) override;
+
+    /**
+     * @brief Turn this standby into a primary: stop following and accept
+     *        bookings and catalog changes.
+     * @param ctx   gRPC server context (unused).
+     * @param in    Empty request message.
+     * @param out   Empty reply; `FAILED_PRECONDITION` when the server is
+     *              not a standby or was already promoted.
+     */
+    grpc::Status Promote(
+        grpc::ServerContext*           ctx,
+        const booking::Empty*          in,
+        booking::Empty*                out) override;
+
+private:
+    std::shared_ptr<booking::service::BookingManager> mgr_;
+    std::shared_ptr<booking::telemetry::Registry>     metrics_;
+    std::shared_ptr<CatalogFeed>                      catalog_;
+    std::shared_ptr<TrafficCapture>                   capture_;
+    std::shared_ptr<Standby>                          standby_;
+
+    /// Bump the catalog version when @p st says the change was applied.
+    booking::service::CatalogStatus published(booking::service::CatalogStatus st);
+};
+
+#endif //BOOKING_ADMIN_IMPL_HPP
@@ -1,28 +1,221 @@
 // grpc/BookingServiceImpl.cpp
 #include "BookingServiceImpl.hpp"
+#include "booking/telemetry/Tracer.hpp"
 #include <absl/container/flat_hash_set.h>        // already shipped via gRPC
+#include <absl/strings/escaping.h>
 #include <algorithm>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <optional>
+#include <string_view>
+#include <mutex>
 
 /* convenient aliases (not exported) */
 namespace  {
 using booking::domain::Movie;
 using booking::domain::Theater;
 using booking::domain::Seat;
+using Captured = transport::capture::Method;
+
+// ── catalog paging ──────────────────────────────────────────────────────────
+constexpr std::uint32_t kMaxPageSize = 1000;
+
+/// page_size -> row limit; 0 keeps the unpaged behaviour.
+std::size_t pageLimit(std::uint32_t pageSize)
+{
+    return pageSize == 0 ? std::numeric_limits<std::size_t>::max()
+                         : std::min(pageSize, kMaxPageSize);
+}
+
+/**
+ * Page tokens are web-safe base64 of {listing, scope, last id}.  The
+ * listing tag and scope (the movie of a hall listing) stop a token from
+ * one listing being replayed against another.
+ */
+std::string encodeCursor(char listing, std::uint32_t scope, std::uint32_t after)
+{
+    std::string raw(9, '\0');
+    raw[0] = listing;
+    for (int i = 0; i < 4; ++i) {
+        raw[1 + i] = static_cast<char>(scope >> (8 * i));
+        raw[5 + i] = static_cast<char>(after >> (8 * i));
+    }
+    return absl::WebSafeBase64Escape(raw);
+}
+
+/// Last id of the previous page; 0 for an empty token, nullopt if invalid.
+std::optional<std::uint32_t> decodeCursor(const std::string& token, char listing,
+                                          std::uint32_t scope)
+{
+    if (token.empty()) return 0;
+    std::string raw;
+    if (!absl::WebSafeBase64Unescape(token, &raw) || raw.size() != 9 || raw[0] != listing)
+        return std::nullopt;
+    std::uint32_t gotScope = 0, after = 0;
+    for (int i = 0; i < 4; ++i) {
+        gotScope |= std::uint32_t{static_cast<unsigned char>(raw[1 + i])} << (8 * i);
+        after    |= std::uint32_t{static_cast<unsigned char>(raw[5 + i])} << (8 * i);
+    }
+    if (gotScope != scope) return std::nullopt;
+    return after;
+}
+
+/// Field mask -> bit i set when optional field @p names[i] is wanted; an
+/// empty mask selects everything, "id" is implied, unknown names fail.
+std::optional<unsigned> fieldMask(const google::protobuf::RepeatedPtrField<std::string>& fields,
+                                  std::initializer_list<std::string_view> names)
+{
+    if (fields.empty()) return ~0u;
+    unsigned mask = 0;
+    for (const auto& f : fields) {
+        if (f == "id") continue;
+        const auto it = std::find(names.begin(), names.end(), f);
+        if (it == names.end()) return std::nullopt;
+        mask |= 1u << (it - names.begin());
+    }
+    return mask;
+}
+
+// ── bookings ────────────────────────────────────────────────────────────────
+constexpr std::size_t kMaxIdempotencyKey = 128;
+
+/// FNV-1a over what a booking asks for - a retry must match it exactly.
+std::uint64_t fingerprint(const booking::BookingReq& req)
+{
+    std::uint64_t h = 0xcbf29ce484222325ULL;
+    auto mix = [&h](std::uint64_t v) {
+        for (int i = 0; i < 8; ++i) { h ^= (v >> (8 * i)) & 0xFF; h *= 0x100000001b3ULL; }
+    };
+    mix(req.movie_id());
+    mix(req.theater_id());
+    mix(req.accessible());
+    for (const auto& s : req.seats()) mix(s.index());
+    return h;
+}
+
+/// Reply + status for a booking outcome; shared by fresh calls and replays.
+grpc::Status bookingReply(booking::domain::BookStatus st, std::uint64_t totalCents,
+                          booking::BookingRep* rep)
+{
+    using booking::domain::BookStatus;
+    rep->set_success(st == BookStatus::Booked);
+    switch (st) {
+        case BookStatus::Booked:
+            rep->set_total_cents(totalCents);
+            return grpc::Status::OK;
+        case BookStatus::Taken:
+            return grpc::Status(grpc::StatusCode::ALREADY_EXISTS,
+                                "one or more seats already booked");
+        case BookStatus::Invalid:
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, describe(st));
+        case BookStatus::NotFound:
+            return grpc::Status(grpc::StatusCode::NOT_FOUND, describe(st));
+        case BookStatus::ReadOnly:
+        case BookStatus::Unreplicated:
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, describe(st));
+        default:                                    // seating rule
+            return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                                std::string{"seating rule: "} + describe(st));
+    }
+}
 } // namespace
 
+// ────────────────────────────────────────────────────────────────────────────
+// 0) ctor - resolve metric handles once so RPCs never touch the registry
+// ────────────────────────────────────────────────────────────────────────────
+BookingServiceImpl::BookingServiceImpl(
+        std::shared_ptr<booking::service::BookingManager> m,
+        ServiceOptions opts)
+    : mgr_(std::move(m)),
+      admission_(opts.admission),
+      room_(std::move(opts.waitingRoom)),
+      catalog_(std::move(opts.catalog)),
+      capture_(std::move(opts.capture)),
+      dedup_(std::move(opts.dedup)),
+      metrics_(std::move(opts.metrics))
+{
+    if (!metrics_) return;
+
+    for (std::size_t i = 0; i < kKinds; ++i)
+        latency_[i] = &metrics_->histogram(
+            "booking_rpc_duration_seconds", "Server-side RPC handling time",
+            {{"rpc", AdmissionController::nameOf(static_cast<RpcKind>(i))}});
+
+    booked_    = &metrics_->counter("booking_book_outcome_total",
+                                    "BookSeats outcomes", {{"outcome", "success"}});
+    conflicts_ = &metrics_->counter("booking_book_outcome_total",
+                                    "BookSeats outcomes", {{"outcome", "conflict"}});
+    refused_   = &metrics_->counter("booking_book_outcome_total",
+                                    "BookSeats outcomes", {{"outcome", "refused"}});
+    replays_   = &metrics_->counter("booking_book_outcome_total",
+                                    "BookSeats outcomes", {{"outcome", "replay"}});
+    admission_.attach(*metrics_);
+}
+
 // ────────────────────────────────────────────────────────────────────────────
 // 1) ListMovies
 // ────────────────────────────────────────────────────────────────────────────
 grpc::Status BookingServiceImpl::ListMovies(
-        grpc::ServerContext*,
-        const booking::Empty*,
+        grpc::ServerContext* ctx,
+        const booking::ListMoviesReq* in,
         booking::MovieList* out)
 {
-    for (Movie const& m : mgr_->movies()) {
+    enum : unsigned { kTitle = 1, kDescription = 2 };
+
+    const TrafficCapture::Call capture{capture_.get(), Captured::ListMovies, *in};
+    const booking::telemetry::TraceRequest trace{"ListMovies"};
+    const booking::telemetry::ScopedTimer  timer{latency(RpcKind::ListMovies)};
+    const auto permit = admission_.admit(RpcKind::ListMovies, ctx);
+    if (!permit) return permit.status();
+
+    const auto mask  = fieldMask(in->fields(), {"title", "description"});
+    const auto after = decodeCursor(in->page_token(), 'M', 0);
+    if (!mask)
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "unknown field in field mask");
+    if (!after)
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "invalid page token");
+
+    if (catalog_) out->set_catalog_version(catalog_->version());   // before the read
+    const auto page = mgr_->moviesPage(*after, pageLimit(in->page_size()));
+    for (Movie const& m : page.items) {
+        auto* mm = out->add_movies();
+        mm->set_id(m.id());
+        if (*mask & kTitle)       mm->set_title(m.title().data(), m.title().size());
+        if (*mask & kDescription) mm->set_description(m.desc().data(), m.desc().size());
+    }
+    if (page.more) out->set_next_page_token(encodeCursor('M', 0, page.items.back().id()));
+    return grpc::Status::OK;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1b) SearchMovies - MovieIndex lookup, only the top hits go on the wire
+// ────────────────────────────────────────────────────────────────────────────
+grpc::Status BookingServiceImpl::SearchMovies(
+        grpc::ServerContext*      ctx,
+        const booking::SearchReq* in,
+        booking::MovieList*       out)
+{
+    constexpr std::uint32_t kMaxLimit = 100;
+
+    const TrafficCapture::Call capture{capture_.get(), Captured::SearchMovies, *in};
+    const booking::telemetry::TraceRequest trace{"SearchMovies"};
+    const booking::telemetry::ScopedTimer  timer{latency(RpcKind::SearchMovies)};
+    const auto permit = admission_.admit(RpcKind::SearchMovies, ctx);
+    if (!permit) return permit.status();
+
+    if (booking::service::MovieIndex::tokenize(in->query()).empty())
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                            "query has no searchable words");
+    const std::size_t limit = in->limit() == 0 ? booking::service::MovieIndex::kDefaultLimit
+                                               : std::min(in->limit(), kMaxLimit);
+
+    if (catalog_) out->set_catalog_version(catalog_->version());
+    for (Movie const& m : mgr_->searchMovies(in->query(), limit)) {
         auto* mm = out->add_movies();
         mm->set_id(m.id());
-        mm->set_title(m.title());
-        mm->set_description(m.desc());
+        mm->set_title(m.title().data(), m.title().size());
+        mm->set_description(m.desc().data(), m.desc().size());
     }
     return grpc::Status::OK;
 }
@@ -31,20 +224,39 @@ grpc::Status BookingServiceImpl::ListMovies(
 // 2) ListTheaters
 // ────────────────────────────────────────────────────────────────────────────
 grpc::Status BookingServiceImpl::ListTheaters(
-        grpc::ServerContext*,
-        const booking::MovieId* in,
+        grpc::ServerContext* ctx,
+        const booking::ListTheatersReq* in,
         booking::TheaterList* out)
 {
-    auto theaters = mgr_->theaters(in->id());
-    if (theaters.empty())
+    enum : unsigned { kName = 1 };
+
+    const TrafficCapture::Call capture{capture_.get(), Captured::ListTheaters, *in};
+    const booking::telemetry::TraceRequest trace{"ListTheaters"};
+    const booking::telemetry::ScopedTimer  timer{latency(RpcKind::ListTheaters)};
+    const auto permit = admission_.admit(RpcKind::ListTheaters, ctx);
+    if (!permit) return permit.status();
+
+    const auto mask  = fieldMask(in->fields(), {"name"});
+    const auto after = decodeCursor(in->page_token(), 'T', in->movie_id());
+    if (!mask)
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "unknown field in field mask");
+    if (!after)
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "invalid page token");
+
+    if (catalog_) out->set_catalog_version(catalog_->version());
+    // a movie added at runtime may legitimately have no screenings yet
+    const auto page = mgr_->theatersPage(in->movie_id(), *after, pageLimit(in->page_size()));
+    if (!page)
         return grpc::Status(grpc::StatusCode::NOT_FOUND,
                             "movie id not found");
 
-    for (auto const& t : theaters) {
+    for (auto const& t : page->items) {
         auto* tt = out->add_theaters();
         tt->set_id(t->id());
-        tt->set_name(t->name());
+        if (*mask & kName) tt->set_name(t->name());
     }
+    if (page->more)
+        out->set_next_page_token(encodeCursor('T', in->movie_id(), page->items.back()->id()));
     return grpc::Status::OK;
 }
 
@@ -52,10 +264,16 @@ grpc::Status BookingServiceImpl::ListTheaters(
 // 3) ListFreeSeats
 // ────────────────────────────────────────────────────────────────────────────
 grpc::Status BookingServiceImpl::ListFreeSeats(
-        grpc::ServerContext*,
+        grpc::ServerContext* ctx,
         const booking::TheaterReq* req,
         booking::SeatList* out)
 {
+    const TrafficCapture::Call capture{capture_.get(), Captured::ListFreeSeats, *req};
+    const booking::telemetry::TraceRequest trace{"ListFreeSeats"};
+    const booking::telemetry::ScopedTimer  timer{latency(RpcKind::ListFreeSeats)};
+    const auto permit = admission_.admit(RpcKind::ListFreeSeats, ctx);
+    if (!permit) return permit.status();
+
     auto seats = mgr_->freeSeats(req->movie_id(), req->theater_id());
     if (seats.empty())
         return grpc::Status(grpc::StatusCode::NOT_FOUND,
@@ -73,11 +291,57 @@ grpc::Status BookingServiceImpl::ListFreeSeats(
 // 4) BookSeats
 // ────────────────────────────────────────────────────────────────────────────
 grpc::Status BookingServiceImpl::BookSeats(
-        grpc::ServerContext*,
+        grpc::ServerContext*       ctx,
         const booking::BookingReq* req,
-        booking::BookingRep*      rep)
+        booking::BookingRep*       rep)
 {
+    const TrafficCapture::Call capture{capture_.get(), Captured::BookSeats, *req};
+    booking::telemetry::TraceRequest      trace{"BookSeats"};
+    const booking::telemetry::ScopedTimer timer{latency(RpcKind::BookSeats)};
+    if (trace.sampled()) trace.arg("bytes", req->ByteSizeLong());
+
+    // --- retries: answer from the dedup table, never reaching the hall -----
+    const std::string& key = req->idempotency_key();
+    if (key.size() > kMaxIdempotencyKey)
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "idempotency key too long");
+    struct Claimed                                  // a Fresh claim not yet completed
+    {
+        DedupTable*        table = nullptr;
+        const std::string& key;
+        ~Claimed() { if (table) table->abandon(key); }
+    } claimed{nullptr, key};
+    if (dedup_ && !key.empty()) {
+        const auto hit = dedup_->claim(key, fingerprint(*req));
+        switch (hit.claim) {
+            case DedupTable::Claim::Replay:
+                if (replays_) replays_->inc();
+                return bookingReply(hit.outcome.status, hit.outcome.totalCents, rep);
+            case DedupTable::Claim::InFlight:
+                return grpc::Status(grpc::StatusCode::ABORTED,
+                                    "request with this idempotency key in progress");
+            case DedupTable::Claim::Mismatch:
+                return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                    "idempotency key reused for a different request");
+            case DedupTable::Claim::Fresh:
+                claimed.table = dedup_.get();
+                break;
+            case DedupTable::Claim::Untracked:
+                break;
+        }
+    }
+
+    // --- hot events: only admitted waiting-room tokens may book -----------
+    if (room_ && !room_->admitted(req->movie_id(), req->queue_token()))
+        return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                            "waiting room: queue token not admitted");
+
+    booking::telemetry::TraceSpan admit{"admission"};
+    const auto permit = admission_.admit(RpcKind::BookSeats, ctx);
+    admit.finish();
+    if (!permit) return permit.status();
+
     // --- sanity: no duplicate seat labels in the request --------------------
+    booking::telemetry::TraceSpan validate{"validate"};
     absl::flat_hash_set<std::string> uniq;
     std::vector<Seat> seats;
     seats.reserve(req->seats_size());
@@ -93,14 +357,214 @@ grpc::Status BookingServiceImpl::BookSeats(
     if (seats.empty())
         return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
                             "no seats provided");
+    validate.finish();
 
-    const bool ok = mgr_->book(req->movie_id(),
-                               req->theater_id(),
-                               seats);
+    // --- an admit is good for a few attempts: take one now the hall is next
+    if (room_ && !room_->admit(req->movie_id(), req->queue_token()))
+        return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION,
+                            "waiting room: queue token used up");
 
-    rep->set_success(ok);
-    if (!ok)
-        return grpc::Status(grpc::StatusCode::ALREADY_EXISTS,
-                            "one or more seats already booked");
+    const auto [st, total, applied] = mgr_->reserve(req->movie_id(),
+                                                    req->theater_id(),
+                                                    seats,
+                                                    req->accessible());
+    const bool ok = st == booking::domain::BookStatus::Booked || applied;
+    if (room_) room_->recordBooking(req->movie_id());
+    if (auto* c = ok ? booked_ : st == booking::domain::BookStatus::Taken ? conflicts_ : refused_) c->inc();
+
+    // A write refused as UNAVAILABLE (standby, no standby attached) is worth
+    // retrying after promotion / once a standby is back, so the key is
+    // released.  One applied here but not acknowledged in time still answers
+    // UNAVAILABLE, but is remembered as booked: the retry gets the seats.
+    const bool retryable = !applied && (st == booking::domain::BookStatus::ReadOnly
+                                     || st == booking::domain::BookStatus::Unreplicated);
+    if (claimed.table && !retryable) {
+        claimed.table->complete(key, {ok ? booking::domain::BookStatus::Booked : st, total});
+        claimed.table = nullptr;
+    }
+    return bookingReply(st, total, rep);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4b) QuotePrice - masked sum over the hall's price column, no hall lock
+// ────────────────────────────────────────────────────────────────────────────
+grpc::Status BookingServiceImpl::QuotePrice(
+        grpc::ServerContext*       ctx,
+        const booking::BookingReq* req,
+        booking::PriceQuote*       out)
+{
+    const TrafficCapture::Call capture{capture_.get(), Captured::QuotePrice, *req};
+    const booking::telemetry::TraceRequest trace{"QuotePrice"};
+    const booking::telemetry::ScopedTimer  timer{latency(RpcKind::QuotePrice)};
+    const auto permit = admission_.admit(RpcKind::QuotePrice, ctx);
+    if (!permit) return permit.status();
+
+    std::vector<Seat> seats;
+    seats.reserve(req->seats_size());
+    for (auto const& s : req->seats()) {
+        if (s.index() >= Theater::kCapacity)
+            return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                                "seat index out of range");
+        seats.push_back({static_cast<std::uint8_t>(s.index()), s.label()});
+    }
+    if (seats.empty())
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                            "no seats provided");
+
+    const auto total = mgr_->quote(req->movie_id(), req->theater_id(), seats);
+    if (!total)
+        return grpc::Status(grpc::StatusCode::NOT_FOUND,
+                            "movie/theater id not found");
+    out->set_total_cents(*total);
+    return grpc::Status::OK;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 5) JoinQueue / QueueStatus - waiting room
+// ────────────────────────────────────────────────────────────────────────────
+namespace {
+void fillTicket(const WaitingRoom::Ticket& t, booking::QueueTicket* out)
+{
+    out->set_token(t.token);
+    out->set_position(t.position);
+    out->set_admitted(t.admitted);
+    out->set_retry_after_ms(t.retryAfterMs);
+}
+} // namespace
+
+grpc::Status BookingServiceImpl::JoinQueue(
+        grpc::ServerContext*     ctx,
+        const booking::QueueReq* req,
+        booking::QueueTicket*    out)
+{
+    const TrafficCapture::Call capture{capture_.get(), Captured::JoinQueue, *req};
+    const booking::telemetry::TraceRequest trace{"JoinQueue"};
+    const booking::telemetry::ScopedTimer  timer{latency(RpcKind::JoinQueue)};
+    const auto permit = admission_.admit(RpcKind::JoinQueue, ctx);
+    if (!permit) return permit.status();
+
+    if (!room_ || !room_->gated(req->movie_id())) {
+        out->set_admitted(true);                 // nothing to wait for
+        return grpc::Status::OK;
+    }
+    fillTicket(room_->join(req->movie_id()), out);
+    return grpc::Status::OK;
+}
+
+grpc::Status BookingServiceImpl::QueueStatus(
+        grpc::ServerContext*      ctx,
+        const booking::TicketReq* req,
+        booking::QueueTicket*     out)
+{
+    const TrafficCapture::Call capture{capture_.get(), Captured::QueueStatus, *req};
+    const booking::telemetry::TraceRequest trace{"QueueStatus"};
+    const booking::telemetry::ScopedTimer  timer{latency(RpcKind::QueueStatus)};
+    const auto permit = admission_.admit(RpcKind::QueueStatus, ctx);
+    if (!permit) return permit.status();
+
+    if (!room_ || !room_->gated(req->movie_id())) {
+        out->set_token(req->token());
+        out->set_admitted(true);
+        return grpc::Status::OK;
+    }
+
+    const auto t = room_->status(req->movie_id(), req->token());
+    if (!t.admitted && t.position == 0)
+        return grpc::Status(grpc::StatusCode::NOT_FOUND,
+                            "queue token invalid or expired");
+    fillTicket(t, out);
     return grpc::Status::OK;
 }
+
+// ────────────────────────────────────────────────────────────────────────────
+// 6) WatchCatalog - one reactor per stream, fed by CatalogFeed
+// ────────────────────────────────────────────────────────────────────────────
+namespace {
+class CatalogWatch final : public grpc::ServerWriteReactor<booking::CatalogVersion>,
+                           public CatalogFeed::Watcher
+{
+public:
+    explicit CatalogWatch(std::shared_ptr<CatalogFeed> feed) : feed_(std::move(feed))
+    {
+        if (!feed_) {
+            Finish(grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "catalog feed disabled"));
+            return;
+        }
+        if (!feed_->subscribe(this)) {
+            const std::lock_guard lock{mtx_};
+            end(grpc::Status(grpc::StatusCode::UNAVAILABLE, "server shutting down"));
+        }
+    }
+
+    void onVersion(std::uint64_t v) override
+    {
+        const std::lock_guard lock{mtx_};
+        latest_ = v;
+        pump();
+    }
+
+    void onClose() override
+    {
+        const std::lock_guard lock{mtx_};
+        end(grpc::Status::OK);
+    }
+
+    void OnWriteDone(bool ok) override
+    {
+        const std::lock_guard lock{mtx_};
+        writing_ = false;
+        if (ending_)  { Finish(status_); return; }
+        if (!ok)      { end(grpc::Status::CANCELLED); return; }
+        pump();
+    }
+
+    void OnCancel() override
+    {
+        const std::lock_guard lock{mtx_};
+        end(grpc::Status::CANCELLED);
+    }
+
+    void OnDone() override
+    {
+        if (feed_) feed_->unsubscribe(this);
+        delete this;
+    }
+
+private:
+    /// Send the newest version unless a write is in flight (mtx_ held);
+    /// intermediate versions are coalesced.
+    void pump()
+    {
+        if (ending_ || writing_ || latest_ == sent_) return;
+        msg_.set_version(latest_);
+        sent_    = latest_;
+        writing_ = true;
+        StartWrite(&msg_);
+    }
+
+    /// Finish once, after any outstanding write (mtx_ held).
+    void end(grpc::Status st)
+    {
+        if (ending_) return;
+        ending_ = true;
+        status_ = std::move(st);
+        if (!writing_) Finish(status_);
+    }
+
+    std::shared_ptr<CatalogFeed> feed_;
+    std::mutex                   mtx_;
+    booking::CatalogVersion      msg_;
+    std::uint64_t                latest_  = 0;
+    std::uint64_t                sent_    = 0;
+    bool                         writing_ = false;
+    bool                         ending_  = false;
+    grpc::Status                 status_;
+};
+} // namespace
+
+grpc::ServerWriteReactor<booking::CatalogVersion>* BookingServiceImpl::WatchCatalog(
+        grpc::CallbackServerContext*,
+        const booking::Empty*)
+{
+    return new CatalogWatch{catalog_};
+}
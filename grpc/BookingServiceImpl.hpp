@@ -1,9 +1,16 @@
 #ifndef BOOKING_SERVER_IMPL_HPP
 #define BOOKING_SERVER_IMPL_HPP
 
+#include "AdmissionControl.hpp"
+#include "CatalogFeed.hpp"
+#include "DedupTable.hpp"
+#include "TrafficCapture.hpp"
+#include "WaitingRoom.hpp"
 #include "booking/service/BookingManager.hpp"
+#include "booking/telemetry/Metrics.hpp"
 #include "booking.grpc.pb.h"
 #include <grpcpp/grpcpp.h>
+#include <array>
 #include <memory>
 
 /**
@@ -16,7 +23,56 @@
  * the corresponding façade method. All heavy-lifting (validation,
  * concurrency control, business rules) lives inside the manager; the
  * service is a thin transport layer.
+ *
+ * Every unary RPC first obtains a permit from an @ref AdmissionController,
+ * so overload is shed early with `RESOURCE_EXHAUSTED` instead of queueing
+ * inside the manager (see AdmissionControl.hpp).  `BookSeats` applies its
+ * policies in this order, stopping at the first refusal:
+ *
+ *  1. **Idempotency** - with a @ref DedupTable, a request whose
+ *     `idempotency_key` is known is answered from the table (`ABORTED`
+ *     while the original is in flight, `INVALID_ARGUMENT` for a key reused
+ *     on another request).
+ *  2. **Waiting room** - for movies configured as hot on-sale events, the
+ *     @ref WaitingRoom queue token must be admitted (`FAILED_PRECONDITION`).
+ *  3. **Admission control** - the permit above.
+ *  4. **Validation** - at least one seat, no duplicate labels
+ *     (`INVALID_ARGUMENT`).
+ *  5. **Token attempts** - the admitted token spends one of its bookings
+ *     (`FAILED_PRECONDITION` once used up).
+ *  6. **Booking** - the manager applies the hall's seating rules
+ *     (`FAILED_PRECONDITION`) and, on a replicated server, needs the
+ *     standby's confirmation (`UNAVAILABLE`).  The outcome is then stored
+ *     under the idempotency key, unless it is `UNAVAILABLE` and worth
+ *     retrying.
+ *
+ * Catalog replies carry the @ref CatalogFeed version and `WatchCatalog`
+ * streams every version change, so clients can cache the catalog (see
+ * transport/CatalogCache.hpp).  The stream uses the callback API and is not
+ * admission-controlled: an idle watcher holds no server thread.
+ *
+ * With a @ref TrafficCapture every unary RPC is appended to a binary
+ * request log that `booking_replay` re-issues (see TrafficCapture.hpp).
+ *
+ * When a metrics registry is supplied every RPC records its latency into a
+ * per-RPC histogram and `BookSeats` counts its outcomes; scrape them with
+ * the `GetMetrics` admin RPC (see BookingAdminImpl.hpp).
+ */
+
+/**
+ * @brief Optional policies applied by @ref BookingServiceImpl in front of
+ *        the manager.  Default-constructed == adaptive admission, no
+ *        waiting room.
  */
+struct ServiceOptions
+{
+    AdmissionController::Config  admission;     ///< load-shedding settings
+    std::shared_ptr<WaitingRoom> waitingRoom;   ///< `nullptr` -> no gating
+    std::shared_ptr<booking::telemetry::Registry> metrics;  ///< `nullptr` -> off
+    std::shared_ptr<CatalogFeed> catalog;       ///< `nullptr` -> no WatchCatalog
+    std::shared_ptr<TrafficCapture> capture;    ///< `nullptr` -> no capture
+    std::shared_ptr<DedupTable>  dedup;         ///< `nullptr` -> idempotency keys ignored
+};
 
  /**
   * @class BookingServiceImpl
@@ -33,41 +89,57 @@
   *  (network/I/O)               (in-memory logic)
   * ```
   */
-class BookingServiceImpl final : public booking::Booking::Service
+class BookingServiceImpl final
+    : public booking::Booking::WithCallbackMethod_WatchCatalog<booking::Booking::Service>
 {
 public:
     /**
      * @brief Construct the service with an already-configured manager.
-     * @param m Shared pointer to the `BookingManager` used to satisfy requests.
+     * @param m    Shared pointer to the `BookingManager` used to satisfy requests.
+     * @param opts Admission-control / waiting-room policies.
      *
      * The pointer is **not** copied; ownership is shared with the caller.
      */
-    explicit BookingServiceImpl(std::shared_ptr<booking::service::BookingManager> m)
-        : mgr_(std::move(m)) {}
+    explicit BookingServiceImpl(std::shared_ptr<booking::service::BookingManager> m,
+                                ServiceOptions opts = {});
 
     // ─────────────────────────────── RPC overrides ─────────────────────────
 
     /**
-     * @brief Return the full list of movies currently “playing”.
-     * @param ctx   gRPC server context (unused).
-     * @param in    Empty request message.
+     * @brief Return the movies currently “playing”, one page at a time.
+     * @param ctx   gRPC server context (deadline feeds admission control).
+     * @param in    Page size / token and field mask (all empty: every movie
+     *              with every field).
      * @param out   Filled with repeated `Movie` messages on success.
-     * @return `grpc::Status::OK` on success, or an error status on failure.
+     * @return `grpc::Status::OK` on success, `INVALID_ARGUMENT` for a bad
+     *         page token or an unknown field in the mask.
      */
     grpc::Status ListMovies(
         grpc::ServerContext*           ctx,
-        const booking::Empty*          in,
+        const booking::ListMoviesReq*  in,
+        booking::MovieList*            out) override;
+
+    /**
+     * @brief Search the catalog by title / description.
+     * @param ctx   gRPC server context.
+     * @param in    Query text and result limit.
+     * @param out   Matching movies, best first; `INVALID_ARGUMENT` for a
+     *              query without any word.
+     */
+    grpc::Status SearchMovies(
+        grpc::ServerContext*           ctx,
+        const booking::SearchReq*      in,
         booking::MovieList*            out) override;
 
     /**
      * @brief Return all theaters that show the given movie.
      * @param ctx   gRPC server context.
-     * @param in    Message with a single `movie_id` field.
+     * @param in    `movie_id` plus paging / field mask as for ListMovies.
      * @param out   Filled with repeated `Theater` messages.
      */
     grpc::Status ListTheaters(
         grpc::ServerContext*           ctx,
-        const booking::MovieId*        in,
+        const booking::ListTheatersReq* in,
         booking::TheaterList*          out) override;
 
     /**
@@ -85,19 +157,109 @@ public:
      * @brief Atomically try to reserve the requested seats.
      * @param ctx   gRPC server context.
      * @param in    Booking request with IDs and seat list.
-     * @param out   Reply with a single `success` boolean.
+     * @param out   Reply with `success` and the price of the booked seats.
      *
      * The underlying manager guarantees **no double-booking** under
      * concurrent calls; a failed attempt returns `success = false`.
+     * For gated movies the request must carry an admitted `queue_token`,
+     * otherwise `FAILED_PRECONDITION` is returned without touching the hall.
+     * A booking the hall's seating rules refuse (wheelchair bay without
+     * `accessible`, distancing, lone empty seat) is `FAILED_PRECONDITION`
+     * too, with the rule in the message; taken seats are `ALREADY_EXISTS`.
+     *
+     * With a @ref DedupTable, a request carrying an `idempotency_key` that
+     * was already answered gets the original reply again (before the
+     * waiting room and admission control); a retry racing the original is
+     * `ABORTED`, the same key on a different request `INVALID_ARGUMENT`.
      */
     grpc::Status BookSeats(
         grpc::ServerContext*           ctx,
         const booking::BookingReq*     in,
         booking::BookingRep*           out) override;
 
+    /**
+     * @brief Price a seat selection without booking it.
+     * @param ctx   gRPC server context.
+     * @param in    Same request as `BookSeats`; `queue_token` is ignored.
+     * @param out   Total in cents.  Seats are priced whether free or not;
+     *              `INVALID_ARGUMENT` for a seat out of range, `NOT_FOUND`
+     *              for an unknown movie / theater.
+     */
+    grpc::Status QuotePrice(
+        grpc::ServerContext*           ctx,
+        const booking::BookingReq*     in,
+        booking::PriceQuote*           out) override;
+
+    /**
+     * @brief Enter the waiting room of a movie.
+     * @param ctx   gRPC server context.
+     * @param in    Movie to queue for.
+     * @param out   Token + initial position (already admitted for ungated
+     *              movies).
+     */
+    grpc::Status JoinQueue(
+        grpc::ServerContext*           ctx,
+        const booking::QueueReq*       in,
+        booking::QueueTicket*          out) override;
+
+    /**
+     * @brief Poll the position of a queue token.
+     * @param ctx   gRPC server context.
+     * @param in    Movie + token obtained from `JoinQueue`.
+     * @param out   Current position / admission flag / polling hint;
+     *              `NOT_FOUND` if the token is invalid or expired.
+     */
+    grpc::Status QueueStatus(
+        grpc::ServerContext*           ctx,
+        const booking::TicketReq*      in,
+        booking::QueueTicket*          out) override;
+
+    /**
+     * @brief Stream catalog versions: the current one at once, then one
+     *        message per catalog change.
+     * @param ctx   Callback server context.
+     * @param in    Empty request message.
+     * @return Reactor owning the stream; `UNIMPLEMENTED` when the service
+     *         was built without a @ref CatalogFeed.
+     */
+    grpc::ServerWriteReactor<booking::CatalogVersion>* WatchCatalog(
+        grpc::CallbackServerContext*   ctx,
+        const booking::Empty*          in) override;
+
 private:
     /// Shared pointer to the business-logic façade.
     std::shared_ptr<booking::service::BookingManager> mgr_;
+
+    /// Per-RPC concurrency limits + write-over-read prioritisation.
+    AdmissionController admission_;
+
+    /// Hot-event gate for `BookSeats` (may be `nullptr`).
+    std::shared_ptr<WaitingRoom> room_;
+
+    /// Catalog version source (may be `nullptr`).
+    std::shared_ptr<CatalogFeed> catalog_;
+
+    /// Request log for booking_replay (may be `nullptr`).
+    std::shared_ptr<TrafficCapture> capture_;
+
+    /// BookSeats outcomes by idempotency key (may be `nullptr`).
+    std::shared_ptr<DedupTable> dedup_;
+
+    // --- metrics (all `nullptr` when no registry was supplied) -------------
+    static constexpr std::size_t kKinds = static_cast<std::size_t>(RpcKind::Count_);
+
+    /// Latency histogram for @p k, `nullptr` when metrics are off.
+    [[nodiscard]] booking::telemetry::Histogram* latency(RpcKind k) const noexcept
+    {
+        return latency_[static_cast<std::size_t>(k)];
+    }
+
+    std::shared_ptr<booking::telemetry::Registry>       metrics_;
+    std::array<booking::telemetry::Histogram*, kKinds>  latency_{};
+    booking::telemetry::Counter*                        booked_    = nullptr;
+    booking::telemetry::Counter*                        conflicts_ = nullptr;
+    booking::telemetry::Counter*                        refused_   = nullptr;   ///< seating rules
+    booking::telemetry::Counter*                        replays_   = nullptr;   ///< idempotent retries
 };
 
 #endif //BOOKING_SERVER_IMPL_HPP
\ No newline at end of file
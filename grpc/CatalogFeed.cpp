@@ -0,0 +1,38 @@
+// grpc/CatalogFeed.cpp
+#include "CatalogFeed.hpp"
+#include <algorithm>
+
+void CatalogFeed::bump()
+{
+    const std::lock_guard lock{mtx_};
+    const auto v = version_.fetch_add(1, std::memory_order_acq_rel) + 1;
+    for (Watcher* w : watchers_) w->onVersion(v);
+}
+
+bool CatalogFeed::subscribe(Watcher* w)
+{
+    const std::lock_guard lock{mtx_};
+    if (closed_) return false;
+    watchers_.push_back(w);
+    w->onVersion(version_.load(std::memory_order_acquire));
+    return true;
+}
+
+void CatalogFeed::unsubscribe(Watcher* w)
+{
+    const std::lock_guard lock{mtx_};
+    watchers_.erase(std::remove(watchers_.begin(), watchers_.end(), w), watchers_.end());
+}
+
+void CatalogFeed::close()
+{
+    const std::lock_guard lock{mtx_};
+    closed_ = true;
+    for (Watcher* w : watchers_) w->onClose();
+}
+
+std::size_t CatalogFeed::watchers() const
+{
+    const std::lock_guard lock{mtx_};
+    return watchers_.size();
+}
@@ -0,0 +1,78 @@
+#ifndef CATALOG_FEED_HPP
+#define CATALOG_FEED_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+/**
+ * @file CatalogFeed.hpp
+ * @brief Catalog version counter plus the list of `WatchCatalog` streams
+ *        that are told when it moves.
+ *
+ * Every successful catalog mutation (`AddMovie`, `AddScreening`,
+ * `RetireScreening`) calls @ref CatalogFeed::bump *after* the repository has
+ * applied it.  `ListMovies` / `ListTheaters` read the version *before* they
+ * read the catalog and stamp it on the reply, so a cached reply is never
+ * newer than its tag - at worst a client refetches once too often.
+ *
+ * ```text
+ *   admin:  apply ── bump ─▶ v+1 ──▶ every Watcher::onVersion(v+1)
+ *   reads:  v = version() ── read catalog ── reply{..., catalog_version = v}
+ * ```
+ *
+ * Watchers are callback-API stream reactors, so an idle subscriber costs a
+ * registration here and no server thread.
+ */
+class CatalogFeed
+{
+public:
+    /// Receiver of version changes (one per open `WatchCatalog` stream).
+    class Watcher
+    {
+    public:
+        virtual ~Watcher() = default;
+
+        /// Called with the feed lock held - must not call back into the feed.
+        virtual void onVersion(std::uint64_t v) = 0;
+
+        /// Feed is shutting down; end the stream.
+        virtual void onClose() = 0;
+    };
+
+    CatalogFeed() = default;
+    CatalogFeed(const CatalogFeed&)            = delete;
+    CatalogFeed& operator=(const CatalogFeed&) = delete;
+
+    /// Current catalog version; starts at 1 (0 on the wire == "no feed").
+    [[nodiscard]] std::uint64_t version() const noexcept
+    {
+        return version_.load(std::memory_order_acquire);
+    }
+
+    /// Advance the version and notify every watcher.
+    void bump();
+
+    /// Register @p w and hand it the current version; returns `false` once
+    /// the feed is closed.
+    bool subscribe(Watcher* w);
+
+    /// Deregister @p w; no callback is running for it when this returns.
+    void unsubscribe(Watcher* w);
+
+    /// End every open stream and refuse new ones (call before
+    /// `grpc::Server::Shutdown`, which waits for open streams).
+    void close();
+
+    /// Number of open watch streams.
+    [[nodiscard]] std::size_t watchers() const;
+
+private:
+    std::atomic<std::uint64_t> version_{1};
+    mutable std::mutex         mtx_;
+    std::vector<Watcher*>      watchers_;
+    bool                       closed_ = false;
+};
+
+#endif //CATALOG_FEED_HPP
@@ -0,0 +1,120 @@
+// grpc/DedupTable.cpp
+#include "DedupTable.hpp"
+#include <algorithm>
+#include <functional>
+
+// ────────────────────────────────────────────────────────────────────────────
+// ctor
+// ────────────────────────────────────────────────────────────────────────────
+DedupTable::DedupTable() : DedupTable{Config{}} {}
+
+DedupTable::DedupTable(Config cfg)
+    : cfg_{cfg},
+      perShard_{std::max<std::size_t>(1, (cfg.capacity + kShards - 1) / kShards)}
+{
+    for (auto& s : shards_) {
+        s.slots.resize(perShard_);
+        s.index.reserve(perShard_);
+    }
+}
+
+std::uint64_t DedupTable::hashOf(std::string_view key) noexcept
+{
+    return std::hash<std::string_view>{}(key);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// CLOCK sweep - first free / expired slot, or one not replayed since the
+// hand last passed; pending slots are never taken
+// ────────────────────────────────────────────────────────────────────────────
+DedupTable::Slot* DedupTable::victim(Shard& s, Clock::time_point now)
+{
+    for (std::size_t step = 0; step < 2 * s.slots.size(); ++step) {
+        Slot& slot = s.slots[s.hand];
+        s.hand = (s.hand + 1) % s.slots.size();
+
+        if (slot.state == State::Pending) continue;
+        if (slot.state == State::Done) {
+            if (slot.referenced && slot.expires > now) {
+                slot.referenced = false;               // second chance
+                continue;
+            }
+            s.index.erase(slot.key);
+        }
+        slot = Slot{};
+        return &slot;
+    }
+    return nullptr;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// claim / complete / abandon
+// ────────────────────────────────────────────────────────────────────────────
+DedupTable::Lookup DedupTable::claim(std::string_view key, std::uint64_t fingerprint)
+{
+    const auto h   = hashOf(key);
+    const auto now = Clock::now();
+    Shard& s = shardOf(h);
+    const std::scoped_lock lk{s.mtx};
+
+    if (const auto it = s.index.find(h); it != s.index.end()) {
+        Slot& slot = s.slots[it->second];
+        if (slot.state == State::Pending)
+            return {slot.fingerprint == fingerprint ? Claim::InFlight : Claim::Mismatch, {}};
+        if (slot.expires > now) {
+            if (slot.fingerprint != fingerprint) return {Claim::Mismatch, {}};
+            slot.referenced = true;
+            return {Claim::Replay, slot.outcome};
+        }
+        slot = Slot{};                                 // expired - reuse in place
+        slot.key         = h;
+        slot.fingerprint = fingerprint;
+        slot.state       = State::Pending;
+        return {Claim::Fresh, {}};
+    }
+
+    Slot* slot = victim(s, now);
+    if (!slot) return {Claim::Untracked, {}};
+    slot->key         = h;
+    slot->fingerprint = fingerprint;
+    slot->state       = State::Pending;
+    s.index.emplace(h, static_cast<std::uint32_t>(slot - s.slots.data()));
+    return {Claim::Fresh, {}};
+}
+
+void DedupTable::complete(std::string_view key, Outcome outcome)
+{
+    const auto h = hashOf(key);
+    Shard& s = shardOf(h);
+    const std::scoped_lock lk{s.mtx};
+
+    const auto it = s.index.find(h);
+    if (it == s.index.end()) return;
+    Slot& slot = s.slots[it->second];
+    if (slot.state != State::Pending) return;
+    slot.outcome = outcome;
+    slot.expires = Clock::now() + cfg_.ttl;
+    slot.state   = State::Done;
+}
+
+void DedupTable::abandon(std::string_view key)
+{
+    const auto h = hashOf(key);
+    Shard& s = shardOf(h);
+    const std::scoped_lock lk{s.mtx};
+
+    const auto it = s.index.find(h);
+    if (it == s.index.end() || s.slots[it->second].state != State::Pending) return;
+    s.slots[it->second] = Slot{};
+    s.index.erase(it);
+}
+
+std::size_t DedupTable::size() const
+{
+    std::size_t n = 0;
+    for (const auto& s : shards_) {
+        const std::scoped_lock lk{s.mtx};
+        n += s.index.size();
+    }
+    return n;
+}
@@ -0,0 +1,127 @@
+#ifndef DEDUP_TABLE_HPP
+#define DEDUP_TABLE_HPP
+
+#include "booking/domain/Theater.hpp"
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file DedupTable.hpp
+ * @brief Outcomes of recent `BookSeats` calls by client idempotency key, so
+ *        a retried request gets the original answer instead of
+ *        `ALREADY_EXISTS` for the seats it just bought.
+ *
+ * The table is split into shards by key hash; each shard is a fixed ring of
+ * slots plus a key -> slot map, both sized once at construction, so memory
+ * never grows past `Config::capacity` entries.  When a shard is full the
+ * slot for a new key is picked CLOCK-style: the hand sweeps the ring,
+ * giving recently replayed entries a second chance, and takes the first
+ * slot that is expired or was not replayed since the last sweep.
+ *
+ * ```text
+ *   claim(key) ── miss ──▶ Fresh    (slot pending)  ── book ──▶ complete()
+ *              ── done ──▶ Replay   (cached outcome, no hall lock)
+ *              ── pending ▶ InFlight (original still booking)
+ * ```
+ *
+ * A key is only remembered together with a fingerprint of the request; the
+ * same key on a different request is reported as `Mismatch`.  Keys are
+ * stored as 64-bit hashes.
+ */
+class DedupTable
+{
+public:
+    /// Sizing; memory is about 80 bytes per entry.
+    struct Config
+    {
+        std::size_t          capacity = 65536;   ///< entries, all shards together
+        std::chrono::seconds ttl{600};           ///< how long an outcome is replayed
+    };
+
+    /// What the original call returned.
+    struct Outcome
+    {
+        booking::domain::BookStatus status     = booking::domain::BookStatus::Booked;
+        std::uint64_t               totalCents = 0;
+    };
+
+    enum class Claim : std::uint8_t
+    {
+        Fresh,      ///< first time - book, then complete() or abandon()
+        Replay,     ///< answer with `outcome`
+        InFlight,   ///< the original call has not finished yet
+        Mismatch,   ///< key reused for a different request
+        Untracked,  ///< every slot of the shard is in flight - book without dedup
+    };
+
+    struct Lookup
+    {
+        Claim   claim = Claim::Fresh;
+        Outcome outcome;
+    };
+
+    DedupTable();
+    explicit DedupTable(Config cfg);
+
+    DedupTable(const DedupTable&)            = delete;
+    DedupTable& operator=(const DedupTable&) = delete;
+
+    /**
+     * @brief Look @p key up and, on a miss, reserve a pending slot for it.
+     * @param fingerprint Hash of the request the key was sent with.
+     */
+    [[nodiscard]] Lookup claim(std::string_view key, std::uint64_t fingerprint);
+
+    /// Record the outcome of a call that claimed @p key as `Fresh`.
+    void complete(std::string_view key, Outcome outcome);
+
+    /// Forget a `Fresh` claim whose call ended before booking, or with an
+    /// outcome the client should retry.
+    void abandon(std::string_view key);
+
+    /// Entries currently held (pending included).
+    [[nodiscard]] std::size_t size() const;
+
+    /// Slots across all shards.
+    [[nodiscard]] std::size_t capacity() const noexcept { return perShard_ * kShards; }
+
+private:
+    static constexpr std::size_t kShards = 16;
+    using Clock = std::chrono::steady_clock;
+
+    enum class State : std::uint8_t { Free, Pending, Done };
+
+    struct Slot
+    {
+        std::uint64_t     key         = 0;
+        std::uint64_t     fingerprint = 0;
+        Clock::time_point expires{};
+        Outcome           outcome;
+        State             state       = State::Free;
+        bool              referenced  = false;   ///< CLOCK second-chance bit
+    };
+
+    struct alignas(64) Shard
+    {
+        mutable std::mutex                           mtx;
+        std::vector<Slot>                            slots;
+        std::unordered_map<std::uint64_t, std::uint32_t> index;   ///< key -> slot
+        std::size_t                                  hand = 0;
+    };
+
+    [[nodiscard]] Shard& shardOf(std::uint64_t key) noexcept { return shards_[key % kShards]; }
+    [[nodiscard]] static std::uint64_t hashOf(std::string_view key) noexcept;
+    [[nodiscard]] Slot* victim(Shard& s, Clock::time_point now);   // nullptr if all pending
+
+    Config                        cfg_;
+    std::size_t                   perShard_;
+    std::array<Shard, kShards>    shards_;
+};
+
+#endif //DEDUP_TABLE_HPP
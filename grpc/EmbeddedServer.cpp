@@ -0,0 +1,80 @@
+// grpc/EmbeddedServer.cpp
+#include "EmbeddedServer.hpp"
+#include "transport/ChannelFactory.hpp"
+#include "booking/service/IBookingRepository.hpp"
+
+#include <grpcpp/server_builder.h>
+#include <stdexcept>
+
+#ifndef _WIN32
+#include <filesystem>
+#endif
+
+/* factory declared in InMemoryRepository.cpp */
+namespace booking::service {
+std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+EmbeddedServer::EmbeddedServer(std::shared_ptr<booking::service::BookingManager> mgr,
+                               EmbeddedOptions opts)
+    : mgr_(std::move(mgr))
+{
+    if (!opts.service.catalog)
+        opts.service.catalog = std::make_shared<CatalogFeed>();
+    catalog_ = opts.service.catalog;
+
+    const auto metrics = opts.service.metrics;
+    const auto capture = opts.service.capture;
+    svc_ = std::make_unique<BookingServiceImpl>(mgr_, std::move(opts.service));
+    if (opts.admin)
+        admin_ = std::make_unique<BookingAdminImpl>(mgr_, metrics, catalog_, capture);
+
+    grpc::ServerBuilder builder;
+    if (!opts.tcp.empty())
+        builder.AddListeningPort(opts.tcp, grpc::InsecureServerCredentials(), &port_);
+#ifndef _WIN32
+    if (!opts.ipc.empty()) {
+        std::filesystem::remove(opts.ipc);
+        builder.AddListeningPort("unix:" + opts.ipc, grpc::InsecureServerCredentials());
+    }
+#endif
+    builder.RegisterService(svc_.get());
+
+    server_ = builder.BuildAndStart();
+    if (!server_)
+        throw std::runtime_error("failed to start embedded booking server");
+
+    if (admin_) {                      // operator RPCs never reach the sockets
+        grpc::ServerBuilder adminBuilder;
+        adminBuilder.RegisterService(admin_.get());
+        adminServer_ = adminBuilder.BuildAndStart();
+        if (!adminServer_)
+            throw std::runtime_error("failed to start embedded admin server");
+    }
+}
+
+EmbeddedServer::EmbeddedServer(EmbeddedOptions opts)
+    : EmbeddedServer(std::make_shared<booking::service::BookingManager>(
+                         booking::service::makeInMemoryRepository()),
+                     std::move(opts))
+{
+}
+
+EmbeddedServer::~EmbeddedServer()
+{
+    catalog_->close();                 // Shutdown() waits for open streams
+    if (adminServer_) adminServer_->Shutdown();
+    server_->Shutdown();
+}
+
+std::shared_ptr<grpc::Channel>
+EmbeddedServer::channel(const grpc::ChannelArguments& args) const
+{
+    return transport::makeInProcessChannel(*server_, args);
+}
+
+std::shared_ptr<grpc::Channel>
+EmbeddedServer::adminChannel(const grpc::ChannelArguments& args) const
+{
+    return adminServer_ ? transport::makeInProcessChannel(*adminServer_, args) : nullptr;
+}
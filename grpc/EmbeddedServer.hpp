@@ -0,0 +1,87 @@
+#ifndef EMBEDDED_SERVER_HPP
+#define EMBEDDED_SERVER_HPP
+
+#include "BookingAdminImpl.hpp"
+#include "BookingServiceImpl.hpp"
+#include "booking/service/BookingManager.hpp"
+#include <grpcpp/grpcpp.h>
+#include <memory>
+#include <string>
+
+/**
+ * @file EmbeddedServer.hpp
+ * @brief Run the booking services inside a host process and talk to them
+ *        over gRPC's in-process transport.
+ *
+ * The same @ref BookingServiceImpl / @ref BookingAdminImpl pair that
+ * `booking_server` exposes, owned by one object.  Calls made through
+ * @ref EmbeddedServer::channel skip sockets, HTTP/2 framing and syscalls
+ * but keep the full service behaviour (admission control, waiting room,
+ * metrics, deadlines), so code written against a generated Stub works
+ * unchanged whether the service is remote or embedded.
+ *
+ * ```cpp
+ * EmbeddedServer booking;                              // in-memory catalog
+ * auto stub = booking::Booking::NewStub(booking.channel());
+ * ```
+ *
+ * TCP / UDS listeners can be added for the process's other clients; all
+ * transports then share one manager.  They carry *booking.Booking* only:
+ * *booking.BookingAdmin* (catalog changes included) runs on a second,
+ * in-process-only server reached through @ref EmbeddedServer::adminChannel.
+ */
+/**
+ * @brief Service policies plus optional socket listeners for an
+ *        @ref EmbeddedServer.  Default-constructed == in-process only.
+ */
+struct EmbeddedOptions
+{
+    ServiceOptions service;       ///< admission / waiting room / metrics
+    bool           admin = true;  ///< also host *booking.BookingAdmin* (in-process only)
+    std::string    tcp;           ///< "host:port" ("…:0" = any), empty = none
+    std::string    ipc;           ///< Unix-domain socket path, empty = none
+};
+
+class EmbeddedServer
+{
+public:
+    /// Serve @p mgr; a @ref CatalogFeed is created when none is supplied.
+    explicit EmbeddedServer(std::shared_ptr<booking::service::BookingManager> mgr,
+                            EmbeddedOptions opts = {});
+
+    /// Serve a fresh in-memory repository.
+    explicit EmbeddedServer(EmbeddedOptions opts = {});
+
+    /// Ends catalog watch streams, then shuts the server down.
+    ~EmbeddedServer();
+
+    EmbeddedServer(const EmbeddedServer&)            = delete;
+    EmbeddedServer& operator=(const EmbeddedServer&) = delete;
+
+    /// New in-process channel (see transport::makeInProcessChannel).
+    [[nodiscard]] std::shared_ptr<grpc::Channel>
+        channel(const grpc::ChannelArguments& args = {}) const;
+
+    /// In-process channel to *booking.BookingAdmin*; `nullptr` when
+    /// EmbeddedOptions::admin is off.
+    [[nodiscard]] std::shared_ptr<grpc::Channel>
+        adminChannel(const grpc::ChannelArguments& args = {}) const;
+
+    /// Port bound for EmbeddedOptions::tcp (0 when there is no TCP listener).
+    [[nodiscard]] int tcpPort() const noexcept { return port_; }
+
+    [[nodiscard]] grpc::Server& server() const noexcept { return *server_; }
+    [[nodiscard]] const std::shared_ptr<booking::service::BookingManager>&
+        manager() const noexcept { return mgr_; }
+
+private:
+    std::shared_ptr<booking::service::BookingManager> mgr_;
+    std::shared_ptr<CatalogFeed>                      catalog_;
+    std::unique_ptr<BookingServiceImpl>               svc_;
+    std::unique_ptr<BookingAdminImpl>                 admin_;
+    std::unique_ptr<grpc::Server>                     server_;
+    std::unique_ptr<grpc::Server>                     adminServer_;   ///< no listeners
+    int                                               port_ = 0;
+};
+
+#endif //EMBEDDED_SERVER_HPP
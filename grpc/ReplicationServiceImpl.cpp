@@ -0,0 +1,109 @@
+// grpc/ReplicationServiceImpl.cpp
+#include "ReplicationServiceImpl.hpp"
+#include <chrono>
+#include <vector>
+
+using booking::service::LogRecord;
+
+namespace {
+constexpr std::size_t               kBatch = 256;                      ///< records per read()
+constexpr std::chrono::milliseconds kPoll{200};                        ///< cancel / close check
+
+void toEntry(const LogRecord& r, std::uint64_t epoch, bool snapshot, booking::LogEntry* e)
+{
+    e->Clear();
+    e->set_seq(r.seq);
+    e->set_epoch(epoch);
+    e->set_snapshot(snapshot);
+    e->set_movie_id(r.movie);
+    e->set_theater_id(r.theater);
+    switch (r.kind) {
+        case LogRecord::Kind::Book:
+            e->set_kind(booking::LogEntry::BOOK);
+            e->set_seats(r.seats);
+            break;
+        case LogRecord::Kind::AddMovie:
+            e->set_kind(booking::LogEntry::ADD_MOVIE);
+            e->set_title(r.title);
+            e->set_description(r.desc);
+            break;
+        case LogRecord::Kind::AddScreening:
+            e->set_kind(booking::LogEntry::ADD_SCREENING);
+            e->set_name(r.name);
+            break;
+        case LogRecord::Kind::RetireScreening:
+            e->set_kind(booking::LogEntry::RETIRE_SCREENING);
+            break;
+    }
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// Follow - snapshot if the standby cannot catch up from the log, then tail
+// ────────────────────────────────────────────────────────────────────────────
+grpc::Status ReplicationServiceImpl::Follow(
+        grpc::ServerContext* ctx,
+        const booking::FollowReq* in,
+        grpc::ServerWriter<booking::LogEntry>* out)
+{
+    auto& log = *repo_->log();
+    if (log.closed())
+        return grpc::Status(grpc::StatusCode::UNAVAILABLE, "server shutting down");
+
+    log.attach();
+    struct Detach
+    {
+        booking::service::ReplicationLog& log;
+        ~Detach() { log.detach(); }
+    } detach{log};
+
+    const std::uint64_t epoch = log.epoch();
+    std::uint64_t after = in->after();
+    std::vector<LogRecord> batch;
+    booking::LogEntry entry;
+
+    // the log still has everything after `after`?  (read() with no wait)
+    bool resync = in->epoch() != epoch || after > log.last()
+                  || !log.read(after, batch, 1, std::chrono::milliseconds{0});
+    for (;;) {
+        if (resync) {
+            batch.clear();
+            after = repo_->snapshot(batch);
+            for (const auto& r : batch) {
+                toEntry(r, epoch, true, &entry);
+                if (!out->Write(entry)) return grpc::Status::OK;
+            }
+            entry.Clear();
+            entry.set_seq(after);
+            entry.set_epoch(epoch);
+            entry.set_kind(booking::LogEntry::SNAPSHOT_END);
+            entry.set_snapshot(true);
+            if (!out->Write(entry)) return grpc::Status::OK;
+            resync = false;
+        }
+
+        batch.clear();
+        if (!log.read(after, batch, kBatch, kPoll)) {    // fell behind the log
+            resync = true;
+            continue;
+        }
+        for (const auto& r : batch) {
+            toEntry(r, epoch, false, &entry);
+            if (!out->Write(entry)) return grpc::Status::OK;
+            after = r.seq;
+        }
+        if (ctx->IsCancelled() || log.closed()) return grpc::Status::OK;
+    }
+}
+
+grpc::Status ReplicationServiceImpl::Ack(
+        grpc::ServerContext*,
+        const booking::AckReq* in,
+        booking::Empty*)
+{
+    auto& log = *repo_->log();
+    if (in->epoch() != log.epoch())
+        return grpc::Status(grpc::StatusCode::FAILED_PRECONDITION, "acknowledging another log");
+    log.ack(in->seq());
+    return grpc::Status::OK;
+}
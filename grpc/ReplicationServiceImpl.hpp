@@ -0,0 +1,54 @@
+#ifndef REPLICATION_SERVICE_IMPL_HPP
+#define REPLICATION_SERVICE_IMPL_HPP
+
+#include "booking/service/ReplicatingRepository.hpp"
+#include "booking.grpc.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <memory>
+
+/**
+ * @file ReplicationServiceImpl.hpp
+ * @brief Primary side of log shipping (*booking.Replication*): standbys
+ *        stream the primary's write log and acknowledge what they applied.
+ *
+ * ```text
+ *   standby ── Follow{epoch, after} ──▶ snapshot (if needed) ── SNAPSHOT_END
+ *                                      ── log records after `after` … (open)
+ *   standby ── Ack{seq} ─────────────▶ ReplicationLog::ack → waitAcked() returns
+ * ```
+ *
+ * A snapshot is sent when the standby has followed another log (epoch
+ * mismatch - the primary restarted) or is behind the retained records.
+ * Follow is a plain synchronous stream: one server thread per attached
+ * standby.  It ends when the standby cancels or the log is closed
+ * (shutdown - call ReplicationLog::close() before `Server::Shutdown`).
+ */
+class ReplicationServiceImpl final : public booking::Replication::Service
+{
+public:
+    explicit ReplicationServiceImpl(std::shared_ptr<booking::service::ReplicatingRepository> repo)
+        : repo_(std::move(repo)) {}
+
+    /**
+     * @brief Stream the log to one standby.
+     * @param ctx   Cancelled when the standby goes away.
+     * @param in    Log epoch and last sequence number the standby applied.
+     * @param out   Snapshot records (`snapshot = true`) closed by
+     *              `SNAPSHOT_END`, then every new record in order.
+     */
+    grpc::Status Follow(
+        grpc::ServerContext*                   ctx,
+        const booking::FollowReq*              in,
+        grpc::ServerWriter<booking::LogEntry>* out) override;
+
+    /// Standby applied everything up to `seq` of log `epoch`.
+    grpc::Status Ack(
+        grpc::ServerContext*                   ctx,
+        const booking::AckReq*                 in,
+        booking::Empty*                        out) override;
+
+private:
+    std::shared_ptr<booking::service::ReplicatingRepository> repo_;
+};
+
+#endif //REPLICATION_SERVICE_IMPL_HPP
@@ -0,0 +1,252 @@
+// grpc/ShmServer.cpp
+#include "ShmServer.hpp"
+
+#ifdef __linux__
+#include "booking/domain/Seat.hpp"
+#include "booking/domain/Theater.hpp"
+
+#include <poll.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+using booking::domain::Seat;
+using booking::domain::Theater;
+namespace shm = transport::shm;
+
+namespace {
+constexpr std::uint32_t kSeatMask = (1u << Theater::kCapacity) - 1;
+constexpr std::int64_t  kIdleNs   = 100'000'000;   // re-check stop / hang-up
+
+/// Reply status of a booking outcome - the shm twin of bookingReply().
+shm::Status toStatus(booking::domain::BookStatus st) noexcept
+{
+    using booking::domain::BookStatus;
+    switch (st) {
+        case BookStatus::Booked:       return shm::Status::Ok;
+        case BookStatus::Taken:        return shm::Status::Conflict;
+        case BookStatus::Invalid:      return shm::Status::Invalid;
+        case BookStatus::NotFound:     return shm::Status::NotFound;
+        case BookStatus::ReadOnly:
+        case BookStatus::Unreplicated: return shm::Status::Unavailable;
+        default:                       return shm::Status::Refused;   // seating rule
+    }
+}
+
+/// Receive the client's memfd; -1 on any protocol error.
+int receiveFd(int sock)
+{
+    char byte = 0;
+    iovec iov{&byte, 1};
+    alignas(cmsghdr) char ctrl[CMSG_SPACE(sizeof(int))]{};
+    msghdr msg{};
+    msg.msg_iov        = &iov;
+    msg.msg_iovlen     = 1;
+    msg.msg_control    = ctrl;
+    msg.msg_controllen = sizeof(ctrl);
+    if (::recvmsg(sock, &msg, MSG_CMSG_CLOEXEC) != 1) return -1;
+
+    const cmsghdr* c = CMSG_FIRSTHDR(&msg);
+    if (!c || c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_RIGHTS) return -1;
+    int fd = -1;
+    std::memcpy(&fd, CMSG_DATA(c), sizeof(int));
+    return fd;
+}
+
+/// `true` once the peer has closed its end of the rendezvous socket.
+bool hungUp(int sock)
+{
+    pollfd p{sock, POLLIN, 0};
+    if (::poll(&p, 1, 0) <= 0) return false;
+    char byte;
+    return (p.revents & (POLLHUP | POLLERR)) || ::recv(sock, &byte, 1, MSG_DONTWAIT) == 0;
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// ctor / dtor
+// ────────────────────────────────────────────────────────────────────────────
+ShmServer::ShmServer(std::shared_ptr<booking::service::BookingManager> mgr,
+                     Config cfg, std::shared_ptr<WaitingRoom> room)
+    : mgr_(std::move(mgr)), cfg_(std::move(cfg)), room_(std::move(room))
+{
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    if (cfg_.path.size() >= sizeof(addr.sun_path))
+        throw std::runtime_error("shm: socket path too long: " + cfg_.path);
+    std::memcpy(addr.sun_path, cfg_.path.c_str(), cfg_.path.size() + 1);
+
+    std::filesystem::remove(cfg_.path);
+    listen_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_ < 0
+        || ::bind(listen_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0
+        || ::listen(listen_, 16) != 0) {
+        const std::string err = std::strerror(errno);
+        if (listen_ >= 0) ::close(listen_);
+        throw std::runtime_error("shm: cannot listen on " + cfg_.path + ": " + err);
+    }
+    acceptor_ = std::thread{[this] { acceptLoop(); }};
+}
+
+ShmServer::~ShmServer()
+{
+    stop_ = true;
+    ::shutdown(listen_, SHUT_RDWR);                    // unblocks accept()
+    acceptor_.join();
+    ::close(listen_);
+    reap(true);
+    std::filesystem::remove(cfg_.path);
+}
+
+std::size_t ShmServer::connections() const
+{
+    const std::lock_guard lock{mtx_};
+    std::size_t n = 0;
+    for (const Conn& c : conns_) n += !c.done;
+    return n;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Connection handling
+// ────────────────────────────────────────────────────────────────────────────
+void ShmServer::acceptLoop()
+{
+    while (!stop_) {
+        const int sock = ::accept4(listen_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (sock < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) continue;
+            return;                                    // listener shut down
+        }
+        reap(false);
+
+        // the segment comes from the client: check it before trusting it
+        const int fd = receiveFd(sock);
+        struct stat st{};
+        void* mem = MAP_FAILED;
+        if (fd >= 0 && ::fstat(fd, &st) == 0
+            && static_cast<std::size_t>(st.st_size) >= sizeof(shm::Segment))
+            mem = ::mmap(nullptr, sizeof(shm::Segment), PROT_READ | PROT_WRITE,
+                         MAP_SHARED, fd, 0);
+        if (fd >= 0) ::close(fd);                      // the mapping keeps it alive
+
+        auto* seg = static_cast<shm::Segment*>(mem);
+        const char ok = mem != MAP_FAILED && seg->magic == shm::kMagic
+                        && seg->version == shm::kVersion;
+        if (!ok) {
+            if (mem != MAP_FAILED) ::munmap(mem, sizeof(shm::Segment));
+            const char no = 0;
+            (void)::send(sock, &no, 1, MSG_NOSIGNAL);
+            ::close(sock);
+            continue;
+        }
+
+        const std::lock_guard lock{mtx_};
+        Conn& c  = conns_.emplace_back();
+        c.sock   = sock;
+        c.seg    = seg;
+        c.worker = std::thread{[this, &c] { serve(c); }};
+        (void)::send(sock, &ok, 1, MSG_NOSIGNAL);
+    }
+}
+
+void ShmServer::serve(Conn& c)
+{
+    shm::Segment& seg = *c.seg;
+    shm::Frame    req;
+    while (!stop_ && !seg.closed.load(std::memory_order_acquire)) {
+        if (!seg.requests.popWait(req, cfg_.spins, kIdleNs)) {
+            if (hungUp(c.sock)) break;                 // client died without closing
+            continue;
+        }
+        const shm::Frame rep = handle(req);
+        while (!seg.replies.push(rep))                 // client is not draining
+            if (stop_ || seg.closed.load(std::memory_order_acquire)) break;
+    }
+    seg.closed.store(1, std::memory_order_release);
+    seg.replies.sleeping.store(0);
+    shm::futexWake(seg.replies.sleeping);
+    c.done = true;
+}
+
+void ShmServer::reap(bool all)
+{
+    std::list<Conn> finished;
+    {
+        const std::lock_guard lock{mtx_};
+        for (auto it = conns_.begin(); it != conns_.end();) {
+            auto next = std::next(it);
+            if (all || it->done) finished.splice(finished.end(), conns_, it);
+            it = next;
+        }
+    }
+    for (Conn& c : finished) {
+        c.seg->closed.store(1, std::memory_order_release);
+        c.seg->requests.sleeping.store(0);
+        shm::futexWake(c.seg->requests.sleeping);
+        c.worker.join();
+        ::munmap(c.seg, sizeof(shm::Segment));
+        ::close(c.sock);
+    }
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Request dispatch - same rules as BookingServiceImpl
+// ────────────────────────────────────────────────────────────────────────────
+shm::Frame ShmServer::handle(const shm::Frame& req) const
+{
+    shm::Frame rep = req;
+    rep.status = shm::Status::Ok;
+
+    switch (req.op) {
+        case shm::Op::Ping:
+            break;
+
+        case shm::Op::FreeSeats: {
+            std::uint32_t mask = 0;
+            try {
+                for (const Seat& s : mgr_->freeSeats(req.movie, req.theater))
+                    mask |= 1u << s.index;
+            } catch (const std::out_of_range&) {       // unknown movie / hall
+            }
+            rep.seats = mask;
+            if (!mask) rep.status = shm::Status::NotFound;
+            break;
+        }
+
+        case shm::Op::Book: {
+            if (!req.seats || (req.seats & ~kSeatMask)) {
+                rep.status = shm::Status::Invalid;
+                break;
+            }
+            if (room_ && !room_->admitted(req.movie, req.token)) {
+                rep.status = shm::Status::Denied;
+                break;
+            }
+            if (room_ && !room_->admit(req.movie, req.token)) {
+                rep.status = shm::Status::Denied;
+                break;
+            }
+            std::vector<Seat> seats;
+            for (std::uint8_t i = 0; i < Theater::kCapacity; ++i)
+                if (req.seats & (1u << i)) seats.push_back(Seat::fromIndex(i));
+            const auto r = mgr_->reserve(req.movie, req.theater, seats,
+                                         (req.flags & shm::kAccessible) != 0);
+            if (room_) room_->recordBooking(req.movie);
+            rep.status = toStatus(r.status);
+            break;
+        }
+
+        default:
+            rep.status = shm::Status::Invalid;
+    }
+    return rep;
+}
+#endif // __linux__
@@ -0,0 +1,87 @@
+#ifndef SHM_SERVER_HPP
+#define SHM_SERVER_HPP
+
+#include "WaitingRoom.hpp"
+#include "booking/service/BookingManager.hpp"
+#include "transport/ShmRing.hpp"
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @file ShmServer.hpp
+ * @brief Native shared-memory transport for clients on the same host -
+ *        `FreeSeats` / `Book` without HTTP/2, protobuf or (while both sides
+ *        are busy) syscalls.  Linux only.
+ *
+ * ```text
+ *   client                         rendezvous UDS              ShmServer
+ *   memfd + Segment ── SCM_RIGHTS ─────────────────────▶ mmap, check, ack
+ *   requests ring  ══ Frame ══════════════════════════▶ serving thread ─▶ BookingManager
+ *   replies ring   ◀═ Frame ══════════════════════════
+ * ```
+ *
+ * Each connection gets its own segment (two SPSC rings, see ShmRing.hpp)
+ * and one serving thread that spins briefly on an empty ring, then sleeps
+ * on its futex.  Requests are served by the same @ref
+ * booking::service::BookingManager as the gRPC service, and bookings of
+ * gated movies still need an admitted @ref WaitingRoom token.  Admission
+ * control and metrics are gRPC-only: this path is meant for a handful of
+ * trusted co-located box-office processes.
+ */
+#ifdef __linux__
+class ShmServer
+{
+public:
+    struct Config
+    {
+        std::string path  = transport::shm::kDefaultPath;  ///< rendezvous socket
+        unsigned    spins = 2000;   ///< empty-ring polls before sleeping
+    };
+
+    /// Bind the rendezvous socket and start accepting; throws on failure.
+    ShmServer(std::shared_ptr<booking::service::BookingManager> mgr,
+              Config                                            cfg,
+              std::shared_ptr<WaitingRoom>                      room = nullptr);
+
+    /// Closes every connection and removes the socket.
+    ~ShmServer();
+
+    ShmServer(const ShmServer&)            = delete;
+    ShmServer& operator=(const ShmServer&) = delete;
+
+    /// Open client connections.
+    [[nodiscard]] std::size_t connections() const;
+
+    /// Apply one request frame (exposed for tests / benchmarks).
+    [[nodiscard]] transport::shm::Frame handle(const transport::shm::Frame& req) const;
+
+private:
+    struct Conn
+    {
+        int                       sock = -1;
+        transport::shm::Segment*  seg  = nullptr;
+        std::thread               worker;
+        std::atomic<bool>         done{false};
+    };
+
+    void acceptLoop();
+    void serve(Conn& c);
+    void reap(bool all);
+
+    std::shared_ptr<booking::service::BookingManager> mgr_;
+    Config                                            cfg_;
+    std::shared_ptr<WaitingRoom>                      room_;
+
+    int                 listen_ = -1;
+    std::atomic<bool>   stop_{false};
+    mutable std::mutex  mtx_;
+    std::list<Conn>     conns_;          ///< stable addresses for workers
+    std::thread         acceptor_;
+};
+#endif // __linux__
+
+#endif //SHM_SERVER_HPP
@@ -0,0 +1,284 @@
+// grpc/Standby.cpp
+#include "Standby.hpp"
+#include <future>
+#include <set>
+#include <utility>
+
+/* factory declared in InMemoryRepository.cpp */
+namespace booking::service {
+std::shared_ptr<IBookingRepository> makeInMemoryRepository(const domain::Theater::Rules&        house,
+                                                           std::shared_ptr<domain::StringArena> text);
+}
+
+using booking::domain::BookStatus;
+using booking::domain::Movie;
+using booking::domain::Seat;
+using booking::domain::Theater;
+using booking::service::CatalogStatus;
+using booking::service::IBookingRepository;
+using booking::service::MovieSales;
+using booking::service::Page;
+using booking::service::Reservation;
+
+namespace {
+constexpr std::chrono::seconds kAckDeadline{1};
+
+/// Replay one log record; already-applied records are harmless.
+/// @return `false` if the replica could not apply it (it has diverged).
+bool apply(IBookingRepository& repo, const booking::LogEntry& e)
+{
+    CatalogStatus st = CatalogStatus::Ok;
+    switch (e.kind()) {
+        case booking::LogEntry::BOOK:
+            st = repo.occupy(e.movie_id(), e.theater_id(), e.seats());
+            break;
+        case booking::LogEntry::ADD_MOVIE:
+            st = repo.addMovie(Movie{e.movie_id(), e.title(), e.description()});
+            break;
+        case booking::LogEntry::ADD_SCREENING:
+            st = repo.addScreening(e.movie_id(), e.theater_id(), e.name());
+            break;
+        case booking::LogEntry::RETIRE_SCREENING:
+            st = repo.retireScreening(e.movie_id(), e.theater_id());
+            break;
+        default:
+            break;
+    }
+    return st == CatalogStatus::Ok || st == CatalogStatus::AlreadyExists;
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1) Replica - the repository the standby serves from
+//    Reads go to the current state (swapped whole on resync); writes are
+//    refused until promotion.  The follower writes to the state directly.
+// ────────────────────────────────────────────────────────────────────────────
+class Standby::Replica final : public IBookingRepository
+{
+public:
+    Replica(std::shared_ptr<IBookingRepository> state, const std::atomic<bool>& promoted)
+        : state_(std::move(state)), promoted_(promoted) {}
+
+    std::shared_ptr<IBookingRepository> state() const { return std::atomic_load(&state_); }
+    void swap(std::shared_ptr<IBookingRepository> s)  { std::atomic_store(&state_, std::move(s)); }
+
+    // ── reads ───────────────────────────────────────────────────────────
+    std::vector<Movie> movies() const override { return state()->movies(); }
+    Page<Movie> moviesPage(Movie::Id after, std::size_t limit) const override
+    {
+        return state()->moviesPage(after, limit);
+    }
+    std::vector<Movie> searchMovies(std::string_view q, std::size_t limit) const override
+    {
+        return state()->searchMovies(q, limit);
+    }
+    std::vector<std::shared_ptr<const Theater>> theaters(Movie::Id id) const override
+    {
+        return state()->theaters(id);
+    }
+    std::optional<Page<std::shared_ptr<const Theater>>>
+        theatersPage(Movie::Id m, Theater::Id after, std::size_t limit) const override
+    {
+        return state()->theatersPage(m, after, limit);
+    }
+    std::vector<Seat> freeSeats(Movie::Id m, Theater::Id t) const override
+    {
+        return state()->freeSeats(m, t);
+    }
+    std::vector<Seat> freeSeatsOwned(Movie::Id m, Theater::Id t) const override
+    {
+        return state()->freeSeatsOwned(m, t);
+    }
+    std::optional<std::uint64_t> quote(Movie::Id m, Theater::Id t,
+                                       const std::vector<Seat>& s) const override
+    {
+        return state()->quote(m, t, s);
+    }
+    std::vector<MovieSales> sales(Movie::Id m) const override { return state()->sales(m); }
+
+    // ── writes ──────────────────────────────────────────────────────────
+    bool book(Movie::Id m, Theater::Id t, const std::vector<Seat>& s) override
+    {
+        return promoted_ && state()->book(m, t, s);
+    }
+    Reservation reserve(Movie::Id m, Theater::Id t, const std::vector<Seat>& s,
+                        bool accessible) override
+    {
+        return promoted_ ? state()->reserve(m, t, s, accessible) : Reservation{BookStatus::ReadOnly};
+    }
+    Reservation reserveOwned(Movie::Id m, Theater::Id t, const std::vector<Seat>& s,
+                             bool accessible) override
+    {
+        return promoted_ ? state()->reserveOwned(m, t, s, accessible)
+                         : Reservation{BookStatus::ReadOnly};
+    }
+    CatalogStatus occupy(Movie::Id m, Theater::Id t, Theater::SeatMask seats) override
+    {
+        return promoted_ ? state()->occupy(m, t, seats) : CatalogStatus::ReadOnly;
+    }
+    CatalogStatus addMovie(Movie movie) override
+    {
+        return promoted_ ? state()->addMovie(std::move(movie)) : CatalogStatus::ReadOnly;
+    }
+    CatalogStatus addScreening(Movie::Id m, Theater::Id t, std::string name) override
+    {
+        return promoted_ ? state()->addScreening(m, t, std::move(name)) : CatalogStatus::ReadOnly;
+    }
+    CatalogStatus retireScreening(Movie::Id m, Theater::Id t) override
+    {
+        return promoted_ ? state()->retireScreening(m, t) : CatalogStatus::ReadOnly;
+    }
+
+private:
+    std::shared_ptr<IBookingRepository> state_;     ///< atomic_load / atomic_store only
+    const std::atomic<bool>&            promoted_;
+};
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2) Lifetime
+// ────────────────────────────────────────────────────────────────────────────
+Standby::Standby(std::shared_ptr<grpc::Channel> primary, Config cfg)
+    : stub_(booking::Replication::NewStub(std::move(primary))), cfg_(std::move(cfg)),
+      text_(std::make_shared<booking::domain::StringArena>()),
+      replica_(std::make_shared<Replica>(booking::service::makeInMemoryRepository(cfg_.house, text_),
+                                         promoted_))
+{
+    follower_ = std::thread([this] { follow(); });
+    acker_    = std::thread([this] { acker(); });
+}
+
+Standby::~Standby() { stop(); }
+
+std::shared_ptr<IBookingRepository> Standby::repository() const { return replica_; }
+
+bool Standby::promote()
+{
+    const std::lock_guard once{promoteMtx_};             // one caller tears down
+    if (promoted_) return false;
+    stop();                                              // last record applied
+    promoted_ = true;
+    return true;
+}
+
+void Standby::stop()
+{
+    {
+        const std::lock_guard lock{mtx_};
+        stopping_ = true;
+        if (stream_) stream_->TryCancel();
+    }
+    cv_.notify_all();
+    if (follower_.joinable()) follower_.join();
+    if (acker_.joinable())    acker_.join();
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3) Follower - one Follow stream at a time, reconnecting until stopped
+// ────────────────────────────────────────────────────────────────────────────
+void Standby::follow()
+{
+    for (;;) {
+        grpc::ClientContext ctx;
+        {
+            const std::lock_guard lock{mtx_};
+            if (stopping_) return;
+            stream_ = &ctx;
+        }
+        booking::FollowReq req;
+        req.set_epoch(epoch_);
+        req.set_after(applied_);
+        auto reader = stub_->Follow(&ctx, req);
+
+        booking::LogEntry e;
+        std::shared_ptr<IBookingRepository> fresh;           // resync in progress
+        std::set<std::pair<Movie::Id, Theater::Id>> halls;   // screenings it contains
+        while (reader->Read(&e)) {
+            bool catalog = e.kind() != booking::LogEntry::BOOK;
+            bool ok      = true;
+            if (e.snapshot()) {
+                if (!fresh) {
+                    fresh = booking::service::makeInMemoryRepository(cfg_.house, text_);
+                    halls.clear();
+                }
+                if (e.kind() != booking::LogEntry::SNAPSHOT_END) {
+                    if (e.kind() == booking::LogEntry::ADD_SCREENING)
+                        halls.emplace(e.movie_id(), e.theater_id());
+                    if (apply(*fresh, e)) continue;
+                    fresh.reset();
+                    ok = false;
+                }
+                else {
+                    for (const auto& m : fresh->movies())    // seeded, gone on the primary
+                        for (const auto& hall : fresh->theaters(m.id()))
+                            if (!halls.count({m.id(), hall->id()}))
+                                fresh->retireScreening(m.id(), hall->id());
+                    replica_->swap(std::move(fresh));
+                    fresh.reset();
+                    epoch_ = e.epoch();
+                    catalog = true;
+                }
+            }
+            else if (cfg_.owners && e.kind() == booking::LogEntry::BOOK) {
+                std::promise<bool> done;                 // the owner reads the seat map unlocked
+                auto applied = done.get_future();
+                cfg_.owners->post(cfg_.owners->ownerOf(e.movie_id(), e.theater_id()),
+                                  [&] {
+                                      try {
+                                          done.set_value(apply(*replica_->state(), e));
+                                      } catch (...) {
+                                          done.set_exception(std::current_exception());
+                                      }
+                                  });
+                ok = applied.get();
+            }
+            else {
+                ok = apply(*replica_->state(), e);
+            }
+            if (!ok) {                                   // never ack it: resync instead
+                epoch_ = 0;                              // the next Follow gets a snapshot
+                ctx.TryCancel();
+                break;
+            }
+            applied_ = e.seq();
+            {
+                const std::lock_guard lock{mtx_};
+                ackEpoch_ = epoch_;
+                toAck_    = e.seq();
+            }
+            cv_.notify_all();
+            if (catalog && cfg_.onCatalog) cfg_.onCatalog();
+        }
+        reader->Finish();
+
+        std::unique_lock lock{mtx_};
+        stream_ = nullptr;
+        cv_.wait_for(lock, cfg_.retry, [&] { return stopping_; });
+    }
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4) Acker - reports the newest applied record; acks queued while one is in
+//    flight collapse into the next
+// ────────────────────────────────────────────────────────────────────────────
+void Standby::acker()
+{
+    std::uint64_t sentEpoch = 0, sent = 0;
+    std::unique_lock lock{mtx_};
+    for (;;) {
+        cv_.wait(lock, [&] { return stopping_ || toAck_ != sent || ackEpoch_ != sentEpoch; });
+        if (stopping_) return;
+        booking::AckReq req;
+        req.set_epoch(ackEpoch_);
+        req.set_seq(toAck_);
+        lock.unlock();
+
+        grpc::ClientContext ctx;
+        ctx.set_deadline(std::chrono::system_clock::now() + kAckDeadline);
+        booking::Empty none;
+        const bool ok = stub_->Ack(&ctx, req, &none).ok();
+
+        lock.lock();
+        if (ok) { sentEpoch = req.epoch(); sent = req.seq(); }
+        else    cv_.wait_for(lock, cfg_.retry, [&] { return stopping_; });
+    }
+}
@@ -0,0 +1,113 @@
+#ifndef STANDBY_HPP
+#define STANDBY_HPP
+
+#include "booking/domain/StringArena.hpp"
+#include "booking/service/HallExecutor.hpp"
+#include "booking/service/IBookingRepository.hpp"
+#include "booking.grpc.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+/**
+ * @file Standby.hpp
+ * @brief Warm-standby replica: follows a primary's write log
+ *        (*booking.Replication*) and serves reads until it is promoted.
+ *
+ * ```text
+ *   primary ── Follow stream ──▶ follower thread ── apply ──▶ repository()
+ *           ◀── Ack(seq) ─────── acker thread (coalesces)         │
+ *                                                BookingServiceImpl (reads)
+ * ```
+ *
+ * repository() is what the standby's BookingManager is built on.  It
+ * forwards reads to the replicated state and answers every write with
+ * `ReadOnly` until promote(); afterwards it is an ordinary repository.
+ *
+ * On (re)connect the standby presents the log epoch and the last sequence
+ * number it applied.  When the primary answers with a snapshot, the state
+ * is rebuilt in a fresh repository and swapped in whole at `SNAPSHOT_END`,
+ * so readers never see half a resync.  Connection loss is retried every
+ * `Config::retry` until promotion.  A record the replica cannot apply (a
+ * booking for a hall it does not have) is never acknowledged: the standby
+ * drops the stream and asks for a snapshot instead.
+ *
+ * In thread-per-core mode a hall's owner lists its seats without the hall
+ * lock, so `Config::owners` must be the standby manager's executor: each
+ * replicated booking is then replayed on the hall's owner, and the
+ * follower waits for it before acknowledging.
+ */
+class Standby
+{
+public:
+    struct Config
+    {
+        booking::domain::Theater::Rules house;          ///< seating rules, as on the primary
+        std::chrono::milliseconds       retry{500};     ///< reconnect back-off
+        std::function<void()>           onCatalog;      ///< after a replicated catalog change
+        /// Hall owners of the standby's BookingManager (thread-per-core
+        /// mode); replicated bookings are then applied on the owning worker.
+        std::shared_ptr<booking::service::HallExecutor> owners;
+    };
+
+    /// Start following the primary reachable over @p primary.
+    Standby(std::shared_ptr<grpc::Channel> primary, Config cfg);
+    ~Standby();
+
+    Standby(const Standby&)            = delete;
+    Standby& operator=(const Standby&) = delete;
+
+    /// Replicated state; read-only until promote().
+    [[nodiscard]] std::shared_ptr<booking::service::IBookingRepository> repository() const;
+
+    /**
+     * @brief Stop following and start accepting writes.
+     *
+     * Everything received from the primary is applied before this returns;
+     * with a synchronous primary that includes every booking it confirmed.
+     * Concurrent calls are serialised; exactly one of them promotes.
+     * @return `false` if already promoted.
+     */
+    bool promote();
+
+    [[nodiscard]] bool promoted() const noexcept { return promoted_.load(); }
+
+    /// Log followed and last sequence number applied (0 / 0 before the first snapshot).
+    [[nodiscard]] std::uint64_t epoch() const noexcept   { return epoch_.load(); }
+    [[nodiscard]] std::uint64_t applied() const noexcept { return applied_.load(); }
+
+private:
+    class Replica;
+
+    void follow();
+    void acker();
+    void stop();
+
+    std::unique_ptr<booking::Replication::Stub> stub_;
+    Config                                      cfg_;
+    /// Movie text of every state, so movies read before a resync stay valid.
+    std::shared_ptr<booking::domain::StringArena> text_;
+    std::shared_ptr<Replica>                    replica_;
+
+    std::mutex                 promoteMtx_;   ///< serialises promote()
+    std::atomic<bool>          promoted_{false};
+    std::atomic<std::uint64_t> epoch_{0};
+    std::atomic<std::uint64_t> applied_{0};
+
+    std::mutex                 mtx_;          ///< guards the fields below
+    std::condition_variable    cv_;
+    bool                       stopping_ = false;
+    grpc::ClientContext*       stream_   = nullptr;   ///< open Follow call
+    std::uint64_t              ackEpoch_ = 0;
+    std::uint64_t              toAck_    = 0;         ///< newest seq not yet acked
+
+    std::thread                follower_;
+    std::thread                acker_;
+};
+
+#endif //STANDBY_HPP
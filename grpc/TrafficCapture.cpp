@@ -0,0 +1,102 @@
+// grpc/TrafficCapture.cpp
+#include "TrafficCapture.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+namespace cap = transport::capture;
+
+namespace {
+constexpr std::size_t kWakeWriter = 1u << 20;   // buffered bytes that cut a flush short
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// ctor / dtor
+// ────────────────────────────────────────────────────────────────────────────
+TrafficCapture::TrafficCapture(Config cfg)
+    : cfg_(std::move(cfg)), origin_(Clock::now())
+{
+    out_.open(cfg_.path, std::ios::binary | std::ios::trunc);
+    if (!out_) throw std::runtime_error("capture: cannot open " + cfg_.path);
+
+    cap::FileHeader fh{};
+    std::copy(std::begin(cap::kMagic), std::end(cap::kMagic), fh.magic);
+    fh.version     = cap::kVersion;
+    fh.wallStartNs = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    out_.write(reinterpret_cast<const char*>(&fh), sizeof fh);
+    out_.flush();
+
+    writer_ = std::thread{[this] { writeLoop(); }};
+}
+
+TrafficCapture::~TrafficCapture()
+{
+    {
+        const std::lock_guard lock{mtx_};
+        stop_ = true;
+    }
+    cv_.notify_one();
+    writer_.join();
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Producer side - handler threads
+// ────────────────────────────────────────────────────────────────────────────
+void TrafficCapture::record(cap::Method method, Clock::time_point start, Clock::time_point end,
+                            const google::protobuf::MessageLite& req)
+{
+    thread_local std::string payload;
+    payload.clear();
+    if (!req.AppendToString(&payload) || payload.size() > cap::kMaxPayload) {
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    using std::chrono::duration_cast;
+    using std::chrono::nanoseconds;
+    const auto dur = duration_cast<nanoseconds>(end - start).count();
+
+    cap::RecordHeader h{};
+    h.startNs    = duration_cast<nanoseconds>(start - origin_).count();
+    h.durationNs = static_cast<std::uint32_t>(std::clamp<std::int64_t>(dur, 0, UINT32_MAX));
+    h.size       = static_cast<std::uint16_t>(payload.size());
+    h.method     = method;
+
+    bool wake = false;
+    {
+        const std::lock_guard lock{mtx_};
+        if (pending_.size() + sizeof h + payload.size() > cfg_.maxPending) {
+            dropped_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        pending_.append(reinterpret_cast<const char*>(&h), sizeof h);
+        pending_.append(payload);
+        wake = pending_.size() >= kWakeWriter;
+    }
+    records_.fetch_add(1, std::memory_order_relaxed);
+    if (wake) cv_.notify_one();
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Writer thread
+// ────────────────────────────────────────────────────────────────────────────
+void TrafficCapture::writeLoop()
+{
+    std::string batch;
+    for (;;) {
+        bool last = false;
+        {
+            std::unique_lock lock{mtx_};
+            cv_.wait_for(lock, cfg_.flushEvery,
+                         [this] { return stop_ || pending_.size() >= kWakeWriter; });
+            batch.swap(pending_);                      // producers keep going
+            last = stop_;
+        }
+        if (!batch.empty()) {
+            out_.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+            out_.flush();
+            batch.clear();
+        }
+        if (last) return;
+    }
+}
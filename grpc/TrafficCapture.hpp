@@ -0,0 +1,110 @@
+#ifndef TRAFFIC_CAPTURE_HPP
+#define TRAFFIC_CAPTURE_HPP
+
+#include "transport/TrafficLog.hpp"
+#include <google/protobuf/message_lite.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/**
+ * @file TrafficCapture.hpp
+ * @brief Records incoming RPCs (start time, duration, method, serialized
+ *        request) to a binary log for `booking_replay`; the format is in
+ *        transport/TrafficLog.hpp.
+ *
+ * Every unary `Booking` RPC is captured, plus the `BookingAdmin` catalog
+ * changes so that a replay against a fresh server recreates the halls the
+ * traffic books into.
+ *
+ * ```text
+ *   handler ── Call{} ... return ─▶ record(): serialize, append under lock
+ *                                                   │ swap every flushEvery
+ *                                    writer thread ◀┘ or past 1 MiB ─▶ file
+ * ```
+ *
+ * The handler thread never touches the file: it appends ~16 + payload
+ * bytes to an in-memory buffer and returns.  If the writer falls behind
+ * by more than `maxPending` bytes, further records are dropped (and
+ * counted) rather than slowing the service down.
+ */
+class TrafficCapture
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Config
+    {
+        std::string               path;                      ///< log file, truncated
+        std::size_t               maxPending = 64u << 20;    ///< bytes buffered before dropping
+        std::chrono::milliseconds flushEvery{50};
+    };
+
+    /// Open @p cfg.path and start the writer thread; throws `std::runtime_error`.
+    explicit TrafficCapture(Config cfg);
+
+    /// Writes out everything still buffered.
+    ~TrafficCapture();
+
+    TrafficCapture(const TrafficCapture&)            = delete;
+    TrafficCapture& operator=(const TrafficCapture&) = delete;
+
+    /**
+     * @brief Scope of one handler: stamps the start on construction and
+     *        records the call on destruction.  A `nullptr` capture makes
+     *        it a no-op.
+     */
+    class Call
+    {
+    public:
+        Call(TrafficCapture* cap, transport::capture::Method method,
+             const google::protobuf::MessageLite& req) noexcept
+            : cap_{cap}, method_{method}, req_{req},
+              start_{cap ? Clock::now() : Clock::time_point{}} {}
+        ~Call() { if (cap_) cap_->record(method_, start_, Clock::now(), req_); }
+
+        Call(const Call&)            = delete;
+        Call& operator=(const Call&) = delete;
+
+    private:
+        TrafficCapture*                       cap_;
+        transport::capture::Method            method_;
+        const google::protobuf::MessageLite&  req_;
+        Clock::time_point                     start_;
+    };
+
+    /// Append one call; never blocks on I/O.
+    void record(transport::capture::Method method, Clock::time_point start, Clock::time_point end,
+                const google::protobuf::MessageLite& req);
+
+    /// Calls written or buffered so far.
+    [[nodiscard]] std::uint64_t records() const noexcept { return records_.load(); }
+
+    /// Calls lost because the writer fell behind or the request was too big.
+    [[nodiscard]] std::uint64_t dropped() const noexcept { return dropped_.load(); }
+
+    [[nodiscard]] const std::string& path() const noexcept { return cfg_.path; }
+
+private:
+    void writeLoop();
+
+    Config                     cfg_;
+    Clock::time_point          origin_;
+    std::ofstream              out_;
+
+    std::mutex                 mtx_;
+    std::condition_variable    cv_;
+    std::string                pending_;       ///< guarded by mtx_
+    bool                       stop_ = false;  ///< guarded by mtx_
+    std::thread                writer_;
+
+    std::atomic<std::uint64_t> records_{0};
+    std::atomic<std::uint64_t> dropped_{0};
+};
+
+#endif //TRAFFIC_CAPTURE_HPP
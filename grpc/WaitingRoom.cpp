@@ -0,0 +1,247 @@
+// grpc/WaitingRoom.cpp
+#include "WaitingRoom.hpp"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+using booking::domain::Movie;
+
+namespace {
+
+constexpr unsigned      kMacBits = 32;
+constexpr std::uint64_t kMacMask = (std::uint64_t{1} << kMacBits) - 1;
+constexpr std::uint64_t kMaxSeq  = kMacMask - 1;        ///< seq + 1 fits the upper half
+constexpr std::uint64_t kUseMask = 0xFF;                ///< attempts field of a use slot
+
+std::size_t pow2(std::size_t n) noexcept
+{
+    std::size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+/// SplitMix64 finaliser - cheap keyed hash for the token MAC.
+std::uint64_t mix(std::uint64_t x) noexcept
+{
+    x += 0x9e3779b97f4a7c15ULL;
+    x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    x = (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// ctor / dtor
+// ────────────────────────────────────────────────────────────────────────────
+WaitingRoom::WaitingRoom(Config cfg)
+    : cfg_{std::move(cfg)},
+      secret_{(std::uint64_t{std::random_device{}()} << 32) ^ std::random_device{}()}
+{
+    cfg_.bookingsPerToken = std::clamp<std::uint32_t>(cfg_.bookingsPerToken, 1, kUseMask);
+    const std::size_t slots = pow2(std::max<std::uint32_t>(cfg_.maxAdmitted, 1));
+    for (Movie::Id m : cfg_.movies)
+        rooms_.emplace(m, std::make_unique<Room>(slots));
+
+    if (!rooms_.empty() && cfg_.tick.count() > 0)
+        pacer_ = std::thread{[this] { pace(); }};
+}
+
+WaitingRoom::~WaitingRoom()
+{
+    {
+        std::scoped_lock lk{stopMtx_};
+        stop_ = true;
+    }
+    stopCv_.notify_all();
+    if (pacer_.joinable()) pacer_.join();
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// token helpers
+// ────────────────────────────────────────────────────────────────────────────
+std::uint64_t WaitingRoom::mac(Movie::Id m, std::uint64_t s) const noexcept
+{
+    return mix(mix(s ^ secret_) ^ m) & kMacMask;
+}
+
+WaitingRoom::Token WaitingRoom::encode(Movie::Id m, std::uint64_t seq) const noexcept
+{
+    // seq is 1-based inside the token so that 0 always means "no token"
+    return ((seq + 1) << kMacBits) | mac(m, seq + 1);
+}
+
+bool WaitingRoom::decode(Movie::Id m, Token t, std::uint64_t& seq) const noexcept
+{
+    const std::uint64_t s = t >> kMacBits;
+    if (s == 0 || mac(m, s) != (t & kMacMask))
+        return false;
+    seq = s - 1;
+    return true;
+}
+
+bool WaitingRoom::valid(const Room& r, std::uint64_t seq) noexcept
+{
+    return seq <  r.admittedUpTo.load(std::memory_order_acquire) &&
+           seq >= r.expiredBelow.load(std::memory_order_acquire);
+}
+
+WaitingRoom::Room* WaitingRoom::find(Movie::Id m) noexcept
+{
+    const auto it = rooms_.find(m);
+    return it == rooms_.end() ? nullptr : it->second.get();
+}
+
+const WaitingRoom::Room* WaitingRoom::find(Movie::Id m) const noexcept
+{
+    const auto it = rooms_.find(m);
+    return it == rooms_.end() ? nullptr : it->second.get();
+}
+
+WaitingRoom::Ticket
+WaitingRoom::snapshot(const Room& r, std::uint64_t seq, Token t) const noexcept
+{
+    Ticket tk;
+    tk.token = t;
+
+    const auto upTo = r.admittedUpTo.load(std::memory_order_acquire);
+    if (seq < upTo) {
+        tk.admitted = seq >= r.expiredBelow.load(std::memory_order_acquire);
+        return tk;
+    }
+
+    tk.position = seq - upTo + 1;
+
+    // ETA from the current batch size; poll at most once per tick and at
+    // least every few seconds so the client notices a faster queue
+    const double perTick = std::max<double>(cfg_.minBatch,
+                                            r.perTick.load(std::memory_order_relaxed));
+    const double ticks   = std::ceil(static_cast<double>(tk.position) / perTick);
+    const auto   tickMs  = static_cast<double>(cfg_.tick.count());
+    tk.retryAfterMs = static_cast<std::uint32_t>(
+        std::clamp(ticks * tickMs / 2, tickMs, 5000.0));
+    return tk;
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// public API
+// ────────────────────────────────────────────────────────────────────────────
+bool WaitingRoom::gated(Movie::Id m) const noexcept
+{
+    return find(m) != nullptr;
+}
+
+WaitingRoom::Ticket WaitingRoom::join(Movie::Id m)
+{
+    Room* r = find(m);
+    if (!r) {
+        Ticket tk;
+        tk.admitted = true;                      // nothing to wait for
+        return tk;
+    }
+    const auto seq = r->nextSeq.fetch_add(1, std::memory_order_acq_rel);
+    if (seq > kMaxSeq) return Ticket{};                  // sequence space used up
+    return snapshot(*r, seq, encode(m, seq));
+}
+
+WaitingRoom::Ticket WaitingRoom::status(Movie::Id m, Token t) const
+{
+    const Room* r = find(m);
+    if (!r) {
+        Ticket tk;
+        tk.token    = t;
+        tk.admitted = true;
+        return tk;
+    }
+
+    std::uint64_t seq = 0;
+    if (!decode(m, t, seq) || seq >= r->nextSeq.load(std::memory_order_acquire))
+        return Ticket{t, 0, false, 0};
+    return snapshot(*r, seq, t);
+}
+
+bool WaitingRoom::admitted(Movie::Id m, Token t) const noexcept
+{
+    const Room* r = find(m);
+    if (!r) return true;
+
+    std::uint64_t seq = 0;
+    return decode(m, t, seq) && valid(*r, seq);
+}
+
+bool WaitingRoom::admit(Movie::Id m, Token t) noexcept
+{
+    Room* r = find(m);
+    if (!r) return true;
+
+    std::uint64_t seq = 0;
+    if (!decode(m, t, seq) || !valid(*r, seq)) return false;
+
+    // slot of seq: a smaller tag is an expired token, a larger one means
+    // ours has expired in the meantime and its slot was handed on
+    auto& slot = r->uses[seq & (r->uses.size() - 1)];
+    const std::uint64_t tag = (seq + 1) << 8;
+    auto cur = slot.load(std::memory_order_relaxed);
+    for (;;) {
+        if ((cur & ~kUseMask) > tag) return false;
+        const std::uint64_t used = (cur & ~kUseMask) == tag ? cur & kUseMask : 0;
+        if (used >= cfg_.bookingsPerToken) return false;
+        if (slot.compare_exchange_weak(cur, tag | (used + 1), std::memory_order_relaxed))
+            return true;
+    }
+}
+
+void WaitingRoom::recordBooking(Movie::Id m) noexcept
+{
+    if (Room* r = find(m))
+        r->attempts.fetch_add(1, std::memory_order_relaxed);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// pacer
+// ────────────────────────────────────────────────────────────────────────────
+void WaitingRoom::advance(Room& r, std::chrono::steady_clock::time_point now)
+{
+    // 1) throughput estimate: EWMA of booking attempts per tick
+    const auto done = static_cast<double>(r.attempts.exchange(0, std::memory_order_relaxed));
+    const double est = 0.75 * r.perTick.load(std::memory_order_relaxed) + 0.25 * done;
+    r.perTick.store(est, std::memory_order_relaxed);
+
+    // 2) admit the next FIFO batch, never past the last issued ticket nor
+    //    beyond maxAdmitted valid admits (one use slot each)
+    const auto batch = static_cast<std::uint64_t>(std::clamp<double>(
+        std::ceil(est), cfg_.minBatch, cfg_.maxBatch));
+    const auto upTo  = r.admittedUpTo.load(std::memory_order_relaxed);
+    const auto next  = std::min({upTo + batch, r.nextSeq.load(std::memory_order_acquire),
+                                 r.expiredBelow.load(std::memory_order_relaxed) + r.uses.size()});
+    if (next > upTo) {
+        r.admittedUpTo.store(next, std::memory_order_release);
+        r.batches.emplace_back(next, now);
+    }
+
+    // 3) expire admits that were never used within the TTL
+    while (!r.batches.empty() && now - r.batches.front().second >= cfg_.admitTtl) {
+        r.expiredBelow.store(r.batches.front().first, std::memory_order_release);
+        r.batches.pop_front();
+    }
+}
+
+void WaitingRoom::tick()
+{
+    if (cfg_.tick.count() > 0)
+        throw std::logic_error("WaitingRoom::tick: the pacer thread is running");
+    const auto now = std::chrono::steady_clock::now();
+    for (auto& kv : rooms_)
+        advance(*kv.second, now);
+}
+
+void WaitingRoom::pace()
+{
+    std::unique_lock lk{stopMtx_};
+    while (!stopCv_.wait_for(lk, cfg_.tick, [this] { return stop_; })) {
+        const auto now = std::chrono::steady_clock::now();
+        for (auto& kv : rooms_)
+            advance(*kv.second, now);
+    }
+}
@@ -0,0 +1,150 @@
+#ifndef WAITING_ROOM_HPP
+#define WAITING_ROOM_HPP
+
+#include "booking/domain/Movie.hpp"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file WaitingRoom.hpp
+ * @brief Virtual waiting room that meters access to `BookSeats` for hot
+ *        on-sale movies.
+ *
+ * Clients of a *gated* movie first call `JoinQueue` and receive a
+ * **queue token** that encodes their FIFO sequence number.  A background
+ * pacer periodically moves the *admission frontier* forward by a batch
+ * whose size follows the booking throughput measured over the previous
+ * ticks, so the hall sees roughly the load it can absorb.
+ *
+ * ```text
+ *   expiredBelow          admittedUpTo              nextSeq
+ *        │  admitted window    │      still waiting     │
+ *   ─────┼─────────────────────┼────────────────────────┼────▶ seq
+ * ```
+ *
+ * The check on the booking path (@ref WaitingRoom::admit) is **O(1)
+ * and lock-free**: one lookup in a map that is immutable after
+ * construction, a token MAC check, two atomic loads and one CAS on the
+ * token's use counter.  The MAC covers the movie, so a token only opens
+ * the queue it was issued for, and an admit is good for
+ * `Config::bookingsPerToken` booking attempts within its TTL.  Use
+ * counters live in a ring of `Config::maxAdmitted` slots indexed by
+ * sequence number; the pacer never lets more admits than that be valid at
+ * once, so two live tokens never share a slot.
+ *
+ * Position is exposed via cheap polling (`QueueStatus` with a
+ * `retry_after_ms` hint) rather than a stream, so waiting clients never pin
+ * a thread of the synchronous server.
+ */
+class WaitingRoom
+{
+public:
+    /// Opaque client token (32-bit sequence number + 32-bit MAC over
+    /// sequence number and movie; 0 == "no token").
+    using Token = std::uint64_t;
+
+    /// Static configuration - the set of gated movies is fixed at start-up.
+    struct Config
+    {
+        std::vector<booking::domain::Movie::Id> movies;  ///< gated titles
+        std::chrono::milliseconds tick{100};             ///< pacer period, 0 = tick() by hand
+        std::uint32_t             minBatch = 8;          ///< admits per tick, floor
+        std::uint32_t             maxBatch = 1024;       ///< admits per tick, ceiling
+        std::chrono::seconds      admitTtl{120};         ///< how long an admit stays valid
+        std::uint32_t             bookingsPerToken = 4;  ///< booking attempts per admit (<= 255)
+        std::uint32_t             maxAdmitted = 1u << 16;   ///< admits valid at once (rounded up to 2^n)
+    };
+
+    /// Queue position snapshot returned to clients.
+    struct Ticket
+    {
+        Token         token    = 0;
+        std::uint64_t position = 0;     ///< clients ahead (0 when admitted)
+        bool          admitted = false;
+        std::uint32_t retryAfterMs = 0; ///< suggested polling delay
+    };
+
+    explicit WaitingRoom(Config cfg);
+    ~WaitingRoom();
+
+    WaitingRoom(const WaitingRoom&)            = delete;
+    WaitingRoom& operator=(const WaitingRoom&) = delete;
+
+    /// `true` if bookings for @p m must present an admitted token.
+    [[nodiscard]] bool gated(booking::domain::Movie::Id m) const noexcept;
+
+    /// Enqueue a new client for @p m (ungated movies are admitted at once).
+    [[nodiscard]] Ticket join(booking::domain::Movie::Id m);
+
+    /// Current position of @p t; `admitted == false` and `position == 0`
+    /// together mean the token is invalid or expired.
+    [[nodiscard]] Ticket status(booking::domain::Movie::Id m, Token t) const;
+
+    /// @p t is admitted (and not expired) for @p m; does not use it up.
+    [[nodiscard]] bool admitted(booking::domain::Movie::Id m, Token t) const noexcept;
+
+    /// Booking-path check: admitted() and one of the token's booking
+    /// attempts taken - `false` once they are used up.  O(1), lock-free.
+    [[nodiscard]] bool admit(booking::domain::Movie::Id m, Token t) noexcept;
+
+    /// Feed one completed booking attempt into the throughput estimate.
+    void recordBooking(booking::domain::Movie::Id m) noexcept;
+
+    /**
+     * @brief Run one pacer step now (tests, or an external scheduler).
+     * @throws std::logic_error unless `Config::tick` is zero - the pacer
+     *         thread owns the step otherwise.
+     */
+    void tick();
+
+private:
+    /// Per-movie queue state; all hot fields are atomics.
+    struct Room
+    {
+        explicit Room(std::size_t slots) : uses(slots) {}
+
+        std::atomic<std::uint64_t> nextSeq{0};        ///< next ticket to hand out
+        std::atomic<std::uint64_t> admittedUpTo{0};   ///< seq < this may book
+        std::atomic<std::uint64_t> expiredBelow{0};   ///< seq < this timed out
+        std::atomic<std::uint64_t> attempts{0};       ///< bookings since last tick
+        std::atomic<double>        perTick{0};        ///< smoothed attempts / tick
+        /// Per admitted seq: (seq + 1) << 8 | attempts, slot seq mod size.
+        std::vector<std::atomic<std::uint64_t>> uses;
+
+        /// Admitted batches, oldest first (pacer thread only).
+        std::deque<std::pair<std::uint64_t, std::chrono::steady_clock::time_point>> batches;
+    };
+
+    [[nodiscard]] Room*       find(booking::domain::Movie::Id m) noexcept;
+    [[nodiscard]] const Room* find(booking::domain::Movie::Id m) const noexcept;
+
+    [[nodiscard]] std::uint64_t mac(booking::domain::Movie::Id m, std::uint64_t s) const noexcept;
+    [[nodiscard]] Token encode(booking::domain::Movie::Id m, std::uint64_t seq) const noexcept;
+    [[nodiscard]] bool  decode(booking::domain::Movie::Id m, Token t, std::uint64_t& seq) const noexcept;
+    [[nodiscard]] static bool valid(const Room& r, std::uint64_t seq) noexcept;
+    [[nodiscard]] Ticket snapshot(const Room& r, std::uint64_t seq, Token t) const noexcept;
+
+    void pace();                 ///< pacer thread body
+    void advance(Room& r, std::chrono::steady_clock::time_point now);
+
+    Config        cfg_;
+    std::uint64_t secret_;       ///< per-process MAC key for tokens
+
+    /// Built once in the ctor, read-only afterwards -> safe lock-free lookups.
+    std::unordered_map<booking::domain::Movie::Id, std::unique_ptr<Room>> rooms_;
+
+    std::mutex              stopMtx_;
+    std::condition_variable stopCv_;
+    bool                    stop_ = false;
+    std::thread             pacer_;
+};
+
+#endif //WAITING_ROOM_HPP
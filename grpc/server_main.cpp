@@ -1,24 +1,46 @@
 // grpc/server_main.cpp
+#include "BookingAdminImpl.hpp"
 #include "BookingServiceImpl.hpp"
+#include "ReplicationServiceImpl.hpp"
+#include "ShmServer.hpp"
+#include "Standby.hpp"
 #include "transport/Endpoints.hpp"
+#include <booking/telemetry/LockProfiler.hpp>
+#include <booking/telemetry/Tracer.hpp>
 #include <booking/service/IBookingRepository.hpp>
 #include <booking/service/BookingManager.hpp>
+#include <booking/service/ReplicatingRepository.hpp>
 
 #include <grpcpp/server_builder.h>
 #include <filesystem>
+#include <fstream>
 #include <iostream>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
+#ifndef _WIN32
+#include <csignal>
+#include <pthread.h>
+#endif
+
 /* factory declared in InMemoryRepository.cpp */
 namespace booking::service {
-std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+std::shared_ptr<IBookingRepository> makeInMemoryRepository(const domain::Theater::Rules& house);
 }
 
 // ────────────────────────────────────────────────────────────────────────────
 // Minimal CLI parser (no external deps)
 // Usage:
 //   booking_server [--host 0.0.0.0] [--port 50051] [--ipc /tmp/booking.sock]
+//                  [--admin-addr 127.0.0.1:50052]
+//                  [--no-admission] [--waiting-room <movie>[,<movie>...]]
+//                  [--no-metrics] [--trace <N>] [--trace-out <file.json>]
+//                  [--shm <path>] [--capture <file>]
+//                  [--no-single-gaps] [--distancing <n>] [--wheelchair <seats>]
+//                  [--dedup <entries>] [--hall-threads <n>]
+//                  [--replicate [--sync-standby]] [--standby-of <admin addr>]
 // ────────────────────────────────────────────────────────────────────────────
 struct Cmd {
     std::string host  = "0.0.0.0";
@@ -29,6 +51,20 @@ struct Cmd {
 #else
         "/tmp/booking.sock";
 #endif
+    std::string adminAddr = "127.0.0.1:50052";   // BookingAdmin listener (host:port | unix:/path)
+    bool        admission = true;   // adaptive load shedding
+    std::vector<booking::domain::Movie::Id> gated;   // waiting-room movies
+    bool        metrics   = true;   // per-RPC histograms + GetMetrics
+    std::uint32_t traceEvery = 0;   // sample 1 in N requests, 0 = off
+    std::string   traceOut;         // Chrome trace written on SIGINT/SIGTERM
+    std::string   shm;              // shared-memory rendezvous socket, empty = off
+    std::string   capture;          // request log for booking_replay, empty = off
+    booking::domain::Theater::Rules seating;   // house rules of every hall
+    std::size_t   dedup = 65536;    // BookSeats idempotency keys remembered, 0 = off
+    int           hallThreads = -1; // thread-per-core workers, 0 = one per CPU, -1 = off
+    bool          replicate   = false; // serve the write log to standbys
+    bool          syncStandby = false; // bookings wait for the standby's ack
+    std::string   standbyOf;        // primary to follow, empty = not a standby
 };
 
 Cmd parse(int argc, char** argv)
@@ -41,16 +77,79 @@ Cmd parse(int argc, char** argv)
         if      (arg == "--host" || arg == "-h") cfg.host = next();
         else if (arg == "--port" || arg == "-p") cfg.port = std::stoi(next());
         else if (arg == "--ipc"  || arg == "-i") cfg.ipc  = next();
+        else if (arg == "--admin-addr")          cfg.adminAddr = next();
+        else if (arg == "--no-admission")        cfg.admission = false;
+        else if (arg == "--no-metrics")          cfg.metrics   = false;
+        else if (arg == "--trace")               cfg.traceEvery = static_cast<std::uint32_t>(std::stoul(next()));
+        else if (arg == "--trace-out")           cfg.traceOut   = next();
+        else if (arg == "--shm")                 cfg.shm        = next();
+        else if (arg == "--capture")             cfg.capture    = next();
+        else if (arg == "--dedup")               cfg.dedup      = std::stoul(next());
+        else if (arg == "--hall-threads")        cfg.hallThreads = std::stoi(next());
+        else if (arg == "--replicate")           cfg.replicate   = true;
+        else if (arg == "--sync-standby")        cfg.syncStandby = cfg.replicate = true;
+        else if (arg == "--standby-of")          cfg.standbyOf   = next();
+        else if (arg == "--no-single-gaps")      cfg.seating.noSingleGaps = true;
+        else if (arg == "--distancing")          cfg.seating.buffer = static_cast<std::uint8_t>(std::stoul(next()));
+        else if (arg == "--wheelchair") {                // A1,A20
+            std::stringstream ss(next()); std::string tok;
+            while (std::getline(ss, tok, ',')) {
+                const auto n = tok.size() > 1 && tok[0] == 'A' ? std::stoul(tok.substr(1)) : 0;
+                if (n < 1 || n > booking::domain::Theater::kCapacity)
+                    throw std::runtime_error("bad seat label " + tok);
+                cfg.seating.accessible |= booking::domain::Theater::SeatMask{1} << (n - 1);
+            }
+        }
+        else if (arg == "--waiting-room") {
+            std::stringstream ss(next()); std::string tok;
+            while (std::getline(ss, tok, ','))
+                cfg.gated.push_back(static_cast<booking::domain::Movie::Id>(std::stoul(tok)));
+        }
         else if (arg == "--help") {
             std::cout <<
               "booking_server [options]\n"
               "  --host, -h  <addr>   Bind address (default 0.0.0.0)\n"
               "  --port, -p  <num>    TCP port     (default 50051)\n"
-              "  --ipc,  -i  <path>   Unix-domain socket path (empty to disable)\n";
+              "  --ipc,  -i  <path>   Unix-domain socket path (empty to disable)\n"
+              "  --admin-addr <addr>  Listener for BookingAdmin - metrics, tracing,\n"
+              "                       catalog changes; bind a trusted interface only\n"
+              "                       (default 127.0.0.1:50052, or unix:/path)\n"
+              "  --no-admission       Disable load shedding / concurrency limits\n"
+              "  --waiting-room <ids> Gate BookSeats for these movies behind a queue\n"
+              "  --no-metrics         Disable latency histograms / GetMetrics\n"
+              "  --trace <N>          Trace 1 in N requests (see DumpTrace)\n"
+              "  --trace-out <file>   Write the trace as JSON on SIGINT/SIGTERM\n"
+              "  --shm <path>         Also serve FreeSeats / Book over shared memory\n"
+              "                       (Linux; clients: transport/ShmClient.hpp)\n"
+              "  --capture <file>     Log every request for booking_replay; flushed\n"
+              "                       on SIGINT/SIGTERM\n"
+              "  --dedup <entries>    BookSeats idempotency keys to remember\n"
+              "                       (default 65536, 0 disables)\n"
+              "  --hall-threads <n>   Give every hall to one of n pinned workers\n"
+              "                       (0 = one per CPU); bookings skip the hall lock\n"
+              "  --replicate          Stream every write to standbys (Replication,\n"
+              "                       on the admin listener)\n"
+              "  --sync-standby       With --replicate: confirm a booking only once\n"
+              "                       a standby applied it (1 s timeout); refuse\n"
+              "                       writes while no standby is attached; not\n"
+              "                       with --hall-threads\n"
+              "  --standby-of <addr>  Follow this primary's admin listener (host:port\n"
+              "                       or unix:/path),\n"
+              "                       serve reads only until BookingAdmin.Promote\n"
+              "  --no-single-gaps     Refuse bookings that strand one empty seat\n"
+              "  --distancing <n>     Keep n empty seats between parties\n"
+              "  --wheelchair <seats> Wheelchair bays, e.g. A1,A20 (accessible\n"
+              "                       bookings only)\n";
             std::exit(0);
         }
         else throw std::runtime_error("unknown option " + arg);
     }
+    if (cfg.replicate && !cfg.standbyOf.empty())
+        throw std::runtime_error("--replicate and --standby-of are exclusive");
+    if (cfg.syncStandby && cfg.hallThreads >= 0)       // an owner would sit out every ack
+        throw std::runtime_error("--sync-standby and --hall-threads are exclusive");
+    if (cfg.adminAddr.empty())
+        throw std::runtime_error("--admin-addr must not be empty");
     return cfg;
 }
 
@@ -58,9 +157,71 @@ int main(int argc, char** argv)
 try {
     const Cmd cfg = parse(argc, argv);
 
-    auto repo = booking::service::makeInMemoryRepository();
-    auto mgr  = std::make_shared<booking::service::BookingManager>(repo);
-    BookingServiceImpl svc{mgr};
+#ifndef _WIN32
+    // --trace-out / --capture: route SIGINT/SIGTERM to a watcher thread (mask
+    // is inherited by every thread gRPC starts from here on) so the trace and
+    // the capture can be flushed
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    const bool flushOnStop = !cfg.traceOut.empty() || !cfg.capture.empty();
+    if (flushOnStop)
+        pthread_sigmask(SIG_BLOCK, &stopSignals, nullptr);
+#endif
+    booking::telemetry::Tracer::instance().setSampling(cfg.traceEvery);
+
+    ServiceOptions opts;
+    opts.catalog = std::make_shared<CatalogFeed>();
+
+    auto repo = booking::service::makeInMemoryRepository(cfg.seating);
+    std::shared_ptr<booking::service::ReplicatingRepository> primary;
+    std::unique_ptr<ReplicationServiceImpl> replication;
+    if (cfg.replicate) {
+        booking::service::ReplicationLog::Config rl;
+        rl.synchronous = cfg.syncStandby;
+        primary = std::make_shared<booking::service::ReplicatingRepository>(
+            repo, std::make_shared<booking::service::ReplicationLog>(rl));
+        replication = std::make_unique<ReplicationServiceImpl>(primary);
+        repo = primary;
+    }
+    std::shared_ptr<booking::service::HallExecutor> owners;
+    if (cfg.hallThreads >= 0)
+        owners = std::make_shared<booking::service::HallExecutor>(
+            static_cast<std::size_t>(cfg.hallThreads));
+    std::shared_ptr<Standby> standby;
+    if (!cfg.standbyOf.empty()) {
+        Standby::Config sb;
+        sb.house     = cfg.seating;
+        sb.owners    = owners;                           // replay on the hall's owner
+        sb.onCatalog = [feed = opts.catalog] { feed->bump(); };
+        standby = std::make_shared<Standby>(
+            grpc::CreateChannel(cfg.standbyOf, grpc::InsecureChannelCredentials()), sb);
+        repo = standby->repository();
+    }
+    auto mgr  = std::make_shared<booking::service::BookingManager>(repo, owners);
+    opts.admission.enabled = cfg.admission;
+    if (!cfg.gated.empty()) {
+        WaitingRoom::Config wr;
+        wr.movies = cfg.gated;
+        opts.waitingRoom = std::make_shared<WaitingRoom>(wr);
+    }
+    if (cfg.metrics) {
+        opts.metrics = std::make_shared<booking::telemetry::Registry>();
+        if (booking::telemetry::kLockProfiling)          // top halls only
+            opts.metrics->addCollector([](std::ostream& os) {
+                booking::telemetry::LockProfiler::instance().exposition(os);
+            });
+    }
+    if (cfg.dedup > 0) {
+        DedupTable::Config dd;
+        dd.capacity = cfg.dedup;
+        opts.dedup = std::make_shared<DedupTable>(dd);
+    }
+    if (!cfg.capture.empty())
+        opts.capture = std::make_shared<TrafficCapture>(TrafficCapture::Config{cfg.capture});
+    BookingServiceImpl svc{mgr, opts};
+    BookingAdminImpl   admin{mgr, opts.metrics, opts.catalog, opts.capture, standby};
 
 #ifndef _WIN32
     if (!cfg.ipc.empty()) std::filesystem::remove(cfg.ipc);
@@ -85,13 +246,65 @@ try {
         std::cerr << "Failed to start gRPC server\n";
         return 1;
     }
-    
+
+    // operator RPCs and the write log never share the public listeners
+#ifndef _WIN32
+    if (cfg.adminAddr.rfind("unix:", 0) == 0) std::filesystem::remove(cfg.adminAddr.substr(5));
+#endif
+    grpc::ServerBuilder adminBuilder;
+    adminBuilder.AddListeningPort(cfg.adminAddr, grpc::InsecureServerCredentials());
+    adminBuilder.RegisterService(&admin);
+    if (replication) adminBuilder.RegisterService(replication.get());
+    auto adminServer = adminBuilder.BuildAndStart();
+    if (!adminServer) {
+        std::cerr << "Failed to start admin server on " << cfg.adminAddr << '\n';
+        return 1;
+    }
+
     std::cout << "Booking server up - TCP " << cfg.host << ':' << cfg.port;
 #ifndef _WIN32
     if (!cfg.ipc.empty()) std::cout << " + IPC " << cfg.ipc;
 #endif
+    std::cout << " + admin " << cfg.adminAddr;
+#ifdef __linux__
+    std::unique_ptr<ShmServer> shm;
+    if (!cfg.shm.empty()) {
+        shm = std::make_unique<ShmServer>(mgr, ShmServer::Config{cfg.shm}, opts.waitingRoom);
+        std::cout << " + SHM " << cfg.shm;
+    }
+#else
+    if (!cfg.shm.empty()) std::cerr << "--shm is only supported on Linux\n";
+#endif
+    if (primary) std::cout << (cfg.syncStandby ? " (replicating, sync)" : " (replicating)");
+    if (standby) std::cout << " (standby of " << cfg.standbyOf << ')';
     std::cout << '\n';
+
+    std::thread stopper;
+#ifndef _WIN32
+    if (flushOnStop)
+        stopper = std::thread([&] {
+            int sig = 0;
+            sigwait(&stopSignals, &sig);
+            opts.catalog->close();              // end WatchCatalog streams
+            if (primary) primary->log()->close();   // end Follow streams
+            server->Shutdown();
+        });
+#endif
     server->Wait();
+    if (stopper.joinable()) stopper.join();
+    adminServer->Shutdown();
+
+    if (opts.capture) {
+        const auto n = opts.capture->records(), lost = opts.capture->dropped();
+        opts.capture.reset();                   // svc / admin flush it on exit
+        std::cout << "captured " << n << " requests (" << lost << " dropped) to "
+                  << cfg.capture << '\n';
+    }
+    if (!cfg.traceOut.empty()) {
+        std::ofstream out{cfg.traceOut};
+        const auto n = booking::telemetry::Tracer::instance().writeChromeJson(out);
+        std::cout << "wrote " << n << " trace events to " << cfg.traceOut << '\n';
+    }
 }
 catch (std::exception& e) {
     std::cerr << "error: " << e.what() << '\n';
@@ -3,6 +3,8 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 namespace booking::domain
 {
@@ -13,10 +15,12 @@ namespace booking::domain
  *        booking domain.
  *
  * The class is intentionally *light-weight & trivially copyable*: it holds
- * only identifiers and descriptive strings.  Any mutable state (e.g. box-office
- * stats) belongs elsewhere.
+ * an identifier and views of its descriptive strings.  Any mutable state
+ * (e.g. box-office stats) belongs elsewhere.
  */
 
+class StringArena;
+
 /**
  * @class Movie
  * @brief Immutable value-type describing a movie currently available for
@@ -31,11 +35,18 @@ namespace booking::domain
  * │  Movie      │
  * ├─────────────┤
  * │ id          │ 32-bit unsigned
- * │ title       │ UTF-8 title
- * │ description │ Free-form text (optional)
- * └─────────────┘
+ * │ title       │ UTF-8 title               ─┐ pointer + 32-bit length each,
+ * │ description │ Free-form text (optional) ─┘ text kept in a StringArena
+ * └─────────────┘  32 bytes
  * ```
  *
+ * A movie does **not** own its text.  One built by a caller views the
+ * caller's strings and is only valid while they are (a temporary
+ * `std::string` is refused at compile time); the repository copies
+ * the text into its @ref StringArena when the movie is added (interned()),
+ * and movies it hands out view that arena, which lives as long as the
+ * repository.
+ *
  * @note The class provides <em>trivial</em> getters only; once constructed a
  *       movie instance never changes.
  */
@@ -49,17 +60,28 @@ public:
     ///@{
 
     /// Default-construct an *invalid* movie with `id == 0`.
-    Movie() : id_{0} {}
+    Movie() = default;
 
     /**
-     * @brief Construct a fully-specified movie.
+     * @brief Construct a fully-specified movie viewing @p title and
+     *        @p description (not copied - see the class notes).
      * @param id           Unique identifier (≠ 0).
      * @param title        Human-readable title (UTF-8).
      * @param description  Optional synopsis / tagline. May be empty.
      */
-    Movie(Id id, std::string title, std::string description = {});
+    Movie(Id id, std::string_view title, std::string_view description = {}) noexcept;
+
+    /// A temporary `std::string` would be gone before the movie is used:
+    /// name it first.
+    template <class T, class D = std::string_view,
+              class = std::enable_if_t<std::is_same_v<T, std::string> ||
+                                       std::is_same_v<D, std::string>>>
+    Movie(Id id, T&& title, D&& description = {}) = delete;
     ///@}
 
+    /// The same movie with its text copied into (or found in) @p arena.
+    [[nodiscard]] Movie interned(StringArena& arena) const;
+
     /** @name Read-only accessors */
     ///@{
 
@@ -67,16 +89,18 @@ public:
     [[nodiscard]] Id id() const noexcept            { return id_; }
 
     /// Movie title.
-    [[nodiscard]] const std::string& title() const noexcept { return title_; }
+    [[nodiscard]] std::string_view title() const noexcept { return {title_, titleLen_}; }
 
     /// Optional extended description / synopsis.
-    [[nodiscard]] const std::string& desc()  const noexcept { return description_; }
+    [[nodiscard]] std::string_view desc()  const noexcept { return {desc_, descLen_}; }
     ///@}
 
 private:
-    Id          id_{0};
-    std::string title_;
-    std::string description_;
+    const char*   title_    = nullptr;
+    const char*   desc_     = nullptr;
+    Id            id_       = 0;
+    std::uint32_t titleLen_ = 0;
+    std::uint32_t descLen_  = 0;
 };
 
 } // namespace booking::domain
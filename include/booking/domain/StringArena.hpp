@@ -0,0 +1,77 @@
+#ifndef STRING_ARENA_HPP
+#define STRING_ARENA_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace booking::domain
+{
+
+/**
+ * @file StringArena.hpp
+ * @brief Append-only, interning store for catalog text (movie titles and
+ *        synopses) - see @ref Movie.
+ *
+ * Strings are copied back to back into large chunks, so a catalog's text
+ * costs one allocation per chunk instead of one per string.  Equal strings
+ * are stored once: an open-addressing table of pointers finds them, each
+ * string carrying its 4-byte length in front (about 20 bytes of overhead
+ * per distinct string).
+ *
+ * ```text
+ *   chunk 0  [12|Interstellar|87|A team of explorers…|9|Inception|4|Heat|… ]
+ *   chunk 1  [… (a string of over a quarter chunk gets a chunk of its own) ]
+ * ```
+ *
+ * Nothing is ever moved or freed before the arena itself, so a view
+ * returned by intern() stays valid for the arena's lifetime and may be
+ * read from any thread without locking.
+ */
+class StringArena
+{
+public:
+    /// Default chunk size; most catalogs fit in a handful.
+    static constexpr std::size_t kChunk = 16 * 1024;
+
+    explicit StringArena(std::size_t chunk = kChunk);
+
+    StringArena(const StringArena&)            = delete;
+    StringArena& operator=(const StringArena&) = delete;
+
+    /**
+     * @brief Stored copy of @p s (not NUL-terminated).
+     *
+     * Returns the existing copy when an equal string was interned before;
+     * the empty string needs no storage.  Thread-safe.
+     * @throws std::length_error for strings of 4 GiB or more.
+     */
+    std::string_view intern(std::string_view s);
+
+    /// Distinct strings stored.
+    [[nodiscard]] std::size_t strings() const;
+
+    /// Bytes of text stored / bytes of chunk memory allocated.
+    [[nodiscard]] std::size_t used() const;
+    [[nodiscard]] std::size_t capacity() const;
+
+private:
+    static std::string_view at(const char* text) noexcept;   ///< length-prefixed string
+    char* store(std::string_view s);
+    void  grow();
+
+    const std::size_t                     chunk_;
+    mutable std::mutex                    mtx_;
+    std::vector<std::unique_ptr<char[]>>  chunks_;
+    char*                                 next_ = nullptr;   ///< free space in the open chunk
+    std::size_t                           left_ = 0;
+    std::size_t                           used_ = 0, capacity_ = 0;
+    std::vector<const char*>              slots_;            ///< power of two, ≤ 3/4 full
+    std::size_t                           count_ = 0;
+};
+
+} // namespace booking::domain
+
+#endif //STRING_ARENA_HPP
@@ -2,15 +2,54 @@
 #define THEATER_HPP
 
 #include "Seat.hpp"
+#include "booking/telemetry/LockProfiler.hpp"
+#include <array>
+#include <atomic>
 #include <bitset>
 #include <cstdint>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
 namespace booking::domain
 {
 
+/// Outcome of a booking attempt (see Theater::book()).
+enum class BookStatus : std::uint8_t
+{
+    Booked,       ///< all seats were free and are now taken
+    Taken,        ///< at least one seat is already occupied
+    Invalid,      ///< seat index out of range
+    NotFound,     ///< no such movie / hall (repository level)
+    Accessible,   ///< wheelchair bay requested by a non-eligible booking
+    Distancing,   ///< a seat is closer than the hall's buffer to another party
+    SingleGap,    ///< the booking would strand a lone free seat
+    ReadOnly,     ///< repository is a standby replica (repository level)
+    Unreplicated, ///< synchronous primary: no standby confirmed it (repository level)
+};
+
+/// Short human-readable reason, e.g. "seat already booked".
+[[nodiscard]] const char* describe(BookStatus status) noexcept;
+
+/// Booking counters of a hall (or a sum of halls).
+struct Sales
+{
+    std::uint64_t attempts     = 0;   ///< requests that reached the seat map
+    std::uint64_t bookings     = 0;   ///< of those, booked
+    std::uint64_t seatsSold    = 0;
+    std::uint64_t conflicts    = 0;   ///< refused: seat already taken
+    std::uint64_t refused      = 0;   ///< refused: seating rule
+    std::uint64_t revenueCents = 0;
+
+    Sales& operator+=(const Sales& o) noexcept
+    {
+        attempts += o.attempts;   bookings += o.bookings;   seatsSold += o.seatsSold;
+        conflicts += o.conflicts; refused += o.refused;     revenueCents += o.revenueCents;
+        return *this;
+    }
+};
+
 /**
  * @file Theater.hpp
  * @brief Thread-safe seat-allocation model for a small (20-seat) theater hall.
@@ -29,9 +68,28 @@ namespace booking::domain
  * | Member function     | Concurrency guarantee                    |
  * |---------------------|-------------------------------------------|
  * | `freeSeats()`       | safe ­concurrent reads                   |
- * | `tryBook()`         | atomic reservation, serialised via mutex |
+ * | `tryBook()`/`book()`| atomic reservation, serialised via mutex |
+ * | `*Owned()`          | caller owns the hall - no lock           |
+ * | `quote()`           | lock-free - prices never change          |
+ * | `admits()`          | pure - rules never change                |
+ * | `sales()`           | lock-free, relaxed counter reads         |
  *
  * Internally we keep a `std::bitset` where *bit == 1* means **occupied**.
+ * Next to it sit two immutable columns fixed at construction: the price
+ * tier of every seat and the resulting price in cents.  A quote is a masked
+ * sum over the price column (see `quote()`).
+ * Seating rules (see `Rules`) are compiled at construction into a few seat
+ * masks, so checking them inside the critical section is a handful of
+ * shifts and ANDs on one word (see `admits()`).
+ * With `BOOKING_LOCK_PROFILING` the hall mutex is reported as lock site
+ * *theater &lt;id&gt;* (see telemetry/LockProfiler.hpp).
+ *
+ * **Layout** - a hall is cache-line aligned and split in two: the *hot*
+ * lines (mutex, seat map, rule masks, counters) that every booking writes,
+ * then the *cold* ones (price / tier columns, id, name) that never change.
+ * Two halls therefore never share a line, and halls from a
+ * @ref TheaterSlab sit in line-aligned slab blocks rather than scattered
+ * heap allocations.
  */
 class Theater
 {
@@ -45,6 +103,42 @@ public:
     /// Stable identifier type used by the service layer / clients.
     using Id = std::uint32_t;
 
+    /// Set of seats, bit *i* == seat index *i*.
+    using SeatMask = std::uint32_t;
+    static_assert(kCapacity <= 32, "SeatMask must hold one bit per seat");
+
+    /// Number of price categories a hall can have.
+    static constexpr std::size_t kTiers = 4;
+
+    /// Price category of every seat plus the price of each category.
+    struct Pricing
+    {
+        std::array<std::uint8_t, kCapacity> tier;    ///< category per seat (< kTiers)
+        std::array<std::uint32_t, kTiers>   cents;   ///< price per category
+
+        /// House layout: A1-A4 front (9.00), A5-A16 standard (12.00),
+        /// A17-A20 premium (15.00).
+        static Pricing standard() noexcept;
+    };
+
+    /// Venue seating rules; the default allows any set of free seats.
+    struct Rules
+    {
+        /// Refuse bookings that leave a single free seat between two taken
+        /// ones (row ends do not count as taken).
+        bool         noSingleGaps = false;
+        /// Free seats required on each side between different parties.
+        std::uint8_t buffer       = 0;
+        /// Wheelchair bays - only bookings flagged accessible may take them.
+        SeatMask     accessible   = 0;
+    };
+
+    /// Every seat of the hall.
+    static constexpr SeatMask kAllSeats = ~SeatMask{0} >> (32 - kCapacity);
+
+    /// Alignment of a hall and of its hot / cold parts.
+    static constexpr std::size_t kCacheLine = 64;
+
     // ---------------------------------------------------------------------
     // Rule-of-Five - copy disabled, move enabled
     // ---------------------------------------------------------------------
@@ -55,6 +149,19 @@ public:
      */
     explicit Theater(Id id_, std::string name_);
 
+    /**
+     * @brief Same, with explicit seat prices.
+     * @throws std::invalid_argument if a seat refers to a tier >= kTiers.
+     */
+    Theater(Id id_, std::string name_, const Pricing& pricing);
+
+    /**
+     * @brief Same, with seating rules.
+     * @throws std::invalid_argument on a tier >= kTiers, a bay outside the
+     *         hall or a buffer >= kCapacity.
+     */
+    Theater(Id id_, std::string name_, const Pricing& pricing, const Rules& rules);
+
     Theater(Theater&&) noexcept;
     Theater& operator=(Theater&&) noexcept;
 
@@ -90,14 +197,146 @@ public:
      */
     bool tryBook(const std::vector<Seat>& seats);
 
+    /**
+     * @brief Same as tryBook(), enforcing the hall's seating rules and
+     *        reporting why a booking was refused.
+     * @param accessible The party may use wheelchair bays.
+     */
+    BookStatus book(const std::vector<Seat>& seats, bool accessible = false);
+
+    /**
+     * @brief book() / freeSeats() without the hall lock, for the hall's
+     *        owning worker in thread-per-core mode (see
+     *        service::HallExecutor).
+     *
+     * The caller guarantees that no other thread books or lists this hall
+     * for as long as it owns it; the seat map then never leaves the
+     * owner's cache and nothing is locked.  Counters and the trace span
+     * are kept exactly as in book().
+     */
+    BookStatus bookOwned(const std::vector<Seat>& seats, bool accessible = false);
+
+    /// @copydoc bookOwned()
+    [[nodiscard]] std::vector<Seat> freeSeatsOwned() const;
+
+    /**
+     * @brief Mark @p seats sold without checking occupancy or rules and
+     *        without counting a sale.
+     *
+     * For replaying bookings that were already admitted elsewhere (a
+     * standby applying its primary's log); idempotent and commutative.
+     */
+    void occupy(SeatMask seats);
+
+    /**
+     * @brief Booking counters since construction.
+     *
+     * Written by book() inside the hall's critical section - the hall lock
+     * already serialises writers, so plain relaxed stores on the hall's own
+     * line suffice - and read here without the lock; the fields are
+     * individually exact but not a single consistent cut.
+     */
+    [[nodiscard]] Sales sales() const noexcept;
+
+    // ---------------------------------------------------------------------
+    // Seating rules
+    // ---------------------------------------------------------------------
+    /// Rules this hall was built with.
+    [[nodiscard]] Rules rules() const noexcept
+    {
+        return {gapSeats_ != 0, buffer_, reserved_};
+    }
+
+    /**
+     * @brief Would booking @p seats on top of @p taken be allowed?
+     *
+     * Pure word arithmetic over the compiled rule masks - the loop runs
+     * `buffer` times, everything else is a few ANDs - so it is cheap
+     * enough to run inside the hall lock.  `Booked` means yes.
+     */
+    [[nodiscard]] BookStatus admits(SeatMask taken, SeatMask seats, bool accessible) const noexcept
+    {
+        if (seats & taken) return BookStatus::Taken;
+        if (seats & reserved_ & (accessible ? 0u : kAllSeats)) return BookStatus::Accessible;
+
+        SeatMask halo = 0;                                   // seats within buffer
+        for (unsigned k = 1; k <= buffer_; ++k) halo |= seats << k | seats >> k;
+        if (halo & taken) return BookStatus::Distancing;
+
+        if (loneGaps(taken | seats) & ~loneGaps(taken)) return BookStatus::SingleGap;
+        return BookStatus::Booked;
+    }
+
+    // ---------------------------------------------------------------------
+    // Pricing
+    // ---------------------------------------------------------------------
+    /// Price category of seat @p index (< kCapacity).
+    [[nodiscard]] std::uint8_t tierOf(std::size_t index) const noexcept { return tier_[index]; }
+
+    /// Price of seat @p index in cents (< kCapacity).
+    [[nodiscard]] std::uint32_t priceOf(std::size_t index) const noexcept { return price_[index]; }
+
+    /**
+     * @brief Total price of the seats in @p seats, in cents.
+     *
+     * Branch-free: every seat's price is ANDed with an all-ones / all-zeros
+     * mask derived from its bit, so the loop has a fixed trip count and
+     * compiles to a handful of vector instructions.  No lock is taken -
+     * the price column is immutable.
+     */
+    [[nodiscard]] std::uint64_t quote(SeatMask seats) const noexcept
+    {
+        std::uint64_t total = 0;
+        for (std::size_t i = 0; i < kCapacity; ++i)
+            total += price_[i] & (0u - ((seats >> i) & 1u));
+        return total;
+    }
+
+    /// Same for a seat list; `std::nullopt` if an index is out of range.
+    [[nodiscard]] std::optional<std::uint64_t> quote(const std::vector<Seat>& seats) const;
+
+    /// Seat list -> mask (duplicates collapse); `std::nullopt` if an
+    /// index is out of range.
+    [[nodiscard]] static std::optional<SeatMask> maskOf(const std::vector<Seat>& seats) noexcept;
+
 private:
+    void copyCounters(const Theater& other) noexcept;
+
+    /// Seat-map part of book(); the caller holds mtx_ or owns the hall.
+    BookStatus commit(SeatMask seats, std::uint64_t price, bool accessible);
+    [[nodiscard]] std::vector<Seat> freeList() const;
+
+    /// Free seats with both neighbours in @p taken (rule on only).
+    [[nodiscard]] SeatMask loneGaps(SeatMask taken) const noexcept
+    {
+        return ~taken & (taken << 1) & (taken >> 1) & gapSeats_;
+    }
+
     // ---------------------------------------------------------------------
     // Data members
+    // Hot part first, on lines of its own: everything a booking writes or
+    // reads under the lock.  The cold part (prices, label) starts on the
+    // next line, so lock-free quote() readers on other cores keep their
+    // copies while bookings dirty the hot lines.
     // ---------------------------------------------------------------------
+    alignas(kCacheLine) mutable telemetry::Profiled<std::mutex> mtx_;   ///< Serialises seat map access.
+    std::bitset<kCapacity> occupancy_;   ///< 1 == *taken*.
+    SeatMask      reserved_ = 0;   ///< wheelchair bays
+    SeatMask      gapSeats_ = 0;   ///< seats with two neighbours, 0 = gaps allowed
+    std::uint8_t  buffer_   = 0;   ///< free seats between parties
+
+    /// sales() counters, written under mtx_ (or by the owner) only.
+    struct Counters
+    {
+        std::atomic<std::uint64_t> attempts{0}, bookings{0}, seatsSold{0},
+                                   conflicts{0}, refused{0}, revenueCents{0};
+    };
+    Counters counters_;
+
+    alignas(kCacheLine) std::array<std::uint32_t, kCapacity> price_{};   ///< cents per seat
+    std::array<std::uint8_t, kCapacity>                      tier_{};    ///< category per seat
     Id                     id_;          ///< Stable id.
     std::string            name_;        ///< Display label.
-    mutable std::mutex     mtx_;         ///< Serialises seat map access.
-    std::bitset<kCapacity> occupancy_;   ///< 1 == *taken*.
 };
 
 } // namespace booking::domain
@@ -0,0 +1,110 @@
+#ifndef THEATER_SLAB_HPP
+#define THEATER_SLAB_HPP
+
+#include "Theater.hpp"
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace booking::domain
+{
+
+/**
+ * @file TheaterSlab.hpp
+ * @brief Pool allocator for halls: @ref Theater objects (with their
+ *        `shared_ptr` control blocks) carved from large cache-line-aligned
+ *        slabs instead of one heap allocation each.
+ *
+ * ```text
+ *   slab 0  [ctl|hot|hot|cold…][ctl|hot|hot|cold…][ free ]…   kPerSlab blocks
+ *   slab 1  [ … ]                                    ▲
+ *                                   free list ───────┘ (retired halls)
+ * ```
+ *
+ * Every block starts on a cache line and is a whole number of lines long,
+ * so a hall's hot lines (lock, seat map, counters) are never shared with a
+ * neighbour - see the layout note in Theater.hpp.  make() returns an
+ * ordinary `shared_ptr<Theater>`; when the last reference goes, the block
+ * returns to the free list, which the next make() reuses first.  Slabs are
+ * released only when the slab and every hall from it are gone, so a hall
+ * may outlive the object that made it.
+ */
+class TheaterSlab
+{
+public:
+    /// Default halls per slab.
+    static constexpr std::size_t kPerSlab = 32;
+
+    explicit TheaterSlab(std::size_t perSlab = kPerSlab);
+
+    TheaterSlab(const TheaterSlab&)            = delete;
+    TheaterSlab& operator=(const TheaterSlab&) = delete;
+
+    /// New hall, constructed from @p args as by `std::make_shared`.  Thread-safe.
+    template <class... Args>
+    std::shared_ptr<Theater> make(Args&&... args) const
+    {
+        return std::allocate_shared<Theater>(Allocator<Theater>{pool_}, std::forward<Args>(args)...);
+    }
+
+    /// Halls currently alive / slabs allocated.
+    [[nodiscard]] std::size_t live() const;
+    [[nodiscard]] std::size_t slabs() const;
+
+    /// Bytes per hall, control block and padding included (0 before the first make()).
+    [[nodiscard]] std::size_t blockSize() const;
+
+private:
+    /// The slabs and their free list; kept alive by every hall's allocator.
+    class Pool
+    {
+    public:
+        explicit Pool(std::size_t perSlab) noexcept : perSlab_{perSlab} {}
+        ~Pool();
+
+        Pool(const Pool&)            = delete;
+        Pool& operator=(const Pool&) = delete;
+
+        void* allocate(std::size_t bytes, std::size_t align);
+        void  deallocate(void* p, std::size_t bytes) noexcept;
+
+        const std::size_t  perSlab_;
+        mutable std::mutex mtx_;
+        std::vector<void*> slabs_;
+        void*              free_  = nullptr;   ///< next pointer stored in the block
+        std::size_t        block_ = 0;         ///< fixed by the first allocation
+        std::size_t        live_  = 0;
+    };
+
+    /// Minimal allocator over a Pool, for `std::allocate_shared`.
+    template <class T>
+    struct Allocator
+    {
+        using value_type = T;
+
+        explicit Allocator(std::shared_ptr<Pool> p) noexcept : pool{std::move(p)} {}
+        template <class U>
+        Allocator(const Allocator<U>& o) noexcept : pool{o.pool} {}
+
+        T* allocate(std::size_t n)
+        {
+            return static_cast<T*>(pool->allocate(n * sizeof(T), alignof(T)));
+        }
+        void deallocate(T* p, std::size_t n) noexcept { pool->deallocate(p, n * sizeof(T)); }
+
+        template <class U>
+        bool operator==(const Allocator<U>& o) const noexcept { return pool == o.pool; }
+        template <class U>
+        bool operator!=(const Allocator<U>& o) const noexcept { return pool != o.pool; }
+
+        std::shared_ptr<Pool> pool;
+    };
+
+    std::shared_ptr<Pool> pool_;
+};
+
+} // namespace booking::domain
+
+#endif //THEATER_SLAB_HPP
@@ -1,7 +1,9 @@
 #ifndef BOOKING_MANAGER_HPP
 #define BOOKING_MANAGER_HPP
 
+#include "HallExecutor.hpp"
 #include "IBookingRepository.hpp"
+#include <functional>
 #include <memory>
 
 namespace booking::service
@@ -18,7 +20,14 @@ namespace booking::service
  * (in-memory, file-backed, SQL, …).
  *
  * It is therefore *stateless* and **cheap to copy / pass by value** - only the
- * shared-pointer to the repository is duplicated.
+ * shared-pointers to the repository (and executor) are duplicated.
+ *
+ * Built with a @ref HallExecutor it runs in *thread-per-core* mode: every
+ * booking and seat listing of a hall is executed by the hall's owning
+ * worker, lock-free (IBookingRepository::reserveOwned()).  The *Async
+ * calls complete on that worker; the plain calls post and wait, or run
+ * inline when already on the owner.  In this mode all bookings for the
+ * repository must go through managers sharing the same executor.
  */
 class BookingManager
 {
@@ -33,18 +42,44 @@ public:
      */
     explicit BookingManager(std::shared_ptr<IBookingRepository> repo);
 
+    /**
+     * @brief Same, in thread-per-core mode.
+     * @param owners Workers owning the halls; nullptr = shared-lock mode.
+     */
+    BookingManager(std::shared_ptr<IBookingRepository> repo,
+                   std::shared_ptr<HallExecutor>       owners);
+
     // ---------------------------------------------------------------------
     // Read-only queries (forwarded 1-to-1)
     // ---------------------------------------------------------------------
     /// List all movies currently playing.
     [[nodiscard]] std::vector<domain::Movie> movies() const;
 
+    /// Up to @p limit movies with id > @p after, ascending by id.
+    [[nodiscard]] Page<domain::Movie> moviesPage(domain::Movie::Id after, std::size_t limit) const;
+
+    /// Up to @p limit halls of movie @p m with id > @p after; `std::nullopt`
+    /// for an unknown movie.
+    [[nodiscard]] std::optional<Page<std::shared_ptr<const domain::Theater>>>
+        theatersPage(domain::Movie::Id m, domain::Theater::Id after, std::size_t limit) const;
+
+    /// Movies matching @p query, best first (at most @p limit).
+    [[nodiscard]] std::vector<domain::Movie> searchMovies(std::string_view query,
+                                                          std::size_t limit = MovieIndex::kDefaultLimit) const;
+
     /// List all theaters where @p id is screening.
     [[nodiscard]] std::vector<std::shared_ptr<const domain::Theater>>theaters(domain::Movie::Id id) const;
 
     /// Seat availability for a specific movie + hall.
     [[nodiscard]] std::vector<domain::Seat> freeSeats(domain::Movie::Id m, domain::Theater::Id t) const;
 
+    /// Price of seats @p s in cents; `std::nullopt` for an unknown hall / seat.
+    [[nodiscard]] std::optional<std::uint64_t> quote(domain::Movie::Id m, domain::Theater::Id t,
+                                                     const std::vector<domain::Seat>& s) const;
+
+    /// Booking counters of movie @p m (0 = every movie).
+    [[nodiscard]] std::vector<MovieSales> sales(domain::Movie::Id m = 0) const;
+
     // ---------------------------------------------------------------------
     // Mutation
     // ---------------------------------------------------------------------
@@ -55,8 +90,50 @@ public:
      */
     bool book(domain::Movie::Id m, domain::Theater::Id t, const std::vector<domain::Seat>& s);
 
+    /// Same, under the hall's seating rules, reporting why it was refused
+    /// or what it charged.
+    Reservation reserve(domain::Movie::Id m, domain::Theater::Id t,
+                        const std::vector<domain::Seat>& s, bool accessible = false);
+
+    /**
+     * @brief reserve() that completes asynchronously on the hall's owning
+     *        worker; @p done runs there (inline without an executor) and
+     *        must not block.
+     *
+     * On the worker, a repository that throws is reported as `NotFound`
+     * and an exception escaping @p done is dropped.
+     */
+    void reserveAsync(domain::Movie::Id m, domain::Theater::Id t,
+                      std::vector<domain::Seat> s, bool accessible,
+                      std::function<void(Reservation)> done);
+
+    /// freeSeats() completing on the hall's owning worker; an unknown hall
+    /// yields an empty list.
+    void freeSeatsAsync(domain::Movie::Id m, domain::Theater::Id t,
+                        std::function<void(std::vector<domain::Seat>)> done) const;
+
+    /// Executor in thread-per-core mode, else nullptr.
+    [[nodiscard]] const std::shared_ptr<HallExecutor>& owners() const noexcept { return owners_; }
+
+    // ---------------------------------------------------------------------
+    // Catalog maintenance (live, does not block bookings)
+    // ---------------------------------------------------------------------
+    /// Publish a new movie.
+    CatalogStatus addMovie(domain::Movie movie);
+
+    /// Open hall @p t for movie @p m with an empty seat map.
+    CatalogStatus addScreening(domain::Movie::Id m, domain::Theater::Id t, std::string name);
+
+    /// Withdraw hall @p t from movie @p m.
+    CatalogStatus retireScreening(domain::Movie::Id m, domain::Theater::Id t);
+
 private:
-    std::shared_ptr<IBookingRepository> repo_;   ///< Concrete DAO (shared).
+    /// Run @p fn on the owner of hall (m, t) and wait for its result.
+    template <class Fn>
+    auto onOwner(domain::Movie::Id m, domain::Theater::Id t, Fn fn) const;
+
+    std::shared_ptr<IBookingRepository> repo_;     ///< Concrete DAO (shared).
+    std::shared_ptr<HallExecutor>       owners_;   ///< Hall owners, or nullptr.
 };
 
 } // namespace booking::service
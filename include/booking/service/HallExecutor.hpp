@@ -0,0 +1,109 @@
+#ifndef HALL_EXECUTOR_HPP
+#define HALL_EXECUTOR_HPP
+
+#include "booking/domain/Movie.hpp"
+#include "booking/domain/Theater.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace booking::service
+{
+
+/**
+ * @file HallExecutor.hpp
+ * @brief Thread-per-core execution: every hall is owned by one pinned
+ *        worker thread, and all other threads hand it work over a
+ *        lock-free multi-producer / single-consumer queue.
+ *
+ * ```text
+ *   gRPC thread ─┐                          ┌─▶ worker 0 (cpu 0)  halls 101, 204 …
+ *   gRPC thread ─┼─▶ ownerOf(m, t) ── MPSC ─┼─▶ worker 1 (cpu 1)  halls 102, 201 …
+ *   gRPC thread ─┘                          └─▶ …
+ * ```
+ *
+ * Once every booking and seat listing of a hall runs on its owner, the
+ * seat map never leaves that core's cache and needs no lock (see
+ * IBookingRepository::reserveOwned()).  BookingManager does the routing
+ * when it is built with an executor.
+ *
+ * Each worker drains its own intrusive queue (Vyukov's MPSC list: one
+ * atomic exchange per post, no CAS loop), spins for a short while when it
+ * runs dry and then sleeps until a producer finds it asleep and wakes it.
+ */
+
+/**
+ * @class HallExecutor
+ * @brief Fixed set of worker threads, each owning a fixed share of halls.
+ *
+ * post() is safe from any thread, including the workers themselves;
+ * tasks posted by one thread to one worker run in posting order.
+ */
+class HallExecutor
+{
+public:
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Start @p workers threads (0 = one per hardware thread).
+     * @param pin Bind worker *i* to CPU *i* mod hardware threads (Linux;
+     *            ignored elsewhere).
+     */
+    explicit HallExecutor(std::size_t workers = 0, bool pin = true);
+
+    /// Runs every task already queued, then joins the workers.  Nothing
+    /// may be posted once destruction has started.
+    ~HallExecutor();
+
+    HallExecutor(const HallExecutor&)            = delete;
+    HallExecutor& operator=(const HallExecutor&) = delete;
+
+    /// Number of worker threads.
+    [[nodiscard]] std::size_t workers() const noexcept { return workers_.size(); }
+
+    /// Worker owning hall @p t of movie @p m; fixed for the executor's life.
+    [[nodiscard]] std::size_t ownerOf(domain::Movie::Id m, domain::Theater::Id t) const noexcept;
+
+    /// Worker the calling thread is, or workers() for any other thread.
+    [[nodiscard]] std::size_t current() const noexcept;
+
+    /// Queue @p task on worker @p w (< workers()); @p task must not throw.
+    void post(std::size_t w, Task task);
+
+private:
+    struct Node
+    {
+        std::atomic<Node*> next{nullptr};
+        Task               task;
+    };
+
+    struct Worker
+    {
+        alignas(64) std::atomic<Node*> tail;          ///< producers
+        alignas(64) Node*              head;          ///< consumer only
+        Node                           stub;
+        std::atomic<bool>              sleeping{false};
+        std::mutex                     mtx;           ///< parking only
+        std::condition_variable        cv;
+        std::thread                    thread;
+
+        Worker() : tail{&stub}, head{&stub} {}
+    };
+
+    static void push(Worker& w, Node* n) noexcept;
+    [[nodiscard]] static Node* pop(Worker& w) noexcept;   // nullptr if empty / mid-push
+    [[nodiscard]] static bool idle(const Worker& w) noexcept;
+    void run(std::size_t index);
+
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool>                    stop_{false};
+};
+
+} // namespace booking::service
+
+#endif //HALL_EXECUTOR_HPP
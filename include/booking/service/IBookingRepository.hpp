@@ -14,11 +14,55 @@
 // ----------------------------------------------------------------------------
 #include "booking/domain/Movie.hpp"
 #include "booking/domain/Theater.hpp"
+#include "booking/service/MovieIndex.hpp"
+#include <algorithm>
+#include <cstdint>
 #include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace booking::service {
 
+/// Outcome of a catalog mutation (see IBookingRepository::addMovie & co).
+enum class CatalogStatus : std::uint8_t
+{
+    Ok,              ///< applied
+    NotFound,        ///< movie / screening does not exist
+    AlreadyExists,   ///< id already taken
+    Invalid,         ///< malformed argument (e.g. id 0)
+    ReadOnly,        ///< standby replica, writes come from the primary only
+    Unreplicated     ///< synchronous primary: no standby confirmed the change
+};
+
+/// Outcome of a booking (see IBookingRepository::reserve).
+struct Reservation
+{
+    domain::BookStatus status     = domain::BookStatus::NotFound;
+    std::uint64_t      totalCents = 0;   ///< price charged; 0 unless booked here
+    /// `Unreplicated` only: booked and logged here, but no standby
+    /// acknowledged it in time (as opposed to refused up front).
+    bool               applied    = false;
+};
+
+/// A slice of an id-ordered listing (see IBookingRepository::moviesPage).
+template <class T>
+struct Page
+{
+    std::vector<T> items;
+    bool           more = false;   ///< further rows follow the last item
+};
+
+/// Booking counters of one movie (see IBookingRepository::sales).
+struct MovieSales
+{
+    domain::Movie::Id id = 0;
+    domain::Sales     total;                                     ///< the movie as a whole
+    std::vector<std::pair<domain::Theater::Id, domain::Sales>> halls;   ///< current halls, by id
+};
+
 /**
  * @interface IBookingRepository
  * @brief Persistence façade for the booking domain.
@@ -41,11 +85,59 @@ public:
 
     /**
      * @brief Fetch every movie currently known to the system.
-     * @return Vector of @ref booking::domain::Movie by value (cheap to copy).
+     * @return Vector of @ref booking::domain::Movie by value (cheap to copy;
+     *         the text it views stays valid as long as the repository).
      */
     [[nodiscard]]
     virtual std::vector<domain::Movie> movies() const = 0;
 
+    /**
+     * @brief Movies with id > @p after, ascending by id, at most @p limit.
+     *
+     * Keyset pagination: the id of the last movie of one page is the
+     * @p after of the next, so pages stay consistent while movies are
+     * added.  The default sorts movies(); implementations should serve the
+     * page from an ordered index instead.
+     */
+    [[nodiscard]]
+    virtual Page<domain::Movie> moviesPage(domain::Movie::Id after, std::size_t limit) const
+    {
+        auto all = movies();
+        std::sort(all.begin(), all.end(),
+                  [](const domain::Movie& a, const domain::Movie& b) { return a.id() < b.id(); });
+
+        Page<domain::Movie> page;
+        auto it = std::find_if(all.begin(), all.end(),
+                               [after](const domain::Movie& m) { return m.id() > after; });
+        for (; it != all.end() && page.items.size() < limit; ++it) page.items.push_back(*it);
+        page.more = it != all.end();
+        return page;
+    }
+
+    /**
+     * @brief Movies whose title / description match @p query, best first.
+     * @param query  Free text; every word must match a word of the movie
+     *               by prefix or with a small typo (see @ref MovieIndex).
+     * @param limit  Maximum number of results.
+     *
+     * The default indexes movies() on every call; implementations should
+     * keep a @ref MovieIndex up to date instead.
+     */
+    [[nodiscard]]
+    virtual std::vector<domain::Movie>
+        searchMovies(std::string_view query, std::size_t limit) const
+    {
+        MovieIndex index;
+        auto all = movies();
+        for (const auto& m : all) index.add(m);
+
+        std::vector<domain::Movie> out;
+        for (const auto& hit : index.search(query, limit))
+            for (auto& m : all)
+                if (m.id() == hit.id) { out.push_back(m); break; }
+        return out;
+    }
+
     /**
      * @brief Return all theaters that show a given movie.
      * @param id  Unique identifier of the movie.
@@ -59,6 +151,34 @@ public:
     virtual std::vector<std::shared_ptr<const domain::Theater>>
         theaters(domain::Movie::Id id) const = 0;
 
+    /**
+     * @brief Halls of movie @p m with id > @p after, ascending by id, at
+     *        most @p limit (keyset pagination as in moviesPage()).
+     * @return `std::nullopt` for an unknown movie; an empty page for a
+     *         movie without screenings.
+     */
+    [[nodiscard]]
+    virtual std::optional<Page<std::shared_ptr<const domain::Theater>>>
+        theatersPage(domain::Movie::Id m, domain::Theater::Id after, std::size_t limit) const
+    {
+        auto all = theaters(m);
+        if (all.empty()) {
+            const auto known = movies();
+            if (std::none_of(known.begin(), known.end(),
+                             [m](const domain::Movie& mv) { return mv.id() == m; }))
+                return std::nullopt;
+        }
+        std::sort(all.begin(), all.end(),
+                  [](const auto& a, const auto& b) { return a->id() < b->id(); });
+
+        Page<std::shared_ptr<const domain::Theater>> page;
+        auto it = std::find_if(all.begin(), all.end(),
+                               [after](const auto& t) { return t->id() > after; });
+        for (; it != all.end() && page.items.size() < limit; ++it) page.items.push_back(*it);
+        page.more = it != all.end();
+        return page;
+    }
+
     /**
      * @brief List seats that are still free for *one* movie/theater pair.
      * @param m  Movie identifier.
@@ -69,6 +189,56 @@ public:
     virtual std::vector<domain::Seat>
         freeSeats(domain::Movie::Id m, domain::Theater::Id t) const = 0;
 
+    /**
+     * @brief Price of a seat selection, whether or not the seats are free.
+     * @param m  Movie identifier.
+     * @param t  Theater identifier.
+     * @param s  Seat selection.
+     * @return   Total in cents, or `std::nullopt` for an unknown movie /
+     *           theater or a seat index out of range.
+     *
+     * The default looks the hall up through theaters(); implementations
+     * with a keyed index should override it.
+     */
+    [[nodiscard]]
+    virtual std::optional<std::uint64_t>
+        quote(domain::Movie::Id               m,
+              domain::Theater::Id             t,
+              const std::vector<domain::Seat>& s) const
+    {
+        for (const auto& hall : theaters(m))
+            if (hall->id() == t) return hall->quote(s);
+        return std::nullopt;
+    }
+
+    /**
+     * @brief Booking counters of movie @p m, or of every movie for 0,
+     *        ascending by id; empty for an unknown movie.
+     *
+     * The default sums the current halls, so a retired screening drops out
+     * of its movie's total; implementations may keep totals that persist.
+     */
+    [[nodiscard]]
+    virtual std::vector<MovieSales> sales(domain::Movie::Id m) const
+    {
+        std::vector<MovieSales> out;
+        for (const auto& mv : movies()) {
+            if (m != 0 && mv.id() != m) continue;
+            MovieSales ms;
+            ms.id = mv.id();
+            for (const auto& hall : theaters(mv.id())) {
+                ms.halls.emplace_back(hall->id(), hall->sales());
+                ms.total += ms.halls.back().second;
+            }
+            std::sort(ms.halls.begin(), ms.halls.end(),
+                      [](const auto& a, const auto& b) { return a.first < b.first; });
+            out.push_back(std::move(ms));
+        }
+        std::sort(out.begin(), out.end(),
+                  [](const MovieSales& a, const MovieSales& b) { return a.id < b.id; });
+        return out;
+    }
+
     // ── Command ────────────────────────────────────────────────────────────
 
     /**
@@ -88,6 +258,101 @@ public:
     virtual bool book(domain::Movie::Id               m,
                       domain::Theater::Id             t,
                       const std::vector<domain::Seat>& s) = 0;
+
+    /**
+     * @brief book() with the reason for a refusal and the price charged;
+     *        @p accessible bookings may take the hall's wheelchair bays.
+     *
+     * The default forwards to book(), so every refusal is reported as
+     * `Taken` and bays stay closed; the price is quote()d afterwards.
+     */
+    virtual Reservation reserve(domain::Movie::Id               m,
+                                domain::Theater::Id             t,
+                                const std::vector<domain::Seat>& s,
+                                bool                             accessible)
+    {
+        (void)accessible;
+        if (!book(m, t, s)) return {domain::BookStatus::Taken};
+        return {domain::BookStatus::Booked, quote(m, t, s).value_or(0)};
+    }
+
+    /**
+     * @brief reserve() / freeSeats() issued by the hall's owning worker in
+     *        thread-per-core mode (see HallExecutor).
+     *
+     * The caller guarantees that every booking and seat listing of hall
+     * @p t goes through one thread, so implementations may skip the hall
+     * lock (Theater::bookOwned()).  The defaults take the locking path.
+     */
+    virtual Reservation reserveOwned(domain::Movie::Id               m,
+                                     domain::Theater::Id             t,
+                                     const std::vector<domain::Seat>& s,
+                                     bool                             accessible)
+    {
+        return reserve(m, t, s, accessible);
+    }
+
+    /// @copydoc reserveOwned()
+    [[nodiscard]]
+    virtual std::vector<domain::Seat>
+        freeSeatsOwned(domain::Movie::Id m, domain::Theater::Id t) const
+    {
+        return freeSeats(m, t);
+    }
+
+    /**
+     * @brief Mark @p seats of hall @p t sold regardless of rules - replays a
+     *        booking admitted elsewhere (see Theater::occupy()).
+     *
+     * The default books through reserve() with wheelchair bays open, so
+     * other seating rules still apply to it; an already-taken seat counts
+     * as applied.
+     */
+    virtual CatalogStatus occupy(domain::Movie::Id       m,
+                                 domain::Theater::Id     t,
+                                 domain::Theater::SeatMask seats)
+    {
+        std::vector<domain::Seat> s;
+        for (std::size_t i = 0; i < domain::Theater::kCapacity; ++i)
+            if (seats >> i & 1u) s.push_back(domain::Seat::fromIndex(static_cast<std::uint8_t>(i)));
+        switch (reserve(m, t, s, true).status) {
+            case domain::BookStatus::Booked:
+            case domain::BookStatus::Taken:    return CatalogStatus::Ok;
+            case domain::BookStatus::NotFound: return CatalogStatus::NotFound;
+            case domain::BookStatus::ReadOnly: return CatalogStatus::ReadOnly;
+            case domain::BookStatus::Unreplicated: return CatalogStatus::Unreplicated;
+            default:                           return CatalogStatus::Invalid;
+        }
+    }
+
+    // ── Catalog maintenance ────────────────────────────────────────────────
+    //  Applied while the service is live.  Implementations must not stall
+    //  concurrent book() / freeSeats() calls while a mutation is in progress.
+
+    /**
+     * @brief Publish a new movie (initially without screenings).
+     *
+     * The repository keeps its own copy of the text @p movie views.
+     * @return `AlreadyExists` if the id is taken, `Invalid` for id 0.
+     */
+    virtual CatalogStatus addMovie(domain::Movie movie) = 0;
+
+    /**
+     * @brief Add an empty hall @p t showing movie @p m.
+     * @return `NotFound` for an unknown movie, `AlreadyExists` if @p m is
+     *         already screened in @p t, `Invalid` for hall id 0.
+     */
+    virtual CatalogStatus addScreening(domain::Movie::Id   m,
+                                       domain::Theater::Id t,
+                                       std::string         name) = 0;
+
+    /**
+     * @brief Remove a screening; its seat map is dropped.  When the call
+     *        returns no booking on the retired hall is still in flight.
+     * @return `NotFound` if @p m is not screened in @p t.
+     */
+    virtual CatalogStatus retireScreening(domain::Movie::Id   m,
+                                          domain::Theater::Id t) = 0;
 };
 
 } // namespace booking::service
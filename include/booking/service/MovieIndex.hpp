@@ -0,0 +1,108 @@
+#ifndef MOVIE_INDEX_HPP
+#define MOVIE_INDEX_HPP
+
+#include "booking/domain/Movie.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace booking::service
+{
+
+/**
+ * @file MovieIndex.hpp
+ * @brief In-memory full-text index over movie titles and descriptions,
+ *        backing the `SearchMovies` RPC.
+ *
+ * Text is split into lower-case ASCII alphanumeric words (*terms*).  Each
+ * distinct term gets an id, a posting list of the movies containing it and
+ * an entry in two lookup structures:
+ *
+ * ```text
+ *   query word ──▶ prefix trie ───────────────▶ terms starting with it
+ *              └─▶ trigram posting lists ─────▶ terms sharing trigrams
+ *                  ("$$d","$du","dun","une","ne$") ─▶ edit distance <= k
+ * ```
+ *
+ * Every query word must match (prefix or typo) somewhere in a movie; hits
+ * are ranked by how well each word matched and whether it matched the
+ * title or only the description.  Movies are only ever added - the
+ * catalog has no "remove movie" operation.
+ */
+
+/**
+ * @class MovieIndex
+ * @brief Prefix trie + trigram index over `Movie::title()` / `desc()`.
+ *
+ * Not thread-safe; the owner serialises add() against search().
+ */
+class MovieIndex
+{
+public:
+    /// One ranked result.
+    struct Hit
+    {
+        domain::Movie::Id id;
+        std::uint32_t     score;   ///< higher is better
+    };
+
+    /// Results returned when the caller does not ask for a count.
+    static constexpr std::size_t kDefaultLimit = 20;
+
+    /// Index @p movie; adding the same id twice indexes it twice.
+    void add(const domain::Movie& movie);
+
+    /**
+     * @brief Movies matching every word of @p query, best first.
+     *
+     * A word matches a term it is a prefix of (search-as-you-type), or -
+     * for words of 4+ characters that are not a term themselves - a term
+     * within edit distance 1 (2 from 8 characters on; substitutions,
+     * insertions, deletions and adjacent transpositions).  Ties are broken
+     * by ascending movie id.  Safe to call from several threads at once.
+     */
+    [[nodiscard]] std::vector<Hit> search(std::string_view query,
+                                          std::size_t      limit = kDefaultLimit) const;
+
+    /// Number of movies indexed.
+    [[nodiscard]] std::size_t size()  const noexcept { return ids_.size(); }
+
+    /// Number of distinct terms.
+    [[nodiscard]] std::size_t terms() const noexcept { return terms_.size(); }
+
+    /// Lower-case alphanumeric words of @p text ("Blade-Runner 2049" ->
+    /// "blade", "runner", "2049").
+    [[nodiscard]] static std::vector<std::string> tokenize(std::string_view text);
+
+private:
+    static constexpr std::uint32_t kNone = UINT32_MAX;
+
+    struct Node
+    {
+        std::vector<std::pair<char, std::uint32_t>> kids;   ///< sorted by char
+        std::uint32_t                               term = kNone;
+    };
+
+    struct Posting
+    {
+        std::uint32_t doc;      ///< ordinal into ids_
+        std::uint8_t  fields;   ///< kTitle | kDesc
+    };
+
+    std::uint32_t termOf(const std::string& word);
+    [[nodiscard]] std::uint32_t find(std::string_view prefix) const;   // node or kNone
+
+    std::vector<Node>                                          trie_{Node{}};   ///< [0] = root
+    std::vector<std::string>                                   terms_;
+    std::vector<std::vector<Posting>>                          postings_;       ///< per term
+    std::unordered_map<std::uint32_t, std::vector<std::uint32_t>> grams_;       ///< trigram -> terms
+    std::vector<domain::Movie::Id>                             ids_;            ///< per document
+};
+
+} // namespace booking::service
+
+#endif //MOVIE_INDEX_HPP
@@ -0,0 +1,93 @@
+#ifndef REPLICATING_REPOSITORY_HPP
+#define REPLICATING_REPOSITORY_HPP
+
+#include "IBookingRepository.hpp"
+#include "ReplicationLog.hpp"
+#include <memory>
+#include <shared_mutex>
+
+namespace booking::service
+{
+
+/**
+ * @file ReplicatingRepository.hpp
+ * @brief Repository decorator that records every successful write of the
+ *        primary in a @ref ReplicationLog for standby replicas.
+ *
+ * Reads go straight to the wrapped repository.  A write is applied to it
+ * first and appended to the log only if it succeeded - refused bookings
+ * are not replicated.  Bookings hold a shared *gate* across apply + append
+ * and catalog changes hold it exclusively, so a booking can never be
+ * logged after the retirement of the hall it went into; snapshot() holds
+ * it exclusively too, which makes the snapshot exactly the log prefix up
+ * to its sequence number.
+ *
+ * In synchronous mode each write then waits (outside the gate) until the
+ * standby has acknowledged it - see ReplicationLog::waitAcked().  While no
+ * standby is attached, writes are refused up front with `Unreplicated` and
+ * nothing is applied.  A write that was applied but never acknowledged
+ * (ack timeout, standby gone) is also reported `Unreplicated`, with
+ * `Reservation::applied` set for a booking; it stays applied on the
+ * primary and in the log, so to the client its outcome is unknown, as
+ * after any timeout.  Only acknowledged writes are reported successful.
+ * The wait happens on the calling thread - for reserveOwned() that is a
+ * hall's owner, which would stall every hall it owns - so a synchronous
+ * log is not meant to be combined with a HallExecutor.
+ */
+class ReplicatingRepository final : public IBookingRepository
+{
+public:
+    ReplicatingRepository(std::shared_ptr<IBookingRepository> inner,
+                          std::shared_ptr<ReplicationLog>     log);
+
+    /// The log written to.
+    [[nodiscard]] const std::shared_ptr<ReplicationLog>& log() const noexcept { return log_; }
+
+    /**
+     * @brief Current state as records (movies, screenings, sold seats per
+     *        hall), all stamped with the returned sequence number - the
+     *        last record they include.
+     */
+    std::uint64_t snapshot(std::vector<LogRecord>& out) const;
+
+    // ── IBookingRepository ───────────────────────────────────────────────
+    std::vector<domain::Movie> movies() const override;
+    Page<domain::Movie> moviesPage(domain::Movie::Id after, std::size_t limit) const override;
+    std::vector<domain::Movie> searchMovies(std::string_view query, std::size_t limit) const override;
+    std::vector<std::shared_ptr<const domain::Theater>> theaters(domain::Movie::Id id) const override;
+    std::optional<Page<std::shared_ptr<const domain::Theater>>>
+        theatersPage(domain::Movie::Id m, domain::Theater::Id after, std::size_t limit) const override;
+    std::vector<domain::Seat> freeSeats(domain::Movie::Id m, domain::Theater::Id t) const override;
+    std::vector<domain::Seat> freeSeatsOwned(domain::Movie::Id m, domain::Theater::Id t) const override;
+    std::optional<std::uint64_t> quote(domain::Movie::Id m, domain::Theater::Id t,
+                                       const std::vector<domain::Seat>& s) const override;
+    std::vector<MovieSales> sales(domain::Movie::Id m) const override;
+
+    bool book(domain::Movie::Id m, domain::Theater::Id t,
+              const std::vector<domain::Seat>& s) override;
+    Reservation reserve(domain::Movie::Id m, domain::Theater::Id t,
+                        const std::vector<domain::Seat>& s, bool accessible) override;
+    Reservation reserveOwned(domain::Movie::Id m, domain::Theater::Id t,
+                             const std::vector<domain::Seat>& s, bool accessible) override;
+    CatalogStatus occupy(domain::Movie::Id m, domain::Theater::Id t,
+                         domain::Theater::SeatMask seats) override;
+
+    CatalogStatus addMovie(domain::Movie movie) override;
+    CatalogStatus addScreening(domain::Movie::Id m, domain::Theater::Id t, std::string name) override;
+    CatalogStatus retireScreening(domain::Movie::Id m, domain::Theater::Id t) override;
+
+private:
+    template <class Apply>
+    Reservation booked(domain::Movie::Id m, domain::Theater::Id t,
+                       const std::vector<domain::Seat>& s, Apply apply);
+    template <class Apply>
+    CatalogStatus changed(LogRecord r, Apply apply);
+
+    std::shared_ptr<IBookingRepository> inner_;
+    std::shared_ptr<ReplicationLog>     log_;
+    mutable std::shared_mutex           gate_;   ///< bookings shared, catalog exclusive
+};
+
+} // namespace booking::service
+
+#endif //REPLICATING_REPOSITORY_HPP
@@ -0,0 +1,143 @@
+#ifndef REPLICATION_LOG_HPP
+#define REPLICATION_LOG_HPP
+
+#include "booking/domain/Movie.hpp"
+#include "booking/domain/Theater.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace booking::service
+{
+
+/**
+ * @file ReplicationLog.hpp
+ * @brief Ordered log of the primary's successful writes, read by standby
+ *        replicas (see ReplicatingRepository and the `Replication` RPCs).
+ *
+ * ```text
+ *   book / catalog change ── append() ─▶ [seq 41][seq 42][seq 43] ─▶ read(after)
+ *                                            ▲                        │ standby
+ *           waitAcked(43) ◀── ack(43) ───────┴────────────────────────┘
+ * ```
+ *
+ * Records get consecutive sequence numbers starting at 1.  Only the last
+ * `Config::capacity` records are kept; a standby that falls further behind
+ * (or follows a log with another epoch, i.e. a restarted primary) starts
+ * over from a snapshot.  In synchronous mode writers check ready() first
+ * and then wait in waitAcked() until a standby has applied their record;
+ * a write for which either fails must not be reported as done (see
+ * ReplicatingRepository), so a booking the client was told succeeded is
+ * on a standby and is not lost with the primary.
+ */
+
+/// One replicated write.
+struct LogRecord
+{
+    enum class Kind : std::uint8_t { Book, AddMovie, AddScreening, RetireScreening };
+
+    std::uint64_t             seq     = 0;
+    Kind                      kind    = Kind::Book;
+    domain::Movie::Id         movie   = 0;
+    domain::Theater::Id       theater = 0;
+    domain::Theater::SeatMask seats   = 0;   ///< Book
+    std::string               title;         ///< AddMovie
+    std::string               desc;          ///< AddMovie
+    std::string               name;          ///< AddScreening
+};
+
+/**
+ * @class ReplicationLog
+ * @brief Bounded in-memory write log with follower acknowledgements.
+ *
+ * Thread-safe; one mutex guards the records, followers sleep on a
+ * condition variable until there is something to read.
+ */
+class ReplicationLog
+{
+public:
+    struct Config
+    {
+        std::size_t               capacity    = 1u << 16;   ///< records kept for catch-up
+        bool                      synchronous = false;      ///< writers wait for the standby
+        std::chrono::milliseconds ackTimeout{1000};         ///< then give up waiting
+    };
+
+    ReplicationLog();
+    explicit ReplicationLog(Config cfg);
+
+    ReplicationLog(const ReplicationLog&)            = delete;
+    ReplicationLog& operator=(const ReplicationLog&) = delete;
+
+    /// Random id of this log; a standby that saw another epoch resyncs.
+    [[nodiscard]] std::uint64_t epoch() const noexcept { return epoch_; }
+
+    /// Append @p r, assigning its sequence number; returns it.
+    std::uint64_t append(LogRecord r);
+
+    /// Sequence number of the newest record, 0 when empty.
+    [[nodiscard]] std::uint64_t last() const;
+
+    /**
+     * @brief Copy up to @p max records with seq > @p after into @p out,
+     *        waiting up to @p wait for the first one.
+     * @return `false` if records after @p after were already dropped - the
+     *         reader has to resync from a snapshot.
+     */
+    bool read(std::uint64_t after, std::vector<LogRecord>& out, std::size_t max,
+              std::chrono::milliseconds wait);
+
+    /// A follower has applied everything up to @p seq.
+    void ack(std::uint64_t seq);
+
+    /// Highest acknowledged sequence number.
+    [[nodiscard]] std::uint64_t acked() const;
+
+    /// Writes can be confirmed: the log is asynchronous, or synchronous
+    /// with a follower attached and not closed.
+    [[nodiscard]] bool ready() const;
+
+    /**
+     * @brief In synchronous mode, wait until @p seq is acknowledged.
+     *
+     * Returns `true` at once when the log is asynchronous.  Otherwise
+     * `true` only once a follower acknowledged @p seq; `false` when no
+     * follower is (or stays) attached, on close(), or after `ackTimeout`
+     * (counted in ackTimeouts()).
+     */
+    bool waitAcked(std::uint64_t seq);
+
+    /// Followers streaming from this log (see attach()).
+    void attach();
+    void detach();
+    [[nodiscard]] std::size_t followers() const;
+
+    /// Waits in waitAcked() that timed out.
+    [[nodiscard]] std::uint64_t ackTimeouts() const;
+
+    /// Wake every reader and refuse to wait any more (shutdown).
+    void close();
+    [[nodiscard]] bool closed() const;
+
+private:
+    Config                      cfg_;
+    std::uint64_t               epoch_;
+    mutable std::mutex          mtx_;
+    std::condition_variable     appended_;
+    std::condition_variable     acknowledged_;
+    std::deque<LogRecord>       records_;
+    std::uint64_t               last_        = 0;
+    std::uint64_t               acked_       = 0;
+    std::size_t                 followers_   = 0;
+    std::uint64_t               ackTimeouts_ = 0;
+    bool                        closed_      = false;
+};
+
+} // namespace booking::service
+
+#endif //REPLICATION_LOG_HPP
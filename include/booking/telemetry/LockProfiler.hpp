@@ -0,0 +1,213 @@
+#ifndef LOCK_PROFILER_HPP
+#define LOCK_PROFILER_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace booking::telemetry
+{
+
+/**
+ * @file LockProfiler.hpp
+ * @brief Opt-in contention profiler for the hall and catalog locks.
+ *
+ * Build with `-DBOOKING_LOCK_PROFILING=ON` and every lock declared as
+ * `Profiled<M>` becomes a @ref ProfiledMutex that records, per **lock
+ * site** (e.g. *theater 101* or *catalog 0*):
+ *
+ * | Field          | Meaning                                              |
+ * |----------------|------------------------------------------------------|
+ * | acquisitions   | successful lock / lock_shared calls                  |
+ * | contended      | acquisitions whose first `try_lock` failed           |
+ * | wait           | total + max time spent blocked before acquiring      |
+ * | hold           | total time held in exclusive mode                    |
+ *
+ * Without the option `Profiled<M>` is an alias for `M` and
+ * @ref bindLockSite is an empty inline function - the profiler costs
+ * nothing, not even a byte of layout.
+ *
+ * The report is produced on demand by @ref LockProfiler::report (the admin
+ * RPC `GetLockReport` and `booking_client lock-report` call it).
+ */
+
+#ifdef BOOKING_LOCK_PROFILING
+inline constexpr bool kLockProfiling = true;
+#else
+inline constexpr bool kLockProfiling = false;
+#endif
+
+/// Counters of one lock site - updated with relaxed atomics.
+struct LockStats
+{
+    const char*   kind = "";         ///< site family, e.g. "theater"
+    std::uint64_t id   = 0;          ///< hall / shard id within the family
+
+    std::atomic<std::uint64_t> acquisitions{0};
+    std::atomic<std::uint64_t> contended{0};
+    std::atomic<std::uint64_t> waitNs{0};
+    std::atomic<std::uint64_t> maxWaitNs{0};
+    std::atomic<std::uint64_t> holdNs{0};
+
+    void recordWait(std::uint64_t ns) noexcept;
+};
+
+/**
+ * @class LockProfiler
+ * @brief Process-wide registry of lock sites.
+ *
+ * Sites are registered once (mutex) and never removed, so the returned
+ * `LockStats*` stays valid for the life of the process and can be cached
+ * inside the lock object.
+ */
+class LockProfiler
+{
+public:
+    /// The single process-wide instance.
+    static LockProfiler& instance();
+
+    /// Get or create the stats block for (@p kind, @p id).
+    LockStats& site(const char* kind, std::uint64_t id);
+
+    /// One consistent-enough copy of a site for reporting.
+    struct Row
+    {
+        std::string   kind;
+        std::uint64_t id = 0, acquisitions = 0, contended = 0,
+                      waitNs = 0, maxWaitNs = 0, holdNs = 0;
+    };
+
+    /// All sites, most total wait time first (then contended, acquisitions).
+    [[nodiscard]] std::vector<Row> rows() const;
+
+    /**
+     * @brief Human-readable report: per-family totals, then the @p top
+     *        most contended sites of every family.
+     */
+    void report(std::ostream& os, std::size_t top = 10) const;
+
+    /// Prometheus lines (`booking_lock_*`) for the @p top sites per family.
+    void exposition(std::ostream& os, std::size_t top = 10) const;
+
+    /// Zero all counters (sites stay registered).
+    void reset();
+
+private:
+    LockProfiler() = default;
+
+    mutable std::mutex    mtx_;
+    std::deque<LockStats> sites_;        ///< stable addresses
+};
+
+/**
+ * @class ProfiledMutex
+ * @brief Drop-in wrapper around a (shared) mutex that records wait / hold
+ *        times into a @ref LockStats site.
+ *
+ * Satisfies *Lockable* and, when @p M does, *SharedLockable*, so it works
+ * with `std::scoped_lock`, `std::unique_lock` and `std::shared_lock`.
+ * Hold time is tracked for exclusive ownership only.
+ */
+template <class M>
+class ProfiledMutex
+{
+public:
+    ProfiledMutex() = default;
+    ProfiledMutex(const ProfiledMutex&)            = delete;
+    ProfiledMutex& operator=(const ProfiledMutex&) = delete;
+
+    /// Attach to a site; until then an anonymous "unbound" site is used.
+    void bind(LockStats& s) noexcept { stats_ = &s; }
+
+    void lock()
+    {
+        const auto t0 = now();
+        if (!m_.try_lock()) {
+            stats().contended.fetch_add(1, std::memory_order_relaxed);
+            m_.lock();
+            stats().recordWait(now() - t0);
+        }
+        stats().acquisitions.fetch_add(1, std::memory_order_relaxed);
+        holdStart_ = now();
+    }
+
+    bool try_lock()
+    {
+        if (!m_.try_lock()) return false;
+        stats().acquisitions.fetch_add(1, std::memory_order_relaxed);
+        holdStart_ = now();
+        return true;
+    }
+
+    void unlock()
+    {
+        stats().holdNs.fetch_add(now() - holdStart_, std::memory_order_relaxed);
+        m_.unlock();
+    }
+
+    void lock_shared()
+    {
+        if (!m_.try_lock_shared()) {
+            const auto t0 = now();
+            stats().contended.fetch_add(1, std::memory_order_relaxed);
+            m_.lock_shared();
+            stats().recordWait(now() - t0);
+        }
+        stats().acquisitions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool try_lock_shared()
+    {
+        if (!m_.try_lock_shared()) return false;
+        stats().acquisitions.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    void unlock_shared() { m_.unlock_shared(); }
+
+private:
+    static std::uint64_t now() noexcept
+    {
+        return static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    LockStats& stats() noexcept
+    {
+        return stats_ ? *stats_ : LockProfiler::instance().site("unbound", 0);
+    }
+
+    M             m_;
+    LockStats*    stats_     = nullptr;
+    std::uint64_t holdStart_ = 0;        ///< guarded by m_ (exclusive owner)
+};
+
+#ifdef BOOKING_LOCK_PROFILING
+/// Lock type used by instrumented classes - profiled build.
+template <class M> using Profiled = ProfiledMutex<M>;
+
+/// Attach @p m to site (@p kind, @p id).
+template <class M>
+void bindLockSite(ProfiledMutex<M>& m, const char* kind, std::uint64_t id)
+{
+    m.bind(LockProfiler::instance().site(kind, id));
+}
+#else
+/// Lock type used by instrumented classes - plain mutex, zero overhead.
+template <class M> using Profiled = M;
+
+/// No-op in non-profiled builds.
+template <class M>
+inline void bindLockSite(M&, const char*, std::uint64_t) noexcept {}
+#endif
+
+} // namespace booking::telemetry
+
+#endif //LOCK_PROFILER_HPP
@@ -0,0 +1,263 @@
+#ifndef METRICS_HPP
+#define METRICS_HPP
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace booking::telemetry
+{
+
+/**
+ * @file Metrics.hpp
+ * @brief Low-overhead process metrics: striped counters, lock-free log-linear
+ *        latency histograms and a registry that renders everything in the
+ *        Prometheus text exposition format.
+ *
+ * Recording is designed for the request hot path:
+ *
+ * | Operation              | Cost (uncontended)                            |
+ * |------------------------|-----------------------------------------------|
+ * | `Counter::inc()`       | one relaxed `fetch_add` on a private stripe    |
+ * | `CounterSet::inc()`    | same, N counters sharing each stripe's line    |
+ * | `Histogram::record()`  | `clz` + two relaxed `fetch_add`s on a stripe   |
+ * | `ScopedTimer`          | the above + two `steady_clock::now()` reads    |
+ *
+ * Every metric is split into @ref kStripes cache-line-aligned stripes; a
+ * thread always writes the stripe picked for it on first use, so cores do
+ * not bounce the same line.  Readers (scrapes) sum the stripes - they are
+ * rare and may observe a slightly stale total.
+ */
+
+/// Number of cache-line stripes per metric (power of two).
+inline constexpr std::size_t kStripes = 16;
+
+/// Stripe used by the calling thread (assigned round-robin on first use).
+[[nodiscard]] inline std::size_t stripeIndex() noexcept
+{
+    static std::atomic<std::size_t> next{0};
+    thread_local const std::size_t idx =
+        next.fetch_add(1, std::memory_order_relaxed) & (kStripes - 1);
+    return idx;
+}
+
+/// Index of the highest set bit of @p v (v != 0).
+[[nodiscard]] inline unsigned msb64(std::uint64_t v) noexcept
+{
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanReverse64(&idx, v);
+    return static_cast<unsigned>(idx);
+#else
+    return 63u - static_cast<unsigned>(__builtin_clzll(v));
+#endif
+}
+
+/// Prometheus label set, e.g. `{{"rpc","book_seats"}}`.
+using Labels = std::vector<std::pair<std::string, std::string>>;
+
+/**
+ * @class Counter
+ * @brief Monotonic 64-bit counter striped across cache lines.
+ */
+class Counter
+{
+public:
+    /// Add @p n (default 1) - wait-free.
+    void inc(std::uint64_t n = 1) noexcept
+    {
+        stripes_[stripeIndex()].v.fetch_add(n, std::memory_order_relaxed);
+    }
+
+    /// Sum over all stripes.
+    [[nodiscard]] std::uint64_t value() const noexcept;
+
+private:
+    struct alignas(64) Stripe { std::atomic<std::uint64_t> v{0}; };
+    std::array<Stripe, kStripes> stripes_{};
+};
+
+/**
+ * @class CounterSet
+ * @brief @p N related counters striped together - each stripe is one
+ *        cache line holding all of them, so a thread recording one event
+ *        into several counters dirties a single line.
+ */
+template <std::size_t N>
+class CounterSet
+{
+    static_assert(N * sizeof(std::uint64_t) <= 64, "a stripe is one cache line");
+
+public:
+    /// Add @p n to counter @p i (< N) - wait-free.
+    void inc(std::size_t i, std::uint64_t n = 1) noexcept
+    {
+        stripes_[stripeIndex()].v[i].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    /// Per-counter sums over all stripes.
+    [[nodiscard]] std::array<std::uint64_t, N> values() const noexcept
+    {
+        std::array<std::uint64_t, N> out{};
+        for (const auto& s : stripes_)
+            for (std::size_t i = 0; i < N; ++i)
+                out[i] += s.v[i].load(std::memory_order_relaxed);
+        return out;
+    }
+
+private:
+    struct alignas(64) Stripe { std::array<std::atomic<std::uint64_t>, N> v{}; };
+    std::array<Stripe, kStripes> stripes_{};
+};
+
+/**
+ * @class Histogram
+ * @brief HDR-style log-linear histogram of nanosecond values.
+ *
+ * Values below 16 get exact buckets; above that every power-of-two octave
+ * is divided into 16 equal sub-buckets (≤ 6.25 % relative error) up to
+ * 2^40 ns (~18 min), larger values saturate into the last bucket.
+ */
+class Histogram
+{
+public:
+    static constexpr unsigned    kSubBits    = 4;                    ///< 16 sub-buckets
+    static constexpr unsigned    kSub        = 1u << kSubBits;
+    static constexpr unsigned    kMaxBit     = 40;                   ///< 2^40 ns cap
+    static constexpr std::size_t kBuckets    = kSub + (kMaxBit - kSubBits) * kSub;
+
+    /// Point-in-time merged copy of all stripes.
+    struct Snapshot
+    {
+        std::array<std::uint64_t, kBuckets> buckets{};
+        std::uint64_t count = 0;
+        std::uint64_t sum   = 0;       ///< nanoseconds
+
+        /// Value at quantile @p q (0..1) - upper edge of the owning bucket.
+        [[nodiscard]] std::uint64_t quantile(double q) const noexcept;
+    };
+
+    /// Record one value (ns) - wait-free.
+    void record(std::uint64_t ns) noexcept
+    {
+        auto& s = stripes_[stripeIndex()];
+        s.buckets[bucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+        s.sum.fetch_add(ns, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] Snapshot snapshot() const noexcept;
+
+    /// Bucket index for @p v (exposed for tests / exporters).
+    [[nodiscard]] static std::size_t bucketOf(std::uint64_t v) noexcept
+    {
+        if (v < kSub) return v;
+        if (v >= (std::uint64_t{1} << kMaxBit)) return kBuckets - 1;
+        const unsigned    oct = msb64(v) - kSubBits;              // 0 …
+        const std::size_t sub = (v >> oct) - kSub;
+        return kSub + oct * kSub + sub;
+    }
+
+    /// Inclusive lower edge of bucket @p b.
+    [[nodiscard]] static std::uint64_t lowerBound(std::size_t b) noexcept;
+
+    /// Exclusive upper edge of bucket @p b.
+    [[nodiscard]] static std::uint64_t upperBound(std::size_t b) noexcept;
+
+private:
+    struct alignas(64) Stripe
+    {
+        std::array<std::atomic<std::uint64_t>, kBuckets> buckets{};
+        std::atomic<std::uint64_t>                       sum{0};
+    };
+    std::unique_ptr<Stripe[]> stripes_{new Stripe[kStripes]};
+};
+
+/**
+ * @class ScopedTimer
+ * @brief Records the lifetime of the object into a histogram.  A `nullptr`
+ *        histogram turns it into a no-op (no clock reads).
+ */
+class ScopedTimer
+{
+public:
+    explicit ScopedTimer(Histogram* h) noexcept
+        : h_{h}, start_{h ? std::chrono::steady_clock::now()
+                          : std::chrono::steady_clock::time_point{}} {}
+
+    ~ScopedTimer()
+    {
+        if (h_)
+            h_->record(static_cast<std::uint64_t>(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    std::chrono::steady_clock::now() - start_).count()));
+    }
+
+    ScopedTimer(const ScopedTimer&)            = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Histogram*                            h_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @class Registry
+ * @brief Owns named metrics and renders them as Prometheus text.
+ *
+ * Registration takes a mutex and returns a reference that stays valid for
+ * the registry's lifetime; asking twice for the same name + labels returns
+ * the same object.  Recording through the reference never locks.
+ */
+class Registry
+{
+public:
+    /// Callback that appends extra exposition lines (e.g. lock statistics).
+    using Collector = std::function<void(std::ostream&)>;
+
+    Counter&   counter(const std::string& name, const std::string& help, Labels labels = {});
+    Histogram& histogram(const std::string& name, const std::string& help, Labels labels = {});
+
+    /// Register a collector that is invoked on every scrape.
+    void addCollector(Collector c);
+
+    /// Render all metrics (text format 0.0.4).
+    [[nodiscard]] std::string exposition() const;
+
+private:
+    template <class T>
+    struct Family
+    {
+        std::string help;
+        std::deque<std::pair<Labels, std::unique_ptr<T>>> series;
+    };
+
+    template <class T>
+    static T& getOrCreate(std::deque<std::pair<std::string, Family<T>>>& fams,
+                          const std::string& name, const std::string& help, Labels labels);
+
+    mutable std::mutex                                      mtx_;
+    std::deque<std::pair<std::string, Family<Counter>>>     counters_;
+    std::deque<std::pair<std::string, Family<Histogram>>>   histograms_;
+    std::vector<Collector>                                  collectors_;
+};
+
+/// Render @p labels as `{k="v",…}` (empty string for no labels).
+[[nodiscard]] std::string formatLabels(const Labels& labels);
+
+} // namespace booking::telemetry
+
+#endif //METRICS_HPP
@@ -0,0 +1,165 @@
+#ifndef TRACER_HPP
+#define TRACER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+namespace booking::telemetry
+{
+
+/**
+ * @file Tracer.hpp
+ * @brief Sampled per-request span tracing with Chrome-trace / Perfetto export.
+ *
+ * A request is traced when its root @ref TraceRequest is *sampled* (one in
+ * every `N` requests per thread, see @ref Tracer::setSampling).  While a
+ * sampled request runs, every @ref TraceSpan on the same thread records a
+ * complete event into that thread's ring buffer:
+ *
+ * | State                  | Cost per span                                  |
+ * |------------------------|------------------------------------------------|
+ * | tracing off            | one thread-local load + branch                 |
+ * | request not sampled    | same (root adds one relaxed atomic load)       |
+ * | request sampled        | two `steady_clock` reads + 7 relaxed stores    |
+ *
+ * Rings are single-producer (the owning thread) and lock-free; readers take
+ * a snapshot and drop slots that were overwritten while copying.  A reader
+ * sees at most the newest `kRingSize - 1` events per thread (the next slot
+ * to be reused is always skipped).
+ *
+ * Span names must be string literals (only the pointer is stored).
+ */
+
+/// One finished span as returned by @ref Tracer::collect.
+struct TraceEvent
+{
+    const char*   name    = "";
+    const char*   argName = nullptr;   ///< optional numeric argument
+    std::uint64_t arg     = 0;
+    std::uint64_t startNs = 0;         ///< steady_clock
+    std::uint64_t durNs   = 0;
+    std::uint64_t reqId   = 0;         ///< groups the spans of one request
+    std::uint32_t tid     = 0;         ///< tracer-assigned thread id
+};
+
+/**
+ * @class Tracer
+ * @brief Process-wide sampling switch and ring-buffer registry.
+ */
+class Tracer
+{
+public:
+    /// Events kept per thread (power of two).
+    static constexpr std::size_t kRingSize = 8192;
+
+    static Tracer& instance();
+
+    /// Trace one in every @p every requests per thread; 0 switches tracing off.
+    void setSampling(std::uint32_t every) noexcept;
+    [[nodiscard]] std::uint32_t sampling() const noexcept;
+
+    /// Snapshot of all buffered events since the last @ref clear.
+    [[nodiscard]] std::vector<TraceEvent> collect() const;
+
+    /// Render @ref collect as Chrome trace-event JSON (chrome://tracing,
+    /// Perfetto); returns the number of span events written.
+    std::size_t writeChromeJson(std::ostream& os) const;
+
+    /// Forget everything recorded so far (rings are not touched).
+    void clear() noexcept;
+
+private:
+    Tracer() = default;
+    std::atomic<std::uint64_t> clearedAt_{0};
+};
+
+namespace detail
+{
+inline std::atomic<std::uint32_t> traceEvery{0};   ///< 0 = off
+inline thread_local std::uint64_t traceReq  = 0;  ///< active sampled request
+inline thread_local std::uint32_t traceTick = 0;  ///< per-thread sample counter
+
+std::uint64_t traceNow() noexcept;
+std::uint64_t traceBegin() noexcept;               ///< new request id
+void          traceEmit(const char* name, std::uint64_t startNs, std::uint64_t endNs,
+                        const char* argName, std::uint64_t arg) noexcept;
+} // namespace detail
+
+/**
+ * @class TraceRequest
+ * @brief Root span of one request; makes the sampling decision.
+ *
+ * Nested roots on the same thread are ignored (the outer one wins).
+ */
+class TraceRequest
+{
+public:
+    explicit TraceRequest(const char* name) noexcept : name_{name}
+    {
+        const auto every = detail::traceEvery.load(std::memory_order_relaxed);
+        if (every == 0 || detail::traceReq != 0 || ++detail::traceTick < every) return;
+        detail::traceTick = 0;
+        detail::traceReq  = detail::traceBegin();
+        start_  = detail::traceNow();
+        active_ = true;
+    }
+
+    ~TraceRequest()
+    {
+        if (!active_) return;
+        detail::traceEmit(name_, start_, detail::traceNow(), argName_, arg_);
+        detail::traceReq = 0;
+    }
+
+    TraceRequest(const TraceRequest&)            = delete;
+    TraceRequest& operator=(const TraceRequest&) = delete;
+
+    /// Whether this request is being recorded.
+    [[nodiscard]] bool sampled() const noexcept { return active_; }
+
+    /// Attach one numeric argument (e.g. payload bytes) to the root span.
+    void arg(const char* name, std::uint64_t v) noexcept { argName_ = name; arg_ = v; }
+
+private:
+    const char*   name_;
+    const char*   argName_ = nullptr;
+    std::uint64_t arg_     = 0;
+    std::uint64_t start_   = 0;
+    bool          active_  = false;
+};
+
+/**
+ * @class TraceSpan
+ * @brief Child span - records only inside a sampled @ref TraceRequest.
+ */
+class TraceSpan
+{
+public:
+    explicit TraceSpan(const char* name) noexcept
+        : name_{detail::traceReq ? name : nullptr},
+          start_{name_ ? detail::traceNow() : 0} {}
+
+    ~TraceSpan() { finish(); }
+
+    TraceSpan(const TraceSpan&)            = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+
+    /// End the span before scope exit (idempotent).
+    void finish() noexcept
+    {
+        if (!name_) return;
+        detail::traceEmit(name_, start_, detail::traceNow(), nullptr, 0);
+        name_ = nullptr;
+    }
+
+private:
+    const char*   name_;
+    std::uint64_t start_;
+};
+
+} // namespace booking::telemetry
+
+#endif //TRACER_HPP
@@ -0,0 +1,211 @@
+#ifndef CATALOG_CACHE_HPP
+#define CATALOG_CACHE_HPP
+//  CatalogCache.hpp
+//  ---------------------------------------------------------------------------
+//  Client-side cache for ListMovies / ListTheaters, invalidated by the
+//  server's WatchCatalog stream instead of a TTL.
+//  ---------------------------------------------------------------------------
+#include "booking.grpc.pb.h"
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+
+namespace transport {
+
+/**
+ * @brief Caches catalog replies until the server reports a catalog change.
+ *
+ * A background thread keeps one `WatchCatalog` stream open on the channel
+ * and records the latest version it pushed.  Every cached reply carries the
+ * `catalog_version` the server stamped on it and is served only while that
+ * equals the pushed version - i.e. while the stream is live and nothing has
+ * changed since the reply was produced.
+ *
+ * ```text
+ *   movies() ─▶ entry.version == pushed ? hit : ListMovies ─▶ store
+ *   stream   ─▶ pushed = v, drop entries older than v
+ * ```
+ *
+ * While the stream is down (server restart, no feed) every call goes to the
+ * server - the cache never answers from data it cannot prove fresh.  The
+ * stream is re-opened with a short back-off.
+ *
+ * @par Thread-safety
+ *   All members may be called concurrently.
+ */
+class CatalogCache
+{
+public:
+    /// Counters for dashboards / tests.
+    struct Stats
+    {
+        std::uint64_t hits   = 0;
+        std::uint64_t misses = 0;
+    };
+
+    /// Start watching the catalog on @p channel.
+    explicit CatalogCache(std::shared_ptr<grpc::Channel> channel,
+                          std::chrono::milliseconds      reconnect = std::chrono::seconds{1})
+        : stub_{booking::Booking::NewStub(channel)}, reconnect_{reconnect}
+    {
+        watcher_ = std::thread{[this] { watch(); }};
+    }
+
+    ~CatalogCache()
+    {
+        {
+            const std::lock_guard lock{mtx_};
+            stop_ = true;
+            if (stream_) stream_->TryCancel();
+        }
+        cv_.notify_all();
+        watcher_.join();
+    }
+
+    CatalogCache(const CatalogCache&)            = delete;
+    CatalogCache& operator=(const CatalogCache&) = delete;
+
+    /// `ListMovies`, served locally while the catalog is unchanged.
+    grpc::Status movies(booking::MovieList* out)
+    {
+        return fetch([this]() -> auto& { return movies_; }, out,
+                     [&](grpc::ClientContext* ctx, booking::MovieList* rep) {
+                         return stub_->ListMovies(ctx, booking::ListMoviesReq{}, rep);
+                     });
+    }
+
+    /// `ListTheaters` for @p movie, served locally while the catalog is
+    /// unchanged.  Errors (e.g. `NOT_FOUND`) are not cached.
+    grpc::Status theaters(std::uint32_t movie, booking::TheaterList* out)
+    {
+        return fetch([this, movie]() -> auto& { return theaters_[movie]; }, out,
+                     [&](grpc::ClientContext* ctx, booking::TheaterList* rep) {
+                         booking::ListTheatersReq req;
+                         req.set_movie_id(movie);
+                         return stub_->ListTheaters(ctx, req, rep);
+                     });
+    }
+
+    /// Latest version pushed by the server, 0 while the stream is down.
+    [[nodiscard]] std::uint64_t version() const
+    {
+        const std::lock_guard lock{mtx_};
+        return pushed_;
+    }
+
+    /// Block until the stream is live (or @p timeout elapses).
+    bool waitLive(std::chrono::milliseconds timeout) const
+    {
+        std::unique_lock lock{mtx_};
+        return cv_.wait_for(lock, timeout, [&] { return pushed_ != 0; });
+    }
+
+    [[nodiscard]] Stats stats() const
+    {
+        return {hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed)};
+    }
+
+private:
+    /// One cached reply + the catalog version it was produced at.
+    template <class Rep>
+    struct Entry
+    {
+        std::optional<Rep> reply;
+        std::uint64_t      version = 0;
+    };
+
+    /// @p entry yields the cache slot; only called with mtx_ held because
+    /// the watcher may drop slots at any time.
+    template <class Slot, class Rep, class Call>
+    grpc::Status fetch(Slot entry, Rep* out, Call call)
+    {
+        {
+            const std::lock_guard lock{mtx_};
+            auto& slot = entry();
+            if (slot.reply && pushed_ != 0 && slot.version == pushed_) {
+                *out = *slot.reply;
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return grpc::Status::OK;
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+
+        grpc::ClientContext ctx;
+        Rep rep;
+        const auto st = call(&ctx, &rep);
+        if (!st.ok()) return st;
+
+        {
+            // replies older than the last push are already stale; version 0
+            // means the server has no feed, so nothing is ever cacheable
+            const std::lock_guard lock{mtx_};
+            auto& slot = entry();
+            if (rep.catalog_version() != 0 && rep.catalog_version() >= pushed_
+                && rep.catalog_version() >= slot.version) {
+                slot.reply   = rep;
+                slot.version = rep.catalog_version();
+            }
+        }
+        *out = std::move(rep);
+        return grpc::Status::OK;
+    }
+
+    /// Watcher thread: keep a WatchCatalog stream open, apply pushes.
+    void watch()
+    {
+        for (;;) {
+            grpc::ClientContext ctx;
+            {
+                const std::lock_guard lock{mtx_};
+                if (stop_) return;
+                stream_ = &ctx;
+            }
+            auto reader = stub_->WatchCatalog(&ctx, booking::Empty{});
+            booking::CatalogVersion v;
+            while (reader->Read(&v)) {
+                {
+                    const std::lock_guard lock{mtx_};
+                    pushed_ = v.version();
+                    if (movies_.version < pushed_) movies_ = {};
+                    for (auto it = theaters_.begin(); it != theaters_.end();)
+                        it = it->second.version < pushed_ ? theaters_.erase(it) : std::next(it);
+                }
+                cv_.notify_all();
+            }
+            (void)reader->Finish();
+
+            std::unique_lock lock{mtx_};
+            stream_ = nullptr;
+            pushed_ = 0;                    // unknown until the next stream says otherwise
+            movies_ = {};
+            theaters_.clear();
+            if (cv_.wait_for(lock, reconnect_, [&] { return stop_; })) return;
+        }
+    }
+
+    std::unique_ptr<booking::Booking::Stub> stub_;
+    std::chrono::milliseconds               reconnect_;
+
+    mutable std::mutex                      mtx_;
+    mutable std::condition_variable         cv_;
+    std::uint64_t                           pushed_ = 0;
+    Entry<booking::MovieList>               movies_;
+    std::unordered_map<std::uint32_t, Entry<booking::TheaterList>> theaters_;
+    grpc::ClientContext*                    stream_ = nullptr;
+    bool                                    stop_   = false;
+
+    std::atomic<std::uint64_t>              hits_{0};
+    std::atomic<std::uint64_t>              misses_{0};
+    std::thread                             watcher_;
+};
+
+} // namespace transport
+
+#endif //CATALOG_CACHE_HPP
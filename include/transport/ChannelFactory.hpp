@@ -2,13 +2,22 @@
 #define CHANNEL_FACTORY_HPP
 //  ChannelFactory.hpp
 //  ---------------------------------------------------------------------------
-//  Helpers that build gRPC client-side channels for network (TCP) or local
-//  domain-socket (IPC) transport.
+//  Helpers that build gRPC client-side channels for network (TCP), local
+//  domain-socket (IPC) or in-process transport, plus a pool of K
+//  connections with transparent retries and client-side hedging for
+//  idempotent reads.
 //  ---------------------------------------------------------------------------
 #include "Endpoints.hpp"
 #include <grpcpp/grpcpp.h>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <sstream>
 #include <string>
+#include <vector>
 
 namespace transport {
 
@@ -21,38 +30,338 @@ namespace transport {
  *
  * @param host Remote host, defaults to `"localhost"`.
  * @param port TCP port, defaults to `50051`.
+ * @param args Extra channel arguments (e.g. a distinct `grpc.channel_id`
+ *             to force a separate connection per channel).
  * @return A shared `grpc::Channel` ready for use with a generated Stub.
  *
  * @note Blocking dial-up is deferred until the first RPC.
  */
 inline std::shared_ptr<grpc::Channel>
-makeNetworkChannel(const std::string& host = "localhost", int port = 50051)
+makeNetworkChannel(const std::string& host = "localhost", int port = 50051,
+                   const grpc::ChannelArguments& args = {})
 {
-    return grpc::CreateChannel(
+    return grpc::CreateCustomChannel(
         Endpoints::tcp(host, port),
-        grpc::InsecureChannelCredentials());
+        grpc::InsecureChannelCredentials(), args);
 }
 
 /**
  * @brief Create a *local* (IPC) gRPC channel over a Unix-domain socket.
  *
  * @param path Filesystem path of the socket (default: `/tmp/booking.sock`).
+ * @param args Extra channel arguments, see makeNetworkChannel().
  * @return A shared channel, or `nullptr` on Windows where UDS is unsupported.
  *
  * The helper is a no-op stub on Windows to allow cross-platform compilation.
  */
 inline std::shared_ptr<grpc::Channel>
-makeLocalChannel(const std::string& path = "/tmp/booking.sock")
+makeLocalChannel(const std::string& path = "/tmp/booking.sock",
+                 const grpc::ChannelArguments& args = {})
 {
 #ifndef _WIN32
-    return grpc::CreateChannel(
+    return grpc::CreateCustomChannel(
         Endpoints::ipc(path),
-        grpc::InsecureChannelCredentials());
+        grpc::InsecureChannelCredentials(), args);
 #else
-    (void)path;
+    (void)path; (void)args;
     return nullptr;             // IPC not available on Windows
 #endif
 }
 
+/**
+ * @brief Create an *in-process* channel to a server in the same process.
+ *
+ * No socket, no HTTP/2 framing, no syscalls: calls are handed to @p server
+ * directly (see EmbeddedServer.hpp for a ready-made host).  The server
+ * needs no listening port for this.
+ *
+ * @param server A started `grpc::Server`; must outlive the channel.
+ * @param args   Extra channel arguments, see makeNetworkChannel().
+ */
+inline std::shared_ptr<grpc::Channel>
+makeInProcessChannel(grpc::Server& server, const grpc::ChannelArguments& args = {})
+{
+    return server.InProcessChannel(args);
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  Channel pool
+// ─────────────────────────────────────────────────────────────────────────────
+
+/// Booking RPCs that only read state and are therefore safe to repeat.
+inline const std::vector<std::string>& idempotentReads()
+{
+    static const std::vector<std::string> names{
+        "ListMovies", "SearchMovies", "ListTheaters", "ListFreeSeats", "QueueStatus",
+        "QuotePrice"};
+    return names;
+}
+
+/**
+ * @brief gRPC service config that retries the idempotent reads.
+ *
+ * Attempts failing with `UNAVAILABLE` (connection reset, server restart)
+ * are retried with exponential backoff; `BookSeats` / `JoinQueue` are never
+ * retried.  gRPC C-core does not implement the service-config
+ * `hedgingPolicy` (and a method may carry only one of the two), so hedging
+ * is done on the client with hedgedCall().
+ *
+ * @param maxAttempts Total attempts per call including the first (2…5).
+ */
+inline std::string readRetryServiceConfig(int maxAttempts = 3)
+{
+    std::ostringstream os;
+    os << R"({"methodConfig":[{"name":[)";
+    const auto& reads = idempotentReads();
+    for (std::size_t i = 0; i < reads.size(); ++i)
+        os << (i ? "," : "") << R"({"service":"booking.Booking","method":")" << reads[i] << "\"}";
+    os << R"(],"retryPolicy":{"maxAttempts":)" << maxAttempts
+       << R"(,"initialBackoff":"0.01s","maxBackoff":"0.2s","backoffMultiplier":2,)"
+       << R"("retryableStatusCodes":["UNAVAILABLE"]}}]})";
+    return os.str();
+}
+
+/// Settings for makeChannelPool() / makeLocalChannelPool().
+struct PoolOptions
+{
+    std::size_t size        = 4;      ///< connections (≥ 1)
+    bool        retryReads  = true;   ///< apply readRetryServiceConfig()
+    int         maxAttempts = 3;      ///< retry attempts per read
+};
+
+/**
+ * @class ChannelPool
+ * @brief K independent connections to one server, handed out round-robin.
+ *
+ * One HTTP/2 connection caps a client at its concurrent-stream limit and
+ * one transport thread; spreading calls over several connections removes
+ * that bottleneck.  Each channel carries a distinct `grpc.channel_id` so
+ * gRPC does not collapse them onto a shared subchannel.
+ *
+ * next() is lock-free and safe to call from any thread.
+ */
+class ChannelPool
+{
+public:
+    explicit ChannelPool(std::vector<std::shared_ptr<grpc::Channel>> channels)
+        : channels_{std::move(channels)} {}
+
+    /// Next channel in round-robin order.
+    [[nodiscard]] const std::shared_ptr<grpc::Channel>& next() const noexcept
+    {
+        return channels_[pick()];
+    }
+
+    /// Round-robin index into channels() / stubs().
+    [[nodiscard]] std::size_t pick() const noexcept
+    {
+        return rr_->fetch_add(1, std::memory_order_relaxed) % channels_.size();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return channels_.size(); }
+
+    [[nodiscard]] const std::vector<std::shared_ptr<grpc::Channel>>& channels() const noexcept
+    {
+        return channels_;
+    }
+
+    /// One `Service::Stub` per pooled channel, same order as channels().
+    template <class Service>
+    [[nodiscard]] std::vector<std::unique_ptr<typename Service::Stub>> stubs() const
+    {
+        std::vector<std::unique_ptr<typename Service::Stub>> out;
+        for (const auto& ch : channels_) out.push_back(Service::NewStub(ch));
+        return out;
+    }
+
+private:
+    std::vector<std::shared_ptr<grpc::Channel>> channels_;
+    std::unique_ptr<std::atomic<std::size_t>>    rr_ = std::make_unique<std::atomic<std::size_t>>(0);
+};
+
+namespace detail {
+inline grpc::ChannelArguments poolArgs(const PoolOptions& o, std::size_t i)
+{
+    grpc::ChannelArguments args;
+    args.SetInt("grpc.channel_id", static_cast<int>(i));
+    if (o.retryReads) args.SetServiceConfigJSON(readRetryServiceConfig(o.maxAttempts));
+    else              args.SetInt(GRPC_ARG_ENABLE_RETRIES, 0);
+    return args;
+}
+} // namespace detail
+
+/// Pool of @p opts.size TCP connections to @p host:@p port.
+inline ChannelPool
+makeChannelPool(const std::string& host = "localhost", int port = 50051,
+                const PoolOptions& opts = {})
+{
+    std::vector<std::shared_ptr<grpc::Channel>> chs;
+    for (std::size_t i = 0; i < std::max<std::size_t>(1, opts.size); ++i)
+        chs.push_back(makeNetworkChannel(host, port, detail::poolArgs(opts, i)));
+    return ChannelPool{std::move(chs)};
+}
+
+/// Pool of @p opts.size Unix-domain-socket connections (empty on Windows).
+inline ChannelPool
+makeLocalChannelPool(const std::string& path = "/tmp/booking.sock",
+                     const PoolOptions& opts = {})
+{
+    std::vector<std::shared_ptr<grpc::Channel>> chs;
+    for (std::size_t i = 0; i < std::max<std::size_t>(1, opts.size); ++i)
+        if (auto ch = makeLocalChannel(path, detail::poolArgs(opts, i))) chs.push_back(std::move(ch));
+    return ChannelPool{std::move(chs)};
+}
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  Hedged reads
+// ─────────────────────────────────────────────────────────────────────────────
+
+/**
+ * @class HedgeBudget
+ * @brief Caps hedges to a fraction of calls (token bucket).
+ *
+ * Every call earns `ratio` tokens (up to `burst`), every hedge spends one.
+ * Without a budget a slow server draws hedges from *every* call, doubling
+ * its load exactly when it can least afford it.  Share one budget between
+ * all callers of a pool.
+ */
+class HedgeBudget
+{
+public:
+    explicit HedgeBudget(double ratio = 0.1, double burst = 10) noexcept
+        : earn_{static_cast<std::int64_t>(ratio * kScale)},
+          cap_{static_cast<std::int64_t>(burst * kScale)}, tokens_{cap_} {}
+
+    /// Credit one call.
+    void earn() noexcept
+    {
+        auto t = tokens_.load(std::memory_order_relaxed);
+        while (t < cap_ && !tokens_.compare_exchange_weak(
+                   t, std::min(cap_, t + earn_), std::memory_order_relaxed)) {}
+    }
+
+    /// Take one hedge token; false when the budget is exhausted.
+    [[nodiscard]] bool spend() noexcept
+    {
+        auto t = tokens_.load(std::memory_order_relaxed);
+        while (t >= kScale) {
+            if (tokens_.compare_exchange_weak(t, t - kScale, std::memory_order_relaxed))
+                return true;
+        }
+        return false;
+    }
+
+private:
+    static constexpr std::int64_t kScale = 1000;     // fixed-point tokens
+    std::int64_t              earn_;
+    std::int64_t              cap_;
+    std::atomic<std::int64_t> tokens_;
+};
+
+/// When and how often hedgedCall() sends a backup attempt.
+struct HedgePolicy
+{
+    int                       maxAttempts = 2;                         ///< incl. the first
+    std::chrono::microseconds delay{2000};                             ///< before each hedge
+    std::chrono::milliseconds deadline{5000};                          ///< whole call
+    HedgeBudget*              budget = nullptr;                        ///< nullptr = unlimited
+};
+
+template <class Stub, class Req, class Rep>
+using AsyncUnary = std::unique_ptr<grpc::ClientAsyncResponseReader<Rep>>
+                   (Stub::*)(grpc::ClientContext*, const Req&, grpc::CompletionQueue*);
+
+/**
+ * @brief Issue an idempotent unary read with hedging across pooled stubs.
+ *
+ * The first attempt goes to `stubs[first]`; if no reply has arrived after
+ * `policy.delay` (or the attempt failed with `UNAVAILABLE` /
+ * `RESOURCE_EXHAUSTED`) another attempt is sent on the next stub, i.e. a
+ * different connection, up to `policy.maxAttempts`.  The first final reply
+ * wins and the remaining attempts are cancelled.
+ *
+ * Only use for reads - a hedged write may be applied more than once.
+ *
+ * ```cpp
+ * auto stubs = pool.stubs<booking::Booking>();
+ * booking::SeatList seats;
+ * auto st = transport::hedgedCall(stubs, pool.pick(),
+ *                                 &booking::Booking::Stub::AsyncListFreeSeats,
+ *                                 req, &seats, {2, std::chrono::milliseconds{5}});
+ * ```
+ */
+template <class Stub, class Req, class Rep>
+grpc::Status hedgedCall(const std::vector<std::unique_ptr<Stub>>& stubs, std::size_t first,
+                        AsyncUnary<Stub, Req, Rep> method, const Req& req, Rep* out,
+                        const HedgePolicy& policy = {})
+{
+    struct Attempt {
+        grpc::ClientContext ctx;
+        Rep                 rep;
+        grpc::Status        status;
+        std::unique_ptr<grpc::ClientAsyncResponseReader<Rep>> reader;
+    };
+
+    const auto deadline = std::chrono::system_clock::now() + policy.deadline;
+    const auto maxAttempts = static_cast<std::size_t>(std::max(1, policy.maxAttempts));
+    grpc::CompletionQueue cq;
+    std::vector<std::unique_ptr<Attempt>> attempts;
+    std::size_t pending = 0;
+    auto nextHedge = std::chrono::system_clock::time_point::max();
+
+    auto launch = [&] {
+        const std::size_t i = attempts.size();
+        auto& a = *attempts.emplace_back(std::make_unique<Attempt>());
+        a.ctx.set_deadline(deadline);
+        a.reader = (stubs[(first + i) % stubs.size()].get()->*method)(&a.ctx, req, &cq);
+        a.reader->Finish(&a.rep, &a.status, reinterpret_cast<void*>(i));
+        ++pending;
+        nextHedge = attempts.size() < maxAttempts
+            ? std::chrono::system_clock::now() + policy.delay
+            : std::chrono::system_clock::time_point::max();
+    };
+    auto nonFatal = [](const grpc::Status& st) {
+        return st.error_code() == grpc::StatusCode::UNAVAILABLE
+            || st.error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED;
+    };
+
+    if (policy.budget) policy.budget->earn();
+    launch();
+    grpc::Status result;
+    bool done = false;
+    while (pending > 0) {
+        void* tag = nullptr;
+        bool  ok  = false;
+        // every attempt carries the deadline, so a blocking Next() returns
+        const bool canHedge = !done && attempts.size() < maxAttempts;
+        const auto ev = canHedge ? cq.AsyncNext(&tag, &ok, nextHedge)
+                      : cq.Next(&tag, &ok) ? grpc::CompletionQueue::GOT_EVENT
+                                           : grpc::CompletionQueue::SHUTDOWN;
+        if (ev == grpc::CompletionQueue::TIMEOUT) {
+            if (!policy.budget || policy.budget->spend()) launch();
+            else nextHedge = std::chrono::system_clock::time_point::max();   // wait it out
+            continue;
+        }
+        if (ev != grpc::CompletionQueue::GOT_EVENT) break;
+
+        --pending;
+        auto& a = *attempts[reinterpret_cast<std::size_t>(tag)];
+        if (done) continue;                              // draining losers
+        if (!nonFatal(a.status) || (pending == 0 && attempts.size() >= maxAttempts)) {
+            done   = true;
+            result = a.status;
+            if (a.status.ok()) *out = std::move(a.rep);
+            for (auto& other : attempts) other->ctx.TryCancel();
+        } else if (attempts.size() < maxAttempts) {
+            launch();                                    // failed fast - hedge now
+        }
+    }
+    cq.Shutdown();
+    void* tag = nullptr;
+    bool  ok  = false;
+    while (cq.Next(&tag, &ok)) {}
+    return result;
+}
+
 } // namespace transport
 #endif //CHANNEL_FACTORY_HPP
\ No newline at end of file
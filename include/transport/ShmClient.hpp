@@ -0,0 +1,164 @@
+#ifndef SHM_CLIENT_HPP
+#define SHM_CLIENT_HPP
+//  ShmClient.hpp
+//  ---------------------------------------------------------------------------
+//  Client side of the shared-memory booking transport (see ShmRing.hpp and
+//  grpc/ShmServer.hpp).  Linux only.
+//  ---------------------------------------------------------------------------
+#include "ShmRing.hpp"
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+namespace transport::shm {
+
+#ifdef __linux__
+/**
+ * @brief One connection to a ShmServer.
+ *
+ * The constructor creates a memfd holding a @ref Segment, hands the fd to
+ * the server over the rendezvous Unix socket (`SCM_RIGHTS`) and maps it.
+ * From then on every call is a frame pushed to the request ring and a
+ * frame popped from the reply ring - no syscall unless one side has to
+ * sleep.
+ *
+ * A client is a single producer / single consumer: use one per thread.
+ */
+class Client
+{
+public:
+    /// Connect to the server listening on @p path; throws `std::runtime_error`.
+    explicit Client(const std::string& path = kDefaultPath, unsigned spins = 2000)
+        : spins_{spins}
+    {
+        fd_ = ::memfd_create("booking-shm", MFD_CLOEXEC);
+        if (fd_ < 0) fail("memfd_create");
+        if (::ftruncate(fd_, sizeof(Segment)) != 0) fail("ftruncate");
+        void* mem = ::mmap(nullptr, sizeof(Segment), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mem == MAP_FAILED) fail("mmap");
+        seg_ = new (mem) Segment{};
+
+        sock_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (sock_ < 0) fail("socket");
+        sockaddr_un addr{};
+        addr.sun_family = AF_UNIX;
+        if (path.size() >= sizeof(addr.sun_path)) { errno = ENAMETOOLONG; fail("connect"); }
+        std::memcpy(addr.sun_path, path.c_str(), path.size() + 1);
+        if (::connect(sock_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) fail("connect " + path);
+
+        char byte = 0;
+        iovec iov{&byte, 1};
+        alignas(cmsghdr) char ctrl[CMSG_SPACE(sizeof(int))]{};
+        msghdr msg{};
+        msg.msg_iov        = &iov;
+        msg.msg_iovlen     = 1;
+        msg.msg_control    = ctrl;
+        msg.msg_controllen = sizeof(ctrl);
+        cmsghdr* c = CMSG_FIRSTHDR(&msg);
+        c->cmsg_level = SOL_SOCKET;
+        c->cmsg_type  = SCM_RIGHTS;
+        c->cmsg_len   = CMSG_LEN(sizeof(int));
+        std::memcpy(CMSG_DATA(c), &fd_, sizeof(int));
+        if (::sendmsg(sock_, &msg, MSG_NOSIGNAL) != 1) fail("sendmsg");
+
+        // the server acknowledges with one byte once the segment is checked
+        if (::recv(sock_, &byte, 1, 0) != 1 || byte != 1) {
+            errno = ECONNREFUSED;
+            fail("handshake");
+        }
+    }
+
+    ~Client() { release(); }
+
+    Client(const Client&)            = delete;
+    Client& operator=(const Client&) = delete;
+
+    /// Free seats of a hall as a bit mask (`NotFound`: unknown or sold out).
+    Status freeSeats(std::uint32_t movie, std::uint32_t theater, std::uint32_t& mask)
+    {
+        Frame f;
+        f.op      = Op::FreeSeats;
+        f.movie   = movie;
+        f.theater = theater;
+        const Frame r = call(f);
+        mask = r.seats;
+        return r.status;
+    }
+
+    /// Book every seat in @p mask, all or nothing; @p accessible as in BookSeats.
+    Status book(std::uint32_t movie, std::uint32_t theater, std::uint32_t mask,
+                std::uint64_t token = 0, bool accessible = false)
+    {
+        Frame f;
+        f.op      = Op::Book;
+        f.movie   = movie;
+        f.theater = theater;
+        f.seats   = mask;
+        f.token   = token;
+        f.flags   = accessible ? kAccessible : 0;
+        return call(f).status;
+    }
+
+    /// Empty round trip.
+    Status ping() { return call(Frame{}).status; }
+
+    /// Send @p req and wait for its reply; throws once the server is gone.
+    Frame call(Frame req)
+    {
+        req.id = ++nextId_;
+        while (!seg_->requests.push(req)) check();
+        Frame rep;
+        for (;;) {
+            if (seg_->replies.popWait(rep, spins_, 100'000'000) && rep.id == req.id)
+                return rep;
+            check();
+        }
+    }
+
+private:
+    void check() const
+    {
+        if (seg_->closed.load(std::memory_order_acquire))
+            throw std::runtime_error("shm: server closed the connection");
+    }
+
+    [[noreturn]] void fail(const std::string& what)
+    {
+        const std::string msg = "shm: " + what + ": " + std::strerror(errno);
+        release();
+        throw std::runtime_error(msg);
+    }
+
+    void release() noexcept
+    {
+        if (seg_) {
+            seg_->closed.store(1, std::memory_order_release);
+            seg_->requests.sleeping.store(0);
+            futexWake(seg_->requests.sleeping);       // server thread notices
+            ::munmap(seg_, sizeof(Segment));
+            seg_ = nullptr;
+        }
+        if (sock_ >= 0) { ::close(sock_); sock_ = -1; }
+        if (fd_ >= 0)   { ::close(fd_);   fd_   = -1; }
+    }
+
+    int           fd_   = -1;
+    int           sock_ = -1;
+    Segment*      seg_  = nullptr;
+    unsigned      spins_;
+    std::uint64_t nextId_ = 0;
+};
+#endif // __linux__
+
+} // namespace transport::shm
+
+#endif //SHM_CLIENT_HPP
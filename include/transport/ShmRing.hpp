@@ -0,0 +1,192 @@
+#ifndef SHM_RING_HPP
+#define SHM_RING_HPP
+//  ShmRing.hpp
+//  ---------------------------------------------------------------------------
+//  Wire format of the shared-memory booking transport: a segment holding two
+//  lock-free single-producer / single-consumer rings of fixed 32-byte
+//  frames, with futex wake-ups when a side goes to sleep.  Linux only.
+//  ---------------------------------------------------------------------------
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace transport::shm {
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  Frames
+// ─────────────────────────────────────────────────────────────────────────────
+
+/// Operation carried by a request frame.
+enum class Op : std::uint8_t
+{
+    Ping      = 0,   ///< round-trip only
+    FreeSeats = 1,   ///< reply `seats` = mask of free seats
+    Book      = 2,   ///< book every seat in `seats`, all or nothing
+};
+
+/// Outcome carried by a reply frame (mirrors the gRPC status codes).
+enum class Status : std::uint8_t
+{
+    Ok        = 0,
+    Conflict  = 1,   ///< ALREADY_EXISTS - a seat was taken
+    NotFound  = 2,   ///< unknown hall, or no seat left
+    Invalid   = 3,   ///< bad op / seat mask
+    Denied    = 4,   ///< FAILED_PRECONDITION - waiting-room token not admitted / used up
+    Refused   = 5,   ///< FAILED_PRECONDITION - seating rule (bay, distancing, gap)
+    Unavailable = 6, ///< UNAVAILABLE - read-only standby, or no standby confirmed it
+};
+
+/// `Frame::flags` bits.
+inline constexpr std::uint8_t kAccessible = 0x01;   ///< Book: may take wheelchair bays
+
+/**
+ * @brief One request or reply.  Seats are a bit mask (bit i == seat index
+ *        i), which covers the fixed 20-seat row without any allocation.
+ */
+struct Frame
+{
+    std::uint64_t id      = 0;   ///< echoed in the reply
+    std::uint64_t token   = 0;   ///< waiting-room token (Book)
+    std::uint32_t movie   = 0;
+    std::uint32_t theater = 0;
+    std::uint32_t seats   = 0;   ///< request: seats to book / reply: free seats
+    Op            op      = Op::Ping;
+    Status        status  = Status::Ok;
+    std::uint8_t  flags   = 0;   ///< request: `kAccessible`
+    std::uint8_t  reserved = 0;
+};
+static_assert(sizeof(Frame) == 32, "Frame is part of the wire format");
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  Futex helpers (shared, not FUTEX_PRIVATE: the word lives in a mapping
+//  shared between processes)
+// ─────────────────────────────────────────────────────────────────────────────
+#ifdef __linux__
+/// Sleep while `*word == expected`, at most @p timeoutNs (0 = forever).
+inline void futexWait(std::atomic<std::uint32_t>& word, std::uint32_t expected,
+                      std::int64_t timeoutNs = 0) noexcept
+{
+    static_assert(sizeof(std::atomic<std::uint32_t>) == sizeof(std::uint32_t));
+    timespec ts{static_cast<time_t>(timeoutNs / 1'000'000'000),
+                static_cast<long>(timeoutNs % 1'000'000'000)};
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAIT, expected,
+              timeoutNs > 0 ? &ts : nullptr, nullptr, 0);
+}
+
+inline void futexWake(std::atomic<std::uint32_t>& word) noexcept
+{
+    ::syscall(SYS_futex, reinterpret_cast<std::uint32_t*>(&word), FUTEX_WAKE, 1,
+              nullptr, nullptr, 0);
+}
+#endif
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  SPSC ring
+// ─────────────────────────────────────────────────────────────────────────────
+
+/**
+ * @brief Bounded single-producer / single-consumer queue of Frames that
+ *        lives inside the shared segment (no pointers, no ctor work beyond
+ *        zeroing).
+ *
+ * `tail` is written only by the producer, `head` only by the consumer,
+ * each on its own cache line.  A consumer that finds the ring empty spins
+ * briefly, then raises `sleeping` and futex-waits on it; a producer that
+ * publishes a frame clears `sleeping` and wakes it.  Both sides use
+ * sequentially consistent accesses on `tail` / `sleeping`, so a wake-up
+ * can never be lost between the consumer's last check and its sleep.
+ */
+template <std::uint32_t N>
+struct Ring
+{
+    static_assert((N & (N - 1)) == 0, "ring size must be a power of two");
+    static constexpr std::uint32_t kSize = N;
+
+    alignas(64) std::atomic<std::uint32_t> tail{0};       ///< producer cursor
+    alignas(64) std::atomic<std::uint32_t> head{0};       ///< consumer cursor
+    alignas(64) std::atomic<std::uint32_t> sleeping{0};   ///< futex word
+    alignas(64) Frame                      slots[N];
+
+    /// Producer: append @p f; `false` when the ring is full.
+    bool push(const Frame& f) noexcept
+    {
+        const auto t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) >= N) return false;
+        slots[t & (N - 1)] = f;
+        tail.store(t + 1, std::memory_order_seq_cst);
+#ifdef __linux__
+        if (sleeping.load(std::memory_order_seq_cst) && sleeping.exchange(0))
+            futexWake(sleeping);
+#endif
+        return true;
+    }
+
+    /// Consumer: take the oldest frame; `false` when the ring is empty.
+    bool pop(Frame& f) noexcept
+    {
+        const auto h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return false;
+        f = slots[h & (N - 1)];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Consumer: wait for a frame.  Spins @p spins times, then sleeps
+     *        on the futex for at most @p timeoutNs (0 = forever).
+     * @return `false` on time-out (the caller re-checks its stop condition).
+     */
+    bool popWait(Frame& f, unsigned spins, std::int64_t timeoutNs = 0) noexcept
+    {
+        for (unsigned i = 0; i < spins; ++i)
+            if (pop(f)) return true;
+        for (;;) {
+            if (pop(f)) return true;
+#ifdef __linux__
+            sleeping.store(1, std::memory_order_seq_cst);
+            if (head.load(std::memory_order_relaxed) != tail.load(std::memory_order_seq_cst)) {
+                sleeping.store(0, std::memory_order_relaxed);
+                continue;
+            }
+            futexWait(sleeping, 1, timeoutNs);
+            sleeping.store(0, std::memory_order_relaxed);
+            if (timeoutNs > 0) return pop(f);
+#else
+            (void)timeoutNs;
+            return false;
+#endif
+        }
+    }
+};
+
+// ─────────────────────────────────────────────────────────────────────────────
+//  Segment
+// ─────────────────────────────────────────────────────────────────────────────
+
+constexpr std::uint32_t kMagic   = 0x424b5348;   // "BKSH"
+constexpr std::uint32_t kVersion = 1;
+constexpr std::uint32_t kSlots   = 256;          ///< frames per direction
+
+/// Everything one client connection shares with the server (~16 KiB).
+struct Segment
+{
+    std::uint32_t              magic   = kMagic;
+    std::uint32_t              version = kVersion;
+    std::atomic<std::uint32_t> closed{0};       ///< either side hung up
+    Ring<kSlots>               requests;        ///< client -> server
+    Ring<kSlots>               replies;         ///< server -> client
+};
+
+/// Default rendezvous socket (passes the segment's memfd to the server).
+inline constexpr const char* kDefaultPath = "/tmp/booking.shm";
+
+} // namespace transport::shm
+
+#endif //SHM_RING_HPP
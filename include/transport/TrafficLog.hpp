@@ -0,0 +1,137 @@
+#ifndef TRAFFIC_LOG_HPP
+#define TRAFFIC_LOG_HPP
+//  TrafficLog.hpp
+//  ---------------------------------------------------------------------------
+//  On-disk format of a booking_server traffic capture (`--capture <file>`,
+//  written by grpc/TrafficCapture.hpp) and a reader for booking_replay.
+//
+//    file    := FileHeader Record*
+//    Record  := RecordHeader payload[size]      (serialized request message)
+//
+//  Integers are stored in host byte order; captures are replayed on the
+//  same kind of machine they were taken on.  Records are appended in
+//  *completion* order, so `startNs` is not monotonic across the file -
+//  sort by it before replaying.
+//  ---------------------------------------------------------------------------
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace transport::capture {
+
+/// Captured RPC; the values are part of the format.
+enum class Method : std::uint8_t
+{
+    ListMovies      = 0,        // booking.Booking
+    ListTheaters    = 1,
+    ListFreeSeats   = 2,
+    BookSeats       = 3,
+    JoinQueue       = 4,
+    QueueStatus     = 5,
+    AddMovie        = 6,        // booking.BookingAdmin - catalog changes only
+    AddScreening    = 7,
+    RetireScreening = 8,
+    QuotePrice      = 9,        // booking.Booking
+    SearchMovies    = 10,
+    Count_                       ///< number of methods - keep last
+};
+inline constexpr std::size_t kMethods = static_cast<std::size_t>(Method::Count_);
+
+inline const char* methodName(Method m) noexcept
+{
+    switch (m) {
+        case Method::ListMovies:      return "ListMovies";
+        case Method::ListTheaters:    return "ListTheaters";
+        case Method::ListFreeSeats:   return "ListFreeSeats";
+        case Method::BookSeats:       return "BookSeats";
+        case Method::JoinQueue:       return "JoinQueue";
+        case Method::QueueStatus:     return "QueueStatus";
+        case Method::AddMovie:        return "AddMovie";
+        case Method::AddScreening:    return "AddScreening";
+        case Method::RetireScreening: return "RetireScreening";
+        case Method::QuotePrice:      return "QuotePrice";
+        case Method::SearchMovies:    return "SearchMovies";
+        case Method::Count_:          break;
+    }
+    return "?";
+}
+
+/// Full gRPC method path, e.g. `/booking.Booking/BookSeats`.
+inline std::string methodPath(Method m)
+{
+    const bool admin = m == Method::AddMovie || m == Method::AddScreening
+                    || m == Method::RetireScreening;
+    return std::string{admin ? "/booking.BookingAdmin/" : "/booking.Booking/"} + methodName(m);
+}
+
+constexpr char          kMagic[4]  = {'B', 'K', 'T', 'L'};
+constexpr std::uint32_t kVersion   = 1;
+constexpr std::size_t   kMaxPayload = 0xFFFF;   ///< larger requests are not captured
+
+struct FileHeader
+{
+    char          magic[4];
+    std::uint32_t version;
+    std::int64_t  wallStartNs;   ///< system clock at capture start (ns since epoch)
+};
+static_assert(sizeof(FileHeader) == 16, "FileHeader is part of the file format");
+
+struct RecordHeader
+{
+    std::int64_t  startNs;       ///< handler entry, ns since capture start
+    std::uint32_t durationNs;    ///< handler entry -> return (saturated)
+    std::uint16_t size;          ///< payload bytes
+    Method        method;
+    std::uint8_t  reserved;
+};
+static_assert(sizeof(RecordHeader) == 16, "RecordHeader is part of the file format");
+
+/// One captured call.
+struct Record
+{
+    RecordHeader head{};
+    std::string  payload;
+
+    [[nodiscard]] std::int64_t start() const noexcept { return head.startNs; }
+    [[nodiscard]] std::int64_t end()   const noexcept { return head.startNs + head.durationNs; }
+};
+
+/**
+ * @brief Read every record of a capture file.
+ * @throws std::runtime_error if the file cannot be opened or is not a
+ *         capture.  A truncated last record (server killed mid-write) is
+ *         silently dropped.
+ */
+inline std::vector<Record> readAll(const std::string& path, FileHeader* header = nullptr)
+{
+    std::ifstream in{path, std::ios::binary};
+    if (!in) throw std::runtime_error("cannot open " + path);
+
+    FileHeader fh{};
+    if (!in.read(reinterpret_cast<char*>(&fh), sizeof fh)
+        || std::memcmp(fh.magic, kMagic, sizeof kMagic) != 0)
+        throw std::runtime_error(path + ": not a traffic capture");
+    if (fh.version != kVersion)
+        throw std::runtime_error(path + ": unsupported capture version "
+                                 + std::to_string(fh.version));
+    if (header) *header = fh;
+
+    std::vector<Record> out;
+    Record r;
+    while (in.read(reinterpret_cast<char*>(&r.head), sizeof r.head)) {
+        if (static_cast<std::size_t>(r.head.method) >= kMethods)
+            throw std::runtime_error(path + ": corrupt record");
+        r.payload.resize(r.head.size);
+        if (!in.read(r.payload.data(), r.head.size)) break;
+        out.push_back(std::move(r));
+        r = Record{};
+    }
+    return out;
+}
+
+} // namespace transport::capture
+
+#endif //TRAFFIC_LOG_HPP
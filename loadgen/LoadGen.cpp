@@ -0,0 +1,633 @@
+// loadgen/LoadGen.cpp
+// ─────────────────────────────────────────────────────────────────────────────
+// booking_loadgen - open / closed-loop load generator for the Booking service.
+//
+//   closed  <workers> threads issue blocking calls back to back.  With
+//           --rate the workers are paced to that aggregate rate instead.
+//   open    requests are sent asynchronously on a fixed schedule of <rate>
+//           per second, whether or not earlier ones have completed (capped
+//           at <max-inflight> outstanding calls).
+//
+// Whenever a schedule exists (open, or closed with --rate) latency is
+// measured from the *intended* send time, so a stalled server cannot hide
+// its queueing delay by slowing the generator down (coordinated omission).
+// The raw send-to-reply time is kept separately as "service" latency.
+//
+// Operations (--mix weights):
+//   list   ListFreeSeats on the picked hall  (sold out counts as conflict)
+//   book   BookSeats on the picked seat      (seat taken counts as conflict)
+//   hold   JoinQueue for the hall's movie - the service has no seat-hold
+//          RPC; a waiting-room place is the closest thing it hands out
+//
+// Seats are picked with --dist uniform | zipf (--skew s) | hot (--hot f),
+// see Workload.hpp.  --halls N creates N fresh screenings through the admin
+// service for the run (and retires them afterwards) so bookings do not
+// exhaust the 20-seat demo halls within the first second.
+//
+// --channels K spreads calls over a transport::ChannelPool of K connections
+// (reads retried on UNAVAILABLE unless --no-retry).  In closed mode
+// --hedge-us D hedges list calls: a backup attempt goes out on the next
+// connection when no reply has arrived after D microseconds (at most one
+// hedge per ten calls).
+//
+//   booking_loadgen [--host 127.0.0.1] [--port 50051] [--ipc <path>]
+//                   [--admin 127.0.0.1:50052]
+//                   [--mode closed|open] [--rate <req/s>] [--workers 16]
+//                   [--channels 1] [--max-inflight 10000]
+//                   [--duration 10] [--warmup 1] [--timeout-ms 5000]
+//                   [--mix list=20,book=70,hold=10]
+//                   [--dist uniform|zipf|hot] [--skew 1.1] [--hot 0.9]
+//                   [--halls 0] [--seed 1] [--hedge-us 0] [--no-retry]
+//                   [--json]
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include "Workload.hpp"
+#include "booking.grpc.pb.h"
+#include "booking/domain/Theater.hpp"
+#include "booking/telemetry/Metrics.hpp"
+#include "transport/ChannelFactory.hpp"
+
+#include <grpcpp/grpcpp.h>
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using booking::telemetry::Histogram;
+using loadgen::Op;
+
+namespace {            // ─────────────────────────── CLI
+using Clock = std::chrono::steady_clock;
+
+struct Cmd {
+    std::string host        = "127.0.0.1";
+    int         port        = 50051;
+    std::string ipc;                    // non-empty -> Unix-domain socket
+    std::string admin       = "127.0.0.1:50052";   // BookingAdmin listener (--halls)
+    bool        open        = false;
+    double      rate        = 0;        // req/s, 0 = unpaced (closed only)
+    int         workers     = 16;
+    int         channels    = 1;
+    long        maxInflight = 10000;
+    double      duration    = 10;       // seconds, measured
+    double      warmup      = 1;        // seconds, discarded
+    int         timeoutMs   = 5000;
+    loadgen::Mix  mix;
+    loadgen::Dist dist      = loadgen::Dist::Uniform;
+    double      skew        = 1.1;
+    double      hot         = 0.9;
+    int         halls       = 0;
+    long        hedgeUs     = 0;        // 0 = no hedging
+    bool        retry       = true;
+    unsigned    seed        = 1;
+    bool        json        = false;
+};
+
+void usage()
+{
+    std::cout <<
+R"(booking_loadgen [options]
+  --host <addr> --port <n> | --ipc <path>   target (default 127.0.0.1:50051)
+  --admin <addr>           admin listener for --halls      (default 127.0.0.1:50052)
+  --mode closed|open       closed: workers back to back, open: fixed rate
+  --rate <req/s>           open-loop rate / closed-loop pacing (0 = unpaced)
+  --workers <n>            closed-loop threads             (default 16)
+  --channels <n>           distinct connections            (default 1)
+  --max-inflight <n>       open-loop outstanding cap       (default 10000)
+  --duration <s>           measured seconds                (default 10)
+  --warmup <s>             discarded seconds               (default 1)
+  --timeout-ms <n>         per-call deadline               (default 5000)
+  --mix list=a,book=b,hold=c                               (default 20/70/10)
+  --dist uniform|zipf|hot  seat selection                  (default uniform)
+  --skew <s>               zipf exponent                   (default 1.1)
+  --hot <f>                hot-hall share of requests      (default 0.9)
+  --halls <n>              create n fresh halls for the run
+  --seed <n>               RNG seed                        (default 1)
+  --hedge-us <n>           hedge list calls after n us     (closed mode)
+  --no-retry               no transparent retry of reads
+  --json                   machine-readable report
+)";
+}
+
+Cmd parse(int argc, char** argv)
+{
+    Cmd cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{argv[i]};
+        auto next = [&]() -> std::string {
+            if (++i >= argc)
+                throw std::runtime_error("no value for " + arg);
+            return argv[i];
+        };
+        if      (arg == "--host")         cfg.host        = next();
+        else if (arg == "--port")         cfg.port        = std::stoi(next());
+        else if (arg == "--ipc")          cfg.ipc         = next();
+        else if (arg == "--admin")        cfg.admin       = next();
+        else if (arg == "--rate")         cfg.rate        = std::stod(next());
+        else if (arg == "--workers")      cfg.workers     = std::stoi(next());
+        else if (arg == "--channels")     cfg.channels    = std::stoi(next());
+        else if (arg == "--max-inflight") cfg.maxInflight = std::stol(next());
+        else if (arg == "--duration")     cfg.duration    = std::stod(next());
+        else if (arg == "--warmup")       cfg.warmup      = std::stod(next());
+        else if (arg == "--timeout-ms")   cfg.timeoutMs   = std::stoi(next());
+        else if (arg == "--mix")          cfg.mix         = loadgen::Mix::parse(next());
+        else if (arg == "--dist")         cfg.dist        = loadgen::parseDist(next());
+        else if (arg == "--skew")         cfg.skew        = std::stod(next());
+        else if (arg == "--hot")          cfg.hot         = std::stod(next());
+        else if (arg == "--halls")        cfg.halls       = std::stoi(next());
+        else if (arg == "--seed")         cfg.seed        = static_cast<unsigned>(std::stoul(next()));
+        else if (arg == "--hedge-us")     cfg.hedgeUs     = std::stol(next());
+        else if (arg == "--no-retry")     cfg.retry       = false;
+        else if (arg == "--json")         cfg.json        = true;
+        else if (arg == "--mode") {
+            const auto m = next();
+            if (m != "open" && m != "closed")
+                throw std::runtime_error("--mode must be open or closed");
+            cfg.open = m == "open";
+        }
+        else if (arg == "--help") { usage(); std::exit(0); }
+        else throw std::runtime_error("unknown option " + arg);
+    }
+    if (cfg.open && cfg.rate <= 0)
+        throw std::runtime_error("--mode open needs --rate");
+    if (cfg.open && cfg.hedgeUs > 0)
+        throw std::runtime_error("--hedge-us is supported in closed mode only");
+    if (cfg.workers < 1 || cfg.channels < 1 || cfg.maxInflight < 1 || cfg.duration <= 0)
+        throw std::runtime_error("workers, channels, max-inflight and duration must be positive");
+    return cfg;
+}
+
+transport::ChannelPool channels(const Cmd& c)
+{
+    transport::PoolOptions opts;
+    opts.size       = static_cast<std::size_t>(c.channels);
+    opts.retryReads = c.retry;
+    if (!c.ipc.empty())
+        return transport::makeLocalChannelPool(c.ipc, opts);
+    return transport::makeChannelPool(c.host, c.port, opts);
+}
+
+// ─────────────────────────────────────────────────────────────── targets
+struct Hall { std::uint32_t movie = 0; std::uint32_t theater = 0; };
+
+/// Every (movie, theater) pair currently in the catalog.
+std::vector<Hall> discover(booking::Booking::Stub& stub)
+{
+    grpc::ClientContext mc;
+    booking::MovieList movies;
+    if (!stub.ListMovies(&mc, booking::ListMoviesReq{}, &movies).ok())
+        throw std::runtime_error("ListMovies failed - is the server running?");
+
+    std::vector<Hall> halls;
+    for (const auto& m : movies.movies()) {
+        booking::ListTheatersReq id;
+        id.set_movie_id(m.id());
+        booking::TheaterList ts;
+        grpc::ClientContext tc;
+        if (!stub.ListTheaters(&tc, id, &ts).ok()) continue;
+        for (const auto& t : ts.theaters()) halls.push_back({m.id(), t.id()});
+    }
+    return halls;
+}
+
+/// Adds @p n screenings of the first movie under fresh ids.
+std::vector<Hall> createHalls(booking::BookingAdmin::Stub& admin, std::uint32_t movie, int n)
+{
+    std::uint32_t id = 1'000'000 + std::random_device{}() % 1'000'000'000u;
+    std::vector<Hall> halls;
+    while (static_cast<int>(halls.size()) < n) {
+        booking::ScreeningReq req;
+        req.set_movie_id(movie);
+        req.set_theater_id(++id);
+        req.set_name("loadgen-" + std::to_string(id));
+        booking::Empty rep;
+        grpc::ClientContext ctx;
+        const auto st = admin.AddScreening(&ctx, req, &rep);
+        if (st.error_code() == grpc::StatusCode::ALREADY_EXISTS) continue;
+        if (!st.ok()) throw std::runtime_error("AddScreening failed: " + st.error_message());
+        halls.push_back({movie, id});
+    }
+    return halls;
+}
+
+void retireHalls(booking::BookingAdmin::Stub& admin, const std::vector<Hall>& halls)
+{
+    for (const auto& h : halls) {
+        booking::TheaterReq req;
+        req.set_movie_id(h.movie);
+        req.set_theater_id(h.theater);
+        booking::Empty rep;
+        grpc::ClientContext ctx;
+        admin.RetireScreening(&ctx, req, &rep);
+    }
+}
+
+// ─────────────────────────────────────────────────────────────── requests
+struct Pick { Op op; Hall hall; std::uint32_t seat; };
+
+class Generator
+{
+public:
+    Generator(const std::vector<Hall>& halls, const loadgen::SeatPicker& picker,
+              const loadgen::Mix& mix, std::uint64_t seed)
+        : halls_{halls}, picker_{picker}, mix_{mix}, rng_{seed} {}
+
+    Pick next()
+    {
+        const Op op = mix_.pick(std::uniform_real_distribution<double>{0.0, 1.0}(rng_));
+        const std::size_t flat = picker_(rng_);
+        return {op, halls_[flat / picker_.seatsPerHall()],
+                static_cast<std::uint32_t>(flat % picker_.seatsPerHall())};
+    }
+
+private:
+    const std::vector<Hall>&    halls_;
+    const loadgen::SeatPicker&  picker_;
+    const loadgen::Mix&         mix_;
+    std::mt19937_64             rng_;
+};
+
+booking::TheaterReq theaterReq(const Pick& p)
+{
+    booking::TheaterReq r;
+    r.set_movie_id(p.hall.movie);
+    r.set_theater_id(p.hall.theater);
+    return r;
+}
+
+booking::BookingReq bookingReq(const Pick& p)
+{
+    booking::BookingReq r;
+    r.set_movie_id(p.hall.movie);
+    r.set_theater_id(p.hall.theater);
+    auto* s = r.add_seats();
+    s->set_index(p.seat);
+    s->set_label("A" + std::to_string(p.seat + 1));
+    return r;
+}
+
+booking::QueueReq queueReq(const Pick& p)
+{
+    booking::QueueReq r;
+    r.set_movie_id(p.hall.movie);
+    return r;
+}
+
+// ─────────────────────────────────────────────────────────────── stats
+struct OpStats {
+    Histogram latency;                  // from intended send time
+    Histogram service;                  // from actual send time
+    std::atomic<std::uint64_t> ok{0}, conflict{0}, shed{0}, error{0};
+};
+
+struct Stats {
+    OpStats                    op[loadgen::kOps];
+    std::atomic<std::uint64_t> late{0};   // sent > 1 ms behind schedule
+    Clock::time_point          from, to;  // measurement window (intended)
+
+    void record(Op o, Clock::time_point intended, Clock::time_point sent,
+                Clock::time_point done, const grpc::Status& st)
+    {
+        if (intended < from || intended >= to) return;
+        auto& s = op[static_cast<std::size_t>(o)];
+        using std::chrono::nanoseconds;
+        s.latency.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<nanoseconds>(done - intended).count()));
+        s.service.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<nanoseconds>(done - sent).count()));
+        if (sent - intended > std::chrono::milliseconds{1}) late.fetch_add(1);
+
+        switch (st.error_code()) {
+            case grpc::StatusCode::OK:                 s.ok.fetch_add(1);       break;
+            case grpc::StatusCode::ALREADY_EXISTS:     s.conflict.fetch_add(1); break;
+            case grpc::StatusCode::NOT_FOUND:          // ListFreeSeats on a sold-out hall
+                (o == Op::List ? s.conflict : s.error).fetch_add(1);              break;
+            case grpc::StatusCode::RESOURCE_EXHAUSTED: s.shed.fetch_add(1);     break;
+            default:                                   s.error.fetch_add(1);    break;
+        }
+    }
+};
+
+// ─────────────────────────────────────────────────────────────── closed loop
+using Stubs = std::vector<std::unique_ptr<booking::Booking::Stub>>;
+
+transport::HedgeBudget hedgeBudget{0.1};        // ≤ 10 % of list calls hedged
+
+grpc::Status callSync(const Stubs& stubs, std::size_t lane, const Pick& p, const Cmd& cfg)
+{
+    if (p.op == Op::List && cfg.hedgeUs > 0) {
+        transport::HedgePolicy hedge;
+        hedge.delay    = std::chrono::microseconds{cfg.hedgeUs};
+        hedge.deadline = std::chrono::milliseconds{cfg.timeoutMs};
+        hedge.budget   = &hedgeBudget;
+        booking::SeatList r;
+        return transport::hedgedCall(stubs, lane, &booking::Booking::Stub::AsyncListFreeSeats,
+                                     theaterReq(p), &r, hedge);
+    }
+
+    auto& stub = *stubs[lane];
+    grpc::ClientContext ctx;
+    ctx.set_deadline(std::chrono::system_clock::now()
+                     + std::chrono::milliseconds{cfg.timeoutMs});
+    switch (p.op) {
+        case Op::List: { booking::SeatList    r; return stub.ListFreeSeats(&ctx, theaterReq(p), &r); }
+        case Op::Book: { booking::BookingRep  r; return stub.BookSeats(&ctx, bookingReq(p), &r); }
+        case Op::Hold: { booking::QueueTicket r; return stub.JoinQueue(&ctx, queueReq(p), &r); }
+    }
+    return grpc::Status::CANCELLED;
+}
+
+void runClosed(const Cmd& cfg, const Stubs& stubs,
+               const std::vector<Hall>& halls, const loadgen::SeatPicker& picker,
+               Stats& stats, Clock::time_point start)
+{
+    // paced: worker w owns schedule slots w, w + W, w + 2W, … of the aggregate rate
+    const auto period = cfg.rate > 0
+        ? std::chrono::duration<double>(1.0 / cfg.rate) : std::chrono::duration<double>(0);
+
+    std::vector<std::thread> workers;
+    for (int w = 0; w < cfg.workers; ++w)
+        workers.emplace_back([&, w] {
+            const auto lane = static_cast<std::size_t>(w) % stubs.size();
+            Generator gen{halls, picker, cfg.mix, cfg.seed * 7919u + static_cast<unsigned>(w)};
+            for (std::uint64_t k = 0;; ++k) {
+                auto intended = Clock::now();
+                if (cfg.rate > 0) {
+                    intended = start + std::chrono::duration_cast<Clock::duration>(
+                        period * static_cast<double>(k * static_cast<std::uint64_t>(cfg.workers)
+                                                     + static_cast<std::uint64_t>(w)));
+                    std::this_thread::sleep_until(intended);
+                }
+                if (intended >= stats.to) break;
+                const Pick p    = gen.next();
+                const auto sent = Clock::now();
+                const auto st   = callSync(stubs, lane, p, cfg);
+                stats.record(p.op, cfg.rate > 0 ? intended : sent, sent, Clock::now(), st);
+            }
+        });
+    for (auto& t : workers) t.join();
+}
+
+// ─────────────────────────────────────────────────────────────── open loop
+struct Call {
+    Op                op{};
+    Clock::time_point intended, sent;
+    grpc::ClientContext ctx;
+    grpc::Status      status;
+    virtual ~Call() = default;
+};
+
+template <class Rep>
+struct AsyncCall final : Call {
+    Rep rep;
+    std::unique_ptr<grpc::ClientAsyncResponseReader<Rep>> reader;
+};
+
+template <class Rep, class Start>
+void launch(std::unique_ptr<AsyncCall<Rep>> call, Start&& start)
+{
+    auto* c   = call.release();                    // owned by the poller now
+    c->reader = start(&c->ctx);
+    c->reader->Finish(&c->rep, &c->status, c);
+}
+
+void issue(booking::Booking::Stub& stub, grpc::CompletionQueue& cq, const Pick& p,
+           Clock::time_point intended, const Cmd& cfg)
+{
+    auto prepare = [&](auto call) {
+        call->op       = p.op;
+        call->intended = intended;
+        call->sent     = Clock::now();
+        call->ctx.set_deadline(std::chrono::system_clock::now()
+                               + std::chrono::milliseconds{cfg.timeoutMs});
+        return call;
+    };
+    switch (p.op) {
+        case Op::List:
+            launch(prepare(std::make_unique<AsyncCall<booking::SeatList>>()),
+                   [&](grpc::ClientContext* c) { return stub.AsyncListFreeSeats(c, theaterReq(p), &cq); });
+            break;
+        case Op::Book:
+            launch(prepare(std::make_unique<AsyncCall<booking::BookingRep>>()),
+                   [&](grpc::ClientContext* c) { return stub.AsyncBookSeats(c, bookingReq(p), &cq); });
+            break;
+        case Op::Hold:
+            launch(prepare(std::make_unique<AsyncCall<booking::QueueTicket>>()),
+                   [&](grpc::ClientContext* c) { return stub.AsyncJoinQueue(c, queueReq(p), &cq); });
+            break;
+    }
+}
+
+void runOpen(const Cmd& cfg, const Stubs& stubs,
+             const std::vector<Hall>& halls, const loadgen::SeatPicker& picker,
+             Stats& stats, Clock::time_point start)
+{
+    // one lane per channel: a dispatcher sends slots j, j + K, j + 2K, … of
+    // the schedule, a poller drains the lane's completion queue
+    const auto lanes  = stubs.size();
+    const auto period = std::chrono::duration<double>(1.0 / cfg.rate);
+    std::vector<grpc::CompletionQueue> cqs(lanes);
+    std::atomic<long> inflight{0};
+
+    std::vector<std::thread> threads;
+    for (std::size_t j = 0; j < lanes; ++j) {
+        threads.emplace_back([&, j] {                           // poller
+            void* tag = nullptr;
+            bool  ok  = false;
+            while (cqs[j].Next(&tag, &ok)) {
+                std::unique_ptr<Call> c{static_cast<Call*>(tag)};
+                stats.record(c->op, c->intended, c->sent, Clock::now(), c->status);
+                inflight.fetch_sub(1, std::memory_order_release);
+            }
+        });
+        threads.emplace_back([&, j] {                           // dispatcher
+            Generator gen{halls, picker, cfg.mix, cfg.seed * 7919u + static_cast<unsigned>(j)};
+            for (std::uint64_t k = 0;; ++k) {
+                const auto intended = start + std::chrono::duration_cast<Clock::duration>(
+                    period * static_cast<double>(k * lanes + j));
+                if (intended >= stats.to) break;
+                std::this_thread::sleep_until(intended);
+                while (inflight.load(std::memory_order_acquire) >= cfg.maxInflight)
+                    std::this_thread::yield();               // latency still counts from intended
+                inflight.fetch_add(1);
+                issue(*stubs[j], cqs[j], gen.next(), intended, cfg);
+            }
+        });
+    }
+
+    // dispatchers finish first (odd slots); then drain and stop the pollers
+    for (std::size_t j = 1; j < threads.size(); j += 2) threads[j].join();
+    while (inflight.load(std::memory_order_acquire) > 0)
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    for (auto& cq : cqs) cq.Shutdown();
+    for (std::size_t j = 0; j < threads.size(); j += 2) threads[j].join();
+}
+
+// ─────────────────────────────────────────────────────────────── report
+struct Row {
+    const char*   name = "";
+    std::uint64_t count = 0, ok = 0, conflict = 0, shed = 0, error = 0;
+    Histogram::Snapshot latency{}, service{};
+};
+
+void merge(Histogram::Snapshot& into, const Histogram::Snapshot& s)
+{
+    for (std::size_t b = 0; b < into.buckets.size(); ++b) into.buckets[b] += s.buckets[b];
+    into.count += s.count;
+    into.sum   += s.sum;
+}
+
+std::vector<Row> rows(const Stats& stats)
+{
+    std::vector<Row> out;
+    Row all;
+    all.name = "all";
+    for (std::size_t i = 0; i < loadgen::kOps; ++i) {
+        const auto& s = stats.op[i];
+        Row r;
+        r.name     = loadgen::opName(static_cast<Op>(i));
+        r.latency  = s.latency.snapshot();
+        r.service  = s.service.snapshot();
+        r.count    = r.latency.count;
+        r.ok       = s.ok.load();
+        r.conflict = s.conflict.load();
+        r.shed     = s.shed.load();
+        r.error    = s.error.load();
+        all.count += r.count; all.ok += r.ok; all.conflict += r.conflict;
+        all.shed  += r.shed;  all.error += r.error;
+        merge(all.latency, r.latency);
+        merge(all.service, r.service);
+        if (r.count) out.push_back(std::move(r));
+    }
+    out.push_back(std::move(all));
+    return out;
+}
+
+double us(const Histogram::Snapshot& s, double q)
+{
+    return s.count ? static_cast<double>(s.quantile(q)) / 1000.0 : 0.0;
+}
+
+const char* distName(loadgen::Dist d)
+{
+    switch (d) {
+        case loadgen::Dist::Uniform: return "uniform";
+        case loadgen::Dist::Zipf:    return "zipf";
+        case loadgen::Dist::Hot:     return "hot";
+    }
+    return "?";
+}
+
+void reportText(const Cmd& cfg, const Stats& stats, std::size_t halls)
+{
+    const auto rs = rows(stats);
+    const double tput = static_cast<double>(rs.back().count) / cfg.duration;
+
+    std::cout << "mode=" << (cfg.open ? "open" : "closed")
+              << " rate=" << (cfg.rate > 0 ? std::to_string(static_cast<long>(cfg.rate)) + "/s" : "max")
+              << " duration=" << cfg.duration << "s channels=" << cfg.channels;
+    if (!cfg.open) std::cout << " workers=" << cfg.workers;
+    if (cfg.hedgeUs > 0) std::cout << " hedge=" << cfg.hedgeUs << "us";
+    std::cout << " halls=" << halls << " dist=" << distName(cfg.dist)
+              << " mix=" << cfg.mix.str() << '\n'
+              << (cfg.rate > 0 ? "latency from intended send time (corrected)\n"
+                               : "unpaced closed loop: latency = service time\n");
+
+    std::cout << std::left << std::setw(6) << "op" << std::right
+              << std::setw(10) << "count" << std::setw(10) << "ok"
+              << std::setw(10) << "conflict" << std::setw(8) << "shed"
+              << std::setw(8) << "error" << std::setw(11) << "p50 us"
+              << std::setw(11) << "p99 us" << std::setw(11) << "p999 us"
+              << std::setw(11) << "max us" << '\n';
+    for (const auto& r : rs)
+        std::cout << std::left << std::setw(6) << r.name << std::right
+                  << std::setw(10) << r.count << std::setw(10) << r.ok
+                  << std::setw(10) << r.conflict << std::setw(8) << r.shed
+                  << std::setw(8) << r.error << std::fixed << std::setprecision(1)
+                  << std::setw(11) << us(r.latency, 0.50) << std::setw(11) << us(r.latency, 0.99)
+                  << std::setw(11) << us(r.latency, 0.999) << std::setw(11) << us(r.latency, 1.0)
+                  << '\n';
+
+    std::cout << "throughput: " << std::setprecision(1) << tput << " ops/s";
+    if (cfg.rate > 0) std::cout << " (target " << cfg.rate << ")";
+    std::cout << "   late sends (>1 ms behind schedule): " << stats.late.load() << '\n';
+}
+
+void reportJson(const Cmd& cfg, const Stats& stats, std::size_t halls)
+{
+    const auto rs = rows(stats);
+    std::cout << std::fixed << std::setprecision(1)
+              << "{\"mode\":\"" << (cfg.open ? "open" : "closed") << "\""
+              << ",\"rate\":" << cfg.rate
+              << ",\"duration_s\":" << cfg.duration
+              << ",\"channels\":" << cfg.channels
+              << ",\"hedge_us\":" << cfg.hedgeUs
+              << ",\"workers\":" << (cfg.open ? 0 : cfg.workers)
+              << ",\"halls\":" << halls
+              << ",\"dist\":\"" << distName(cfg.dist) << "\""
+              << ",\"mix\":\"" << cfg.mix.str() << "\""
+              << ",\"corrected\":" << (cfg.rate > 0 ? "true" : "false")
+              << ",\"throughput\":" << static_cast<double>(rs.back().count) / cfg.duration
+              << ",\"late_sends\":" << stats.late.load()
+              << ",\"ops\":{";
+    for (std::size_t i = 0; i < rs.size(); ++i) {
+        const auto& r = rs[i];
+        std::cout << (i ? "," : "") << '"' << r.name << "\":{"
+                  << "\"count\":" << r.count << ",\"ok\":" << r.ok
+                  << ",\"conflict\":" << r.conflict << ",\"shed\":" << r.shed
+                  << ",\"error\":" << r.error
+                  << ",\"p50_us\":" << us(r.latency, 0.50)
+                  << ",\"p99_us\":" << us(r.latency, 0.99)
+                  << ",\"p999_us\":" << us(r.latency, 0.999)
+                  << ",\"max_us\":" << us(r.latency, 1.0)
+                  << ",\"service_p50_us\":" << us(r.service, 0.50)
+                  << ",\"service_p99_us\":" << us(r.service, 0.99) << '}';
+    }
+    std::cout << "}}\n";
+}
+// ---------------------------------------------------------------------------
+} // unnamed namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+int main(int argc, char** argv)
+try {
+    const Cmd cfg = parse(argc, argv);
+
+    const auto pool  = channels(cfg);
+    const auto stubs = pool.stubs<booking::Booking>();
+    auto admin = booking::BookingAdmin::NewStub(
+        grpc::CreateChannel(cfg.admin, grpc::InsecureChannelCredentials()));
+
+    std::vector<Hall> halls = discover(*stubs.front());
+    if (halls.empty()) throw std::runtime_error("catalog has no screenings");
+    std::vector<Hall> created;
+    if (cfg.halls > 0) halls = created = createHalls(*admin, halls.front().movie, cfg.halls);
+
+    const loadgen::SeatPicker picker{cfg.dist, halls.size(), booking::domain::Theater::kCapacity,
+                                     cfg.dist == loadgen::Dist::Zipf ? cfg.skew : cfg.hot};
+
+    Stats stats;
+    const auto start = Clock::now();
+    stats.from = start + std::chrono::duration_cast<Clock::duration>(
+                             std::chrono::duration<double>(cfg.warmup));
+    stats.to   = stats.from + std::chrono::duration_cast<Clock::duration>(
+                                  std::chrono::duration<double>(cfg.duration));
+
+    if (cfg.open) runOpen(cfg, stubs, halls, picker, stats, start);
+    else          runClosed(cfg, stubs, halls, picker, stats, start);
+
+    retireHalls(*admin, created);
+    if (cfg.json) reportJson(cfg, stats, halls.size());
+    else          reportText(cfg, stats, halls.size());
+    return 0;
+}
+catch (const std::exception& e) {
+    std::cerr << "error: " << e.what() << '\n';
+    return 1;
+}
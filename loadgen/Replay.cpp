@@ -0,0 +1,366 @@
+// loadgen/Replay.cpp
+// ─────────────────────────────────────────────────────────────────────────────
+// booking_replay - re-issue a traffic capture (`booking_server --capture`)
+// against a running server.
+//
+// Every captured request is sent again with its original payload over
+// gRPC's generic stub, so the tool needs no knowledge of the messages.
+// Captures include the admin catalog changes, so replaying against a fresh
+// server recreates the halls the traffic books into.
+//
+//   --speed 1    calls go out at their captured offsets (scaled by the
+//   --speed 10   speed factor), open-loop: a slow server does not slow the
+//                replay down, and whatever overlap the real traffic
+//                produced is produced again
+//   --speed max  no gaps, but the captured concurrency is kept: a call is
+//                sent as soon as every call that had *completed* before it
+//                started in the capture has completed in the replay.  Calls
+//                that overlapped in production overlap again, calls that
+//                were sequential stay sequential.
+//
+// Latency is measured from the intended send time (timed modes) or the
+// actual send time (max).  The report lists outcomes and latency per
+// method plus the peak number of calls in flight, captured vs replayed.
+//
+// Waiting-room tokens in the capture belong to the original server: replay
+// against a server without --waiting-room, or expect FAILED_PRECONDITION.
+//
+//   booking_replay --log <file> [--speed 1|10|<x>|max]
+//                  [--host 127.0.0.1] [--port 50051] [--ipc <path>]
+//                  [--channels 4] [--max-inflight 10000] [--timeout-ms 5000]
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include "booking/telemetry/Metrics.hpp"
+#include "transport/ChannelFactory.hpp"
+#include "transport/TrafficLog.hpp"
+
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using booking::telemetry::Histogram;
+namespace cap = transport::capture;
+
+namespace {            // ─────────────────────────── CLI
+using Clock = std::chrono::steady_clock;
+
+struct Cmd {
+    std::string log;
+    std::string host        = "127.0.0.1";
+    int         port        = 50051;
+    std::string ipc;                    // non-empty -> Unix-domain socket
+    double      speed       = 1;        // 0 = as fast as possible
+    int         channels    = 4;
+    long        maxInflight = 10000;
+    int         timeoutMs   = 5000;
+};
+
+void usage()
+{
+    std::cout <<
+R"(booking_replay --log <file> [options]
+  --log <file>             capture written by booking_server --capture
+  --speed <x>|max          time scale, e.g. 1 or 10; max = back to back
+                           with the captured concurrency   (default 1)
+  --host <addr> --port <n> | --ipc <path>   target (default 127.0.0.1:50051)
+  --channels <n>           distinct connections            (default 4)
+  --max-inflight <n>       outstanding-call cap            (default 10000)
+  --timeout-ms <n>         per-call deadline               (default 5000)
+)";
+}
+
+Cmd parse(int argc, char** argv)
+{
+    Cmd cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{argv[i]};
+        auto next = [&]() -> std::string {
+            if (++i >= argc)
+                throw std::runtime_error("no value for " + arg);
+            return argv[i];
+        };
+        if      (arg == "--log")          cfg.log         = next();
+        else if (arg == "--host")         cfg.host        = next();
+        else if (arg == "--port")         cfg.port        = std::stoi(next());
+        else if (arg == "--ipc")          cfg.ipc         = next();
+        else if (arg == "--channels")     cfg.channels    = std::stoi(next());
+        else if (arg == "--max-inflight") cfg.maxInflight = std::stol(next());
+        else if (arg == "--timeout-ms")   cfg.timeoutMs   = std::stoi(next());
+        else if (arg == "--speed") {
+            const auto v = next();
+            cfg.speed = v == "max" ? 0 : std::stod(v);   // "10x" parses as 10
+            if (v != "max" && cfg.speed <= 0)
+                throw std::runtime_error("--speed must be positive or max");
+        }
+        else if (arg == "--help") { usage(); std::exit(0); }
+        else throw std::runtime_error("unknown option " + arg);
+    }
+    if (cfg.log.empty()) throw std::runtime_error("--log is required");
+    if (cfg.channels < 1 || cfg.maxInflight < 1)
+        throw std::runtime_error("channels and max-inflight must be positive");
+    return cfg;
+}
+
+// ─────────────────────────────────────────────────────────────── plan
+/**
+ * Captured calls ordered by start time.  `needed[i]` is the number of
+ * calls that had completed before call i started; with calls ranked by
+ * completion time those are exactly ranks [0, needed[i]).
+ */
+struct Plan {
+    std::vector<cap::Record>  calls;
+    std::vector<std::size_t>  rank;        // completion rank of calls[i]
+    std::vector<std::size_t>  needed;
+    std::size_t               peak = 0;    // most calls in flight at once
+    std::int64_t              spanNs = 0;  // first start -> last end
+};
+
+Plan plan(std::vector<cap::Record> recs)
+{
+    Plan p;
+    std::stable_sort(recs.begin(), recs.end(),
+                     [](const cap::Record& a, const cap::Record& b) { return a.start() < b.start(); });
+    p.calls = std::move(recs);
+    const auto n = p.calls.size();
+    if (n == 0) return p;
+
+    std::vector<std::size_t> byEnd(n);
+    for (std::size_t i = 0; i < n; ++i) byEnd[i] = i;
+    std::stable_sort(byEnd.begin(), byEnd.end(), [&](std::size_t a, std::size_t b) {
+        return p.calls[a].end() < p.calls[b].end();
+    });
+    p.rank.resize(n);
+    std::vector<std::int64_t> ends(n);
+    for (std::size_t r = 0; r < n; ++r) {
+        p.rank[byEnd[r]] = r;
+        ends[r] = p.calls[byEnd[r]].end();
+    }
+
+    p.needed.resize(n);
+    std::size_t inFlightPeak = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        // a call that ends exactly as this one starts still counts as before it
+        p.needed[i] = static_cast<std::size_t>(
+            std::upper_bound(ends.begin(), ends.end(), p.calls[i].start()) - ends.begin());
+        inFlightPeak = std::max(inFlightPeak, i + 1 - p.needed[i]);
+    }
+    p.peak   = inFlightPeak;
+    p.spanNs = ends.back() - p.calls.front().start();
+    return p;
+}
+
+/// Completion watermark for --speed max.
+class Progress
+{
+public:
+    explicit Progress(std::size_t n) : done_(n, 0) {}
+
+    void complete(std::size_t rank)
+    {
+        {
+            const std::lock_guard lock{mtx_};
+            done_[rank] = 1;
+            while (prefix_ < done_.size() && done_[prefix_]) ++prefix_;
+        }
+        cv_.notify_all();
+    }
+
+    /// Block until completion ranks [0, n) are all done.
+    void waitFor(std::size_t n)
+    {
+        std::unique_lock lock{mtx_};
+        cv_.wait(lock, [&] { return prefix_ >= n; });
+    }
+
+private:
+    std::mutex              mtx_;
+    std::condition_variable cv_;
+    std::vector<char>       done_;
+    std::size_t             prefix_ = 0;
+};
+
+// ─────────────────────────────────────────────────────────────── stats
+struct MethodStats {
+    Histogram latency;
+    std::atomic<std::uint64_t> ok{0}, conflict{0}, notFound{0}, shed{0}, error{0};
+};
+
+struct Stats {
+    MethodStats                op[cap::kMethods];
+    std::atomic<std::uint64_t> late{0};   // sent > 1 ms behind schedule
+    std::atomic<long>          inflight{0};
+    std::atomic<long>          peak{0};
+
+    void record(cap::Method m, Clock::time_point intended, Clock::time_point done,
+                const grpc::Status& st)
+    {
+        auto& s = op[static_cast<std::size_t>(m)];
+        s.latency.record(static_cast<std::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(done - intended).count()));
+        switch (st.error_code()) {
+            case grpc::StatusCode::OK:                 s.ok.fetch_add(1);       break;
+            case grpc::StatusCode::ALREADY_EXISTS:     s.conflict.fetch_add(1); break;
+            case grpc::StatusCode::NOT_FOUND:          s.notFound.fetch_add(1); break;
+            case grpc::StatusCode::RESOURCE_EXHAUSTED: s.shed.fetch_add(1);     break;
+            default:                                   s.error.fetch_add(1);    break;
+        }
+    }
+};
+
+// ─────────────────────────────────────────────────────────────── replay
+struct Call {
+    std::size_t         index = 0;
+    cap::Method         method{};
+    Clock::time_point   intended;
+    grpc::ClientContext ctx;
+    grpc::ByteBuffer    reply;
+    grpc::Status        status;
+    std::unique_ptr<grpc::GenericClientAsyncResponseReader> reader;
+};
+
+double replay(const Cmd& cfg, const Plan& p, Stats& stats)
+{
+    transport::PoolOptions opts;
+    opts.size       = static_cast<std::size_t>(cfg.channels);
+    opts.retryReads = false;                      // replay what was sent, once
+    const auto pool = cfg.ipc.empty() ? transport::makeChannelPool(cfg.host, cfg.port, opts)
+                                      : transport::makeLocalChannelPool(cfg.ipc, opts);
+    const auto lanes = pool.size();
+    if (lanes == 0) throw std::runtime_error("no channel to " + cfg.ipc);
+
+    std::vector<std::unique_ptr<grpc::GenericStub>> stubs;
+    for (const auto& ch : pool.channels()) stubs.push_back(std::make_unique<grpc::GenericStub>(ch));
+    std::vector<std::string> paths;
+    for (std::size_t m = 0; m < cap::kMethods; ++m)
+        paths.push_back(cap::methodPath(static_cast<cap::Method>(m)));
+
+    Progress progress{p.calls.size()};
+    std::vector<grpc::CompletionQueue> cqs(lanes);
+    std::vector<std::thread> pollers;
+    for (std::size_t j = 0; j < lanes; ++j)
+        pollers.emplace_back([&, j] {
+            void* tag = nullptr;
+            bool  ok  = false;
+            while (cqs[j].Next(&tag, &ok)) {
+                std::unique_ptr<Call> c{static_cast<Call*>(tag)};
+                stats.record(c->method, c->intended, Clock::now(), c->status);
+                stats.inflight.fetch_sub(1, std::memory_order_release);
+                progress.complete(p.rank[c->index]);
+            }
+        });
+
+    const auto start = Clock::now();
+    for (std::size_t i = 0; i < p.calls.size(); ++i) {
+        const cap::Record& r = p.calls[i];
+        auto intended = Clock::now();
+        if (cfg.speed > 0) {
+            intended = start + std::chrono::duration_cast<Clock::duration>(
+                std::chrono::nanoseconds{r.start() - p.calls.front().start()} / cfg.speed);
+            std::this_thread::sleep_until(intended);
+        } else {
+            progress.waitFor(p.needed[i]);
+            intended = Clock::now();
+        }
+        while (stats.inflight.load(std::memory_order_acquire) >= cfg.maxInflight)
+            std::this_thread::yield();
+        const long now = stats.inflight.fetch_add(1) + 1;
+        for (long peak = stats.peak.load(); now > peak && !stats.peak.compare_exchange_weak(peak, now);) {}
+        if (Clock::now() - intended > std::chrono::milliseconds{1}) stats.late.fetch_add(1);
+
+        auto* c     = new Call;                   // owned by the poller from here
+        c->index    = i;
+        c->method   = r.head.method;
+        c->intended = intended;
+        c->ctx.set_deadline(std::chrono::system_clock::now()
+                            + std::chrono::milliseconds{cfg.timeoutMs});
+        grpc::Slice      slice{r.payload.data(), r.payload.size()};
+        grpc::ByteBuffer req{&slice, 1};
+        const auto lane = i % lanes;
+        c->reader = stubs[lane]->PrepareUnaryCall(&c->ctx, paths[static_cast<std::size_t>(r.head.method)],
+                                                  req, &cqs[lane]);
+        c->reader->StartCall();
+        c->reader->Finish(&c->reply, &c->status, c);
+    }
+
+    progress.waitFor(p.calls.size());
+    const double wall = std::chrono::duration<double>(Clock::now() - start).count();
+    for (auto& cq : cqs) cq.Shutdown();
+    for (auto& t : pollers) t.join();
+    return wall;
+}
+
+// ─────────────────────────────────────────────────────────────── report
+double us(const Histogram::Snapshot& s, double q)
+{
+    return s.count ? static_cast<double>(s.quantile(q)) / 1000.0 : 0.0;
+}
+
+void report(const Cmd& cfg, const Plan& p, const Stats& stats, double wall)
+{
+    const double span = static_cast<double>(p.spanNs) / 1e9;
+    std::ostringstream speed;
+    if (cfg.speed > 0) speed << cfg.speed << 'x';
+    else               speed << "max";
+    std::cout << std::fixed << std::setprecision(2)
+              << "replayed " << p.calls.size() << " calls from " << cfg.log
+              << " (captured over " << span << "s) at "
+              << speed.str()
+              << " in " << wall << "s = " << std::setprecision(0)
+              << static_cast<double>(p.calls.size()) / wall << " calls/s\n"
+              << "in flight: captured peak " << p.peak
+              << ", replay peak " << stats.peak.load() << '\n'
+              << (cfg.speed > 0 ? "latency from intended send time\n"
+                                : "latency from send time\n");
+
+    std::cout << std::left << std::setw(15) << "method" << std::right
+              << std::setw(10) << "count" << std::setw(10) << "ok"
+              << std::setw(10) << "conflict" << std::setw(10) << "notfound"
+              << std::setw(8) << "shed" << std::setw(8) << "error"
+              << std::setw(11) << "p50 us" << std::setw(11) << "p99 us"
+              << std::setw(11) << "max us" << '\n';
+    for (std::size_t m = 0; m < cap::kMethods; ++m) {
+        const auto& s    = stats.op[m];
+        const auto  snap = s.latency.snapshot();
+        if (!snap.count) continue;
+        std::cout << std::left << std::setw(15) << cap::methodName(static_cast<cap::Method>(m))
+                  << std::right << std::setw(10) << snap.count << std::setw(10) << s.ok.load()
+                  << std::setw(10) << s.conflict.load() << std::setw(10) << s.notFound.load()
+                  << std::setw(8) << s.shed.load() << std::setw(8) << s.error.load()
+                  << std::setprecision(1)
+                  << std::setw(11) << us(snap, 0.50) << std::setw(11) << us(snap, 0.99)
+                  << std::setw(11) << us(snap, 1.0) << '\n';
+    }
+    if (cfg.speed > 0)
+        std::cout << "late sends (>1 ms behind schedule): " << stats.late.load() << '\n';
+}
+// ---------------------------------------------------------------------------
+} // unnamed namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+int main(int argc, char** argv)
+try {
+    const Cmd  cfg = parse(argc, argv);
+    const Plan p   = plan(cap::readAll(cfg.log));
+    if (p.calls.empty()) throw std::runtime_error(cfg.log + ": no captured calls");
+
+    Stats stats;
+    const double wall = replay(cfg, p, stats);
+    report(cfg, p, stats, wall);
+    return 0;
+}
+catch (const std::exception& e) {
+    std::cerr << "error: " << e.what() << '\n';
+    return 1;
+}
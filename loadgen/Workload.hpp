@@ -0,0 +1,173 @@
+#ifndef LOADGEN_WORKLOAD_HPP
+#define LOADGEN_WORKLOAD_HPP
+
+//  Workload.hpp
+//  ---------------------------------------------------------------------------
+//  Operation mix and seat-selection distributions for booking_loadgen.
+//
+//  Seats are addressed in a flat, hall-major space: index `i` is seat
+//  `i % kCapacity` of hall `i / kCapacity`.  A SeatPicker draws indices
+//  from that space:
+//
+//    • uniform  - every seat of every hall equally likely
+//    • zipf     - rank `k` drawn with weight 1 / k^s; the first hall's front
+//                 seats are the hottest, the tail spreads over all halls
+//    • hot      - a fraction `hot` of draws lands on hall 0 (any seat), the
+//                 rest is uniform over all halls
+//  ---------------------------------------------------------------------------
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace loadgen {
+
+/// One client operation, see Mix.
+enum class Op : std::uint8_t
+{
+    List,       ///< ListFreeSeats on the picked hall
+    Book,       ///< BookSeats on the picked seat
+    Hold,       ///< JoinQueue for the picked hall's movie
+};
+inline constexpr std::size_t kOps = 3;
+
+inline const char* opName(Op op) noexcept
+{
+    switch (op) {
+        case Op::List: return "list";
+        case Op::Book: return "book";
+        case Op::Hold: return "hold";
+    }
+    return "?";
+}
+
+/**
+ * @brief Relative weights of the three operations.
+ *
+ * Parsed from `list=20,book=70,hold=10`; weights need not sum to 100,
+ * omitted operations get weight 0.
+ */
+struct Mix
+{
+    double weight[kOps] = {20, 70, 10};
+
+    static Mix parse(const std::string& spec)
+    {
+        Mix m;
+        std::fill(std::begin(m.weight), std::end(m.weight), 0.0);
+        std::istringstream in{spec};
+        std::string item;
+        while (std::getline(in, item, ',')) {
+            const auto eq = item.find('=');
+            if (eq == std::string::npos)
+                throw std::invalid_argument("mix entry without '=': " + item);
+            const std::string name = item.substr(0, eq);
+            const double      w    = std::stod(item.substr(eq + 1));
+            if (w < 0) throw std::invalid_argument("negative mix weight: " + item);
+            if      (name == "list") m.weight[0] = w;
+            else if (name == "book") m.weight[1] = w;
+            else if (name == "hold") m.weight[2] = w;
+            else throw std::invalid_argument("unknown mix operation: " + name);
+        }
+        if (m.weight[0] + m.weight[1] + m.weight[2] <= 0)
+            throw std::invalid_argument("mix has no operations: " + spec);
+        return m;
+    }
+
+    /// Operation for a uniform draw @p u in [0, 1).
+    [[nodiscard]] Op pick(double u) const noexcept
+    {
+        double x = u * (weight[0] + weight[1] + weight[2]);
+        if ((x -= weight[0]) < 0) return Op::List;
+        if ((x -= weight[1]) < 0) return Op::Book;
+        return weight[2] > 0 ? Op::Hold : (weight[1] > 0 ? Op::Book : Op::List);
+    }
+
+    [[nodiscard]] std::string str() const
+    {
+        std::ostringstream os;
+        os << "list=" << weight[0] << ",book=" << weight[1] << ",hold=" << weight[2];
+        return os.str();
+    }
+};
+
+/// Seat-selection distribution, see SeatPicker.
+enum class Dist : std::uint8_t { Uniform, Zipf, Hot };
+
+inline Dist parseDist(const std::string& s)
+{
+    if (s == "uniform") return Dist::Uniform;
+    if (s == "zipf")    return Dist::Zipf;
+    if (s == "hot")     return Dist::Hot;
+    throw std::invalid_argument("unknown distribution: " + s);
+}
+
+/**
+ * @brief Draws flat seat indices in `[0, halls * seatsPerHall)`.
+ *
+ * Immutable after construction - share one picker between threads and
+ * give each thread its own engine.
+ */
+class SeatPicker
+{
+public:
+    /**
+     * @param dist          distribution
+     * @param halls         number of halls (≥ 1)
+     * @param seatsPerHall  seats per hall (≥ 1)
+     * @param param         zipf exponent `s` (Zipf) or hot fraction (Hot)
+     */
+    SeatPicker(Dist dist, std::size_t halls, std::size_t seatsPerHall, double param)
+        : dist_{dist}, halls_{halls}, perHall_{seatsPerHall}, param_{param}
+    {
+        if (halls == 0 || seatsPerHall == 0)
+            throw std::invalid_argument("seat picker needs at least one seat");
+        if (dist_ == Dist::Hot && (param_ < 0 || param_ > 1))
+            throw std::invalid_argument("hot fraction must be within [0, 1]");
+        if (dist_ == Dist::Zipf) {
+            cdf_.resize(size());
+            double sum = 0;
+            for (std::size_t k = 0; k < cdf_.size(); ++k)
+                cdf_[k] = sum += 1.0 / std::pow(static_cast<double>(k + 1), param_);
+            for (double& c : cdf_) c /= sum;
+        }
+    }
+
+    [[nodiscard]] std::size_t size()         const noexcept { return halls_ * perHall_; }
+    [[nodiscard]] std::size_t seatsPerHall() const noexcept { return perHall_; }
+
+    template <class Rng>
+    std::size_t operator()(Rng& rng) const
+    {
+        std::uniform_real_distribution<double> u01{0.0, 1.0};
+        switch (dist_) {
+            case Dist::Zipf: {
+                const auto it = std::upper_bound(cdf_.begin(), cdf_.end(), u01(rng));
+                return std::min<std::size_t>(static_cast<std::size_t>(it - cdf_.begin()),
+                                             size() - 1);
+            }
+            case Dist::Hot:
+                if (u01(rng) < param_)
+                    return std::uniform_int_distribution<std::size_t>{0, perHall_ - 1}(rng);
+                break;
+            case Dist::Uniform:
+                break;
+        }
+        return std::uniform_int_distribution<std::size_t>{0, size() - 1}(rng);
+    }
+
+private:
+    Dist                dist_;
+    std::size_t         halls_;
+    std::size_t         perHall_;
+    double              param_;
+    std::vector<double> cdf_;           ///< Zipf only
+};
+
+} // namespace loadgen
+#endif //LOADGEN_WORKLOAD_HPP
@@ -1,6 +1,13 @@
 #include "booking/domain/Movie.hpp"
+#include "booking/domain/StringArena.hpp"
 
 using namespace booking::domain;
 
-Movie::Movie(Id id, std::string t, std::string d)
-    : id_{id}, title_{std::move(t)}, description_{std::move(d)} {}
+Movie::Movie(Id id, std::string_view t, std::string_view d) noexcept
+    : title_{t.data()}, desc_{d.data()}, id_{id},
+      titleLen_{static_cast<std::uint32_t>(t.size())}, descLen_{static_cast<std::uint32_t>(d.size())} {}
+
+Movie Movie::interned(StringArena& arena) const
+{
+    return {id_, arena.intern(title()), arena.intern(desc())};
+}
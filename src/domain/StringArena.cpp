@@ -0,0 +1,103 @@
+#include "booking/domain/StringArena.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+using namespace booking::domain;
+
+namespace {
+constexpr std::size_t kPrefix = sizeof(std::uint32_t);
+}
+
+StringArena::StringArena(std::size_t chunk) : chunk_{std::max<std::size_t>(chunk, 256)} {}
+
+/* ─── lookup ────────────────────────────────────────────────────────────── */
+std::string_view StringArena::at(const char* text) noexcept
+{
+    std::uint32_t n = 0;
+    std::memcpy(&n, text - kPrefix, kPrefix);
+    return {text, n};
+}
+
+std::string_view StringArena::intern(std::string_view s)
+{
+    if (s.empty()) return {};
+    if (s.size() > std::numeric_limits<std::uint32_t>::max())
+        throw std::length_error("StringArena: string too long");
+
+    const std::lock_guard lock{mtx_};
+    if ((count_ + 1) * 4 > slots_.size() * 3) grow();
+
+    const std::size_t mask = slots_.size() - 1;
+    std::size_t i = std::hash<std::string_view>{}(s) & mask;
+    for (; slots_[i]; i = (i + 1) & mask)
+        if (at(slots_[i]) == s) return at(slots_[i]);
+
+    slots_[i] = store(s);
+    ++count_;
+    return {slots_[i], s.size()};
+}
+
+void StringArena::grow()
+{
+    std::vector<const char*> old(std::max<std::size_t>(64, slots_.size() * 2), nullptr);
+    old.swap(slots_);
+    const std::size_t mask = slots_.size() - 1;
+    for (const char* text : old) {
+        if (!text) continue;
+        std::size_t i = std::hash<std::string_view>{}(at(text)) & mask;
+        while (slots_[i]) i = (i + 1) & mask;
+        slots_[i] = text;
+    }
+}
+
+/* ─── storage ───────────────────────────────────────────────────────────── */
+char* StringArena::store(std::string_view s)
+{
+    const std::size_t need = kPrefix + s.size();
+    char* dst = nullptr;
+    if (need <= left_) {
+        dst    = next_;
+        next_ += need;
+        left_ -= need;
+    }
+    else if (need > chunk_ / 4) {                        // big: own chunk, open one stays open
+        chunks_.push_back(std::make_unique<char[]>(need));
+        capacity_ += need;
+        dst = chunks_.back().get();
+    }
+    else {
+        chunks_.push_back(std::make_unique<char[]>(chunk_));
+        capacity_ += chunk_;
+        dst   = chunks_.back().get();
+        next_ = dst + need;
+        left_ = chunk_ - need;
+    }
+    const auto n = static_cast<std::uint32_t>(s.size());
+    std::memcpy(dst, &n, kPrefix);
+    std::memcpy(dst + kPrefix, s.data(), s.size());
+    used_ += s.size();
+    return dst + kPrefix;
+}
+
+/* ─── stats ─────────────────────────────────────────────────────────────── */
+std::size_t StringArena::strings() const
+{
+    const std::lock_guard lock{mtx_};
+    return count_;
+}
+
+std::size_t StringArena::used() const
+{
+    const std::lock_guard lock{mtx_};
+    return used_;
+}
+
+std::size_t StringArena::capacity() const
+{
+    const std::lock_guard lock{mtx_};
+    return capacity_;
+}
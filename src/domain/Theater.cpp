@@ -1,10 +1,90 @@
 #include "booking/domain/Theater.hpp"
+#include "booking/telemetry/Tracer.hpp"
+#include <stdexcept>
+
+namespace {
+using Counter = std::atomic<std::uint64_t>;
+
+/// Single-writer increment: the caller holds the hall lock or owns the hall.
+void bump(Counter& c, std::uint64_t n = 1) noexcept
+{
+    c.store(c.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+void copy(Counter& to, const Counter& from) noexcept
+{
+    to.store(from.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+} // namespace
 
 using namespace booking::domain;
 
+static_assert(alignof(Theater) == Theater::kCacheLine, "a hall must not share a cache line");
+
+/* ─── pricing ───────────────────────────────────────────────────────────── */
+Theater::Pricing Theater::Pricing::standard() noexcept
+{
+    Pricing p{};
+    p.cents = {900, 1200, 1500, 0};
+    for (std::size_t i = 0; i < kCapacity; ++i)
+        p.tier[i] = i < 4 ? 0 : i < 16 ? 1 : 2;
+    return p;
+}
+
+/* ─── outcome ─────────────────────────────────────────────────────────── */
+const char* booking::domain::describe(BookStatus status) noexcept
+{
+    switch (status) {
+        case BookStatus::Booked:     return "booked";
+        case BookStatus::Taken:      return "seat already booked";
+        case BookStatus::Invalid:    return "seat index out of range";
+        case BookStatus::NotFound:   return "unknown movie or theater";
+        case BookStatus::Accessible: return "seat is a wheelchair bay";
+        case BookStatus::Distancing: return "seat too close to another party";
+        case BookStatus::SingleGap:  return "booking would leave a single empty seat";
+        case BookStatus::ReadOnly:   return "server is a read-only standby";
+        case BookStatus::Unreplicated: return "no standby confirmed the booking";
+    }
+    return "?";
+}
+
 /* ─── ctor ──────────────────────────────────────────────────────────────── */
 Theater::Theater(Id id, std::string nm)
-    : id_{id}, name_{std::move(nm)} {}
+    : Theater{id, std::move(nm), Pricing::standard()} {}
+
+Theater::Theater(Id id, std::string nm, const Pricing& pricing)
+    : Theater{id, std::move(nm), pricing, Rules{}} {}
+
+Theater::Theater(Id id, std::string nm, const Pricing& pricing, const Rules& rules)
+    : tier_{pricing.tier}, id_{id}, name_{std::move(nm)}
+{
+    for (std::size_t i = 0; i < kCapacity; ++i) {
+        if (tier_[i] >= kTiers)
+            throw std::invalid_argument("Theater: seat tier out of range");
+        price_[i] = pricing.cents[tier_[i]];
+    }
+    if (rules.accessible & ~kAllSeats)
+        throw std::invalid_argument("Theater: wheelchair bay out of range");
+    if (rules.buffer >= kCapacity)
+        throw std::invalid_argument("Theater: distancing buffer too large");
+
+    // compile the rules into masks for admits()
+    reserved_ = rules.accessible;
+    buffer_   = rules.buffer;
+    if (rules.noSingleGaps)                          // not the first / last seat
+        gapSeats_ = kAllSeats & ~SeatMask{1} & ~(SeatMask{1} << (kCapacity - 1));
+    telemetry::bindLockSite(mtx_, "theater", id_);
+}
+
+void Theater::copyCounters(const Theater& other) noexcept
+{
+    copy(counters_.attempts,     other.counters_.attempts);
+    copy(counters_.bookings,     other.counters_.bookings);
+    copy(counters_.seatsSold,    other.counters_.seatsSold);
+    copy(counters_.conflicts,    other.counters_.conflicts);
+    copy(counters_.refused,      other.counters_.refused);
+    copy(counters_.revenueCents, other.counters_.revenueCents);
+}
 
 /* ─── move ctor ─────────────────────────────────────────────────────────── */
 Theater::Theater(Theater&& other) noexcept {
@@ -12,6 +92,13 @@ Theater::Theater(Theater&& other) noexcept {
     id_        = other.id_;
     name_      = std::move(other.name_);
     occupancy_ = other.occupancy_;
+    price_     = other.price_;
+    tier_      = other.tier_;
+    reserved_  = other.reserved_;
+    gapSeats_  = other.gapSeats_;
+    buffer_    = other.buffer_;
+    copyCounters(other);
+    telemetry::bindLockSite(mtx_, "theater", id_);
 }
 
 /* ─── move assign ───────────────────────────────────────────────────────── */
@@ -21,12 +108,32 @@ Theater& Theater::operator=(Theater&& other) noexcept {
     id_        = other.id_;
     name_      = std::move(other.name_);
     occupancy_ = other.occupancy_;
+    price_     = other.price_;
+    tier_      = other.tier_;
+    reserved_  = other.reserved_;
+    gapSeats_  = other.gapSeats_;
+    buffer_    = other.buffer_;
+    copyCounters(other);
+    telemetry::bindLockSite(mtx_, "theater", id_);
     return *this;
 }
 
 std::vector<Seat> Theater::freeSeats() const
 {
+    telemetry::TraceSpan wait{"theater.lock_wait"};
     std::scoped_lock lk{mtx_};
+    wait.finish();
+    return freeList();
+}
+
+std::vector<Seat> Theater::freeSeatsOwned() const
+{
+    return freeList();
+}
+
+std::vector<Seat> Theater::freeList() const
+{
+    const telemetry::TraceSpan span{"theater.freeSeats"};
     std::vector<Seat> v;
     for (std::size_t i = 0; i < kCapacity; ++i)
         if (!occupancy_.test(i))
@@ -36,25 +143,85 @@ std::vector<Seat> Theater::freeSeats() const
 
 bool Theater::tryBook(const std::vector<Seat>& seats)
 {
-    std::scoped_lock lk{mtx_};
+    return book(seats) == BookStatus::Booked;
+}
 
+BookStatus Theater::book(const std::vector<Seat>& seats, bool accessible)
+{
     // a) validate indices first - reject out-of-range requests
-    for (const auto& s : seats) {
-        if (s.index >= kCapacity) { 
-            return false;
-        }
-    }
+    const auto mask = maskOf(seats);
+    if (!mask) return BookStatus::Invalid;
+    const auto price = quote(*mask);
 
-    // b) reject if *any* seat already taken
-    for (const auto& s : seats) {
-        if (occupancy_.test(s.index)) { 
-            return false;
+    telemetry::TraceSpan wait{"theater.lock_wait"};
+    std::scoped_lock lk{mtx_};
+    wait.finish();
+    return commit(*mask, price, accessible);
+}
+
+BookStatus Theater::bookOwned(const std::vector<Seat>& seats, bool accessible)
+{
+    const auto mask = maskOf(seats);
+    if (!mask) return BookStatus::Invalid;
+    return commit(*mask, quote(*mask), accessible);
+}
+
+BookStatus Theater::commit(SeatMask seats, std::uint64_t price, bool accessible)
+{
+    const telemetry::TraceSpan span{"theater.tryBook"};
+
+    // b) occupancy + seating rules, one word each
+    const auto taken  = static_cast<SeatMask>(occupancy_.to_ulong());
+    const auto status = admits(taken, seats, accessible);
+
+    // c) reserve on success, count the outcome either way
+    bump(counters_.attempts);
+    switch (status) {
+        case BookStatus::Booked: {
+            const std::bitset<kCapacity> picked{seats};
+            occupancy_ |= picked;
+            bump(counters_.bookings);
+            bump(counters_.seatsSold, picked.count());
+            bump(counters_.revenueCents, price);
+            break;
         }
+        case BookStatus::Taken: bump(counters_.conflicts); break;
+        default:                bump(counters_.refused);   break;
     }
+    return status;
+}
+
+void Theater::occupy(SeatMask seats)
+{
+    std::scoped_lock lk{mtx_};
+    occupancy_ |= std::bitset<kCapacity>{seats & kAllSeats};
+}
 
-    // c) all good -> reserve
+Sales Theater::sales() const noexcept
+{
+    Sales s;
+    s.attempts     = counters_.attempts.load(std::memory_order_relaxed);
+    s.bookings     = counters_.bookings.load(std::memory_order_relaxed);
+    s.seatsSold    = counters_.seatsSold.load(std::memory_order_relaxed);
+    s.conflicts    = counters_.conflicts.load(std::memory_order_relaxed);
+    s.refused      = counters_.refused.load(std::memory_order_relaxed);
+    s.revenueCents = counters_.revenueCents.load(std::memory_order_relaxed);
+    return s;
+}
+
+std::optional<Theater::SeatMask> Theater::maskOf(const std::vector<Seat>& seats) noexcept
+{
+    SeatMask mask = 0;
     for (const auto& s : seats) {
-        occupancy_.set(s.index);
+        if (s.index >= kCapacity) return std::nullopt;
+        mask |= SeatMask{1} << s.index;
     }
-    return true;
+    return mask;
+}
+
+std::optional<std::uint64_t> Theater::quote(const std::vector<Seat>& seats) const
+{
+    const auto mask = maskOf(seats);
+    if (!mask) return std::nullopt;
+    return quote(*mask);
 }
@@ -0,0 +1,78 @@
+#include "booking/domain/TheaterSlab.hpp"
+#include <algorithm>
+#include <new>
+
+using namespace booking::domain;
+
+namespace {
+constexpr std::size_t kLine = Theater::kCacheLine;
+
+constexpr std::size_t roundUp(std::size_t n) noexcept { return (n + kLine - 1) / kLine * kLine; }
+} // namespace
+
+TheaterSlab::TheaterSlab(std::size_t perSlab)
+    : pool_{std::make_shared<Pool>(std::max<std::size_t>(perSlab, 1))} {}
+
+/* ─── stats ─────────────────────────────────────────────────────────────── */
+std::size_t TheaterSlab::live() const
+{
+    const std::lock_guard lock{pool_->mtx_};
+    return pool_->live_;
+}
+
+std::size_t TheaterSlab::slabs() const
+{
+    const std::lock_guard lock{pool_->mtx_};
+    return pool_->slabs_.size();
+}
+
+std::size_t TheaterSlab::blockSize() const
+{
+    const std::lock_guard lock{pool_->mtx_};
+    return pool_->block_;
+}
+
+/* ─── pool ──────────────────────────────────────────────────────────────── */
+TheaterSlab::Pool::~Pool()
+{
+    for (void* s : slabs_) ::operator delete(s, std::align_val_t{kLine});
+}
+
+void* TheaterSlab::Pool::allocate(std::size_t bytes, std::size_t align)
+{
+    if (align > kLine) throw std::bad_alloc{};
+    const std::size_t size = roundUp(bytes);
+    {
+        const std::lock_guard lock{mtx_};
+        if (!block_) block_ = size;
+        if (size == block_) {
+            if (!free_) {                                    // thread a new slab onto the list
+                slabs_.reserve(slabs_.size() + 1);
+                auto* s = static_cast<std::byte*>(::operator new(block_ * perSlab_, std::align_val_t{kLine}));
+                slabs_.push_back(s);
+                for (std::size_t i = perSlab_; i-- > 0;) {
+                    void* b = s + i * block_;
+                    *static_cast<void**>(b) = free_;
+                    free_ = b;
+                }
+            }
+            void* b = free_;
+            free_ = *static_cast<void**>(b);
+            ++live_;
+            return b;
+        }
+    }
+    return ::operator new(size, std::align_val_t{kLine});    // not the hall block
+}
+
+void TheaterSlab::Pool::deallocate(void* p, std::size_t bytes) noexcept
+{
+    const std::lock_guard lock{mtx_};
+    if (roundUp(bytes) != block_) {
+        ::operator delete(p, std::align_val_t{kLine});
+        return;
+    }
+    *static_cast<void**>(p) = free_;
+    free_ = p;
+    --live_;
+}
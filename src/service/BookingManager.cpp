@@ -1,4 +1,6 @@
 #include "booking/service/BookingManager.hpp"
+#include <exception>
+#include <future>
 
 using namespace booking;
 
@@ -6,12 +8,56 @@ service::BookingManager::BookingManager(
         std::shared_ptr<service::IBookingRepository> repo)
     : repo_(std::move(repo)) {}
 
+service::BookingManager::BookingManager(
+        std::shared_ptr<service::IBookingRepository> repo,
+        std::shared_ptr<service::HallExecutor>       owners)
+    : repo_(std::move(repo)), owners_(std::move(owners)) {}
+
+template <class Fn>
+auto service::BookingManager::onOwner(domain::Movie::Id m, domain::Theater::Id t, Fn fn) const
+{
+    const auto w = owners_->ownerOf(m, t);
+    if (owners_->current() == w) return fn();            // already there
+
+    using R = decltype(fn());
+    std::promise<R> done;
+    auto result = done.get_future();
+    owners_->post(w, [&done, &fn] {
+        try {
+            done.set_value(fn());
+        } catch (...) {
+            done.set_exception(std::current_exception());
+        }
+    });
+    return result.get();
+}
+
 std::vector<domain::Movie>
 service::BookingManager::movies() const
 {
     return repo_->movies();
 }
 
+service::Page<domain::Movie>
+service::BookingManager::moviesPage(domain::Movie::Id after, std::size_t limit) const
+{
+    return repo_->moviesPage(after, limit);
+}
+
+std::optional<service::Page<std::shared_ptr<const domain::Theater>>>
+service::BookingManager::theatersPage(domain::Movie::Id m,
+                                      domain::Theater::Id after,
+                                      std::size_t limit) const
+{
+    return repo_->theatersPage(m, after, limit);
+}
+
+std::vector<domain::Movie>
+service::BookingManager::searchMovies(std::string_view query, std::size_t limit) const
+{
+    return repo_->searchMovies(query, limit);
+}
+
 std::vector<std::shared_ptr<const domain::Theater>>
 service::BookingManager::theaters(domain::Movie::Id id) const
 {
@@ -22,12 +68,99 @@ std::vector<domain::Seat>
 service::BookingManager::freeSeats(domain::Movie::Id m,
                                    domain::Theater::Id t) const
 {
-    return repo_->freeSeats(m, t);
+    if (!owners_) return repo_->freeSeats(m, t);
+    return onOwner(m, t, [&] { return repo_->freeSeatsOwned(m, t); });
+}
+
+std::optional<std::uint64_t>
+service::BookingManager::quote(domain::Movie::Id m,
+                               domain::Theater::Id t,
+                               const std::vector<domain::Seat>& s) const
+{
+    return repo_->quote(m, t, s);
+}
+
+std::vector<service::MovieSales> service::BookingManager::sales(domain::Movie::Id m) const
+{
+    return repo_->sales(m);
 }
 
 bool service::BookingManager::book(domain::Movie::Id m,
                                    domain::Theater::Id t,
                                    const std::vector<domain::Seat>& s)
 {
-    return repo_->book(m, t, s);
+    if (!owners_) return repo_->book(m, t, s);
+    return reserve(m, t, s).status == domain::BookStatus::Booked;
+}
+
+service::Reservation service::BookingManager::reserve(domain::Movie::Id m,
+                                                      domain::Theater::Id t,
+                                                      const std::vector<domain::Seat>& s,
+                                                      bool accessible)
+{
+    if (!owners_) return repo_->reserve(m, t, s, accessible);
+    return onOwner(m, t, [&] { return repo_->reserveOwned(m, t, s, accessible); });
+}
+
+void service::BookingManager::reserveAsync(domain::Movie::Id m,
+                                           domain::Theater::Id t,
+                                           std::vector<domain::Seat> s,
+                                           bool accessible,
+                                           std::function<void(Reservation)> done)
+{
+    if (!owners_) {
+        done(repo_->reserve(m, t, s, accessible));
+        return;
+    }
+    owners_->post(owners_->ownerOf(m, t),
+                  [repo = repo_, m, t, s = std::move(s), accessible, done = std::move(done)] {
+                      Reservation r;                     // NotFound if the repository throws
+                      try {
+                          r = repo->reserveOwned(m, t, s, accessible);
+                      } catch (...) {
+                      }
+                      try {
+                          done(r);
+                      } catch (...) {                    // must not take the worker down
+                      }
+                  });
+}
+
+void service::BookingManager::freeSeatsAsync(domain::Movie::Id m,
+                                             domain::Theater::Id t,
+                                             std::function<void(std::vector<domain::Seat>)> done) const
+{
+    const auto list = [repo = repo_, m, t](bool owned) {
+        try {
+            return owned ? repo->freeSeatsOwned(m, t) : repo->freeSeats(m, t);
+        } catch (const std::exception&) {                // unknown hall
+            return std::vector<domain::Seat>{};
+        }
+    };
+    if (!owners_) {
+        done(list(false));
+        return;
+    }
+    owners_->post(owners_->ownerOf(m, t), [list, done = std::move(done)] { done(list(true)); });
+}
+
+service::CatalogStatus
+service::BookingManager::addMovie(domain::Movie movie)
+{
+    return repo_->addMovie(std::move(movie));
+}
+
+service::CatalogStatus
+service::BookingManager::addScreening(domain::Movie::Id m,
+                                      domain::Theater::Id t,
+                                      std::string name)
+{
+    return repo_->addScreening(m, t, std::move(name));
+}
+
+service::CatalogStatus
+service::BookingManager::retireScreening(domain::Movie::Id m,
+                                         domain::Theater::Id t)
+{
+    return repo_->retireScreening(m, t);
 }
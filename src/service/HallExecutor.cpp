@@ -0,0 +1,159 @@
+#include "booking/service/HallExecutor.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace booking::service;
+
+namespace {
+
+/// Empty polls before a worker parks.
+constexpr int kSpins = 4096;
+
+struct Self
+{
+    const HallExecutor* owner = nullptr;
+    std::size_t         index = 0;
+};
+thread_local Self tSelf;
+
+void pinTo(std::thread& t, std::size_t cpu)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(t.native_handle(), sizeof set, &set);   // best effort
+#else
+    (void)t;
+    (void)cpu;
+#endif
+}
+
+} // namespace
+
+/* ─── ctor / dtor ───────────────────────────────────────────────────────── */
+HallExecutor::HallExecutor(std::size_t workers, bool pin)
+{
+    const std::size_t hw = std::max(1u, std::thread::hardware_concurrency());
+    if (workers == 0) workers = hw;
+
+    workers_.reserve(workers);
+    for (std::size_t i = 0; i < workers; ++i) workers_.push_back(std::make_unique<Worker>());
+    for (std::size_t i = 0; i < workers; ++i) {
+        workers_[i]->thread = std::thread{[this, i] { run(i); }};
+        if (pin) pinTo(workers_[i]->thread, i % hw);
+    }
+}
+
+HallExecutor::~HallExecutor()
+{
+    stop_.store(true);
+    for (auto& w : workers_) {
+        {
+            const std::lock_guard lock{w->mtx};
+            w->sleeping.store(false);
+        }
+        w->cv.notify_one();
+    }
+    for (auto& w : workers_) w->thread.join();
+}
+
+/* ─── routing ───────────────────────────────────────────────────────────── */
+std::size_t HallExecutor::ownerOf(domain::Movie::Id m, domain::Theater::Id t) const noexcept
+{
+    const std::uint64_t key = std::uint64_t{m} << 32 | t;
+    return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) % workers_.size();
+}
+
+std::size_t HallExecutor::current() const noexcept
+{
+    return tSelf.owner == this ? tSelf.index : workers_.size();
+}
+
+/* ─── queue ─────────────────────────────────────────────────────────────── */
+void HallExecutor::push(Worker& w, Node* n) noexcept
+{
+    n->next.store(nullptr, std::memory_order_relaxed);
+    Node* prev = w.tail.exchange(n);                   // seq_cst, pairs with idle()
+    prev->next.store(n, std::memory_order_release);
+}
+
+HallExecutor::Node* HallExecutor::pop(Worker& w) noexcept
+{
+    Node* head = w.head;
+    Node* next = head->next.load(std::memory_order_acquire);
+    if (head == &w.stub) {                             // skip the placeholder
+        if (!next) return nullptr;
+        w.head = head = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+    if (next) {
+        w.head = next;
+        return head;
+    }
+    if (head != w.tail.load()) return nullptr;         // a producer is mid-push
+
+    push(w, &w.stub);                                  // head is the last node
+    next = head->next.load(std::memory_order_acquire);
+    if (next) {
+        w.head = next;
+        return head;
+    }
+    return nullptr;
+}
+
+bool HallExecutor::idle(const Worker& w) noexcept
+{
+    return w.head == &w.stub && w.tail.load() == &w.stub;
+}
+
+void HallExecutor::post(std::size_t w, Task task)
+{
+    if (w >= workers_.size()) throw std::out_of_range("HallExecutor: no such worker");
+    Worker& wk = *workers_[w];
+    push(wk, new Node{{nullptr}, std::move(task)});
+
+    if (wk.sleeping.load()) {                          // seq_cst, see run()
+        {
+            const std::lock_guard lock{wk.mtx};
+            wk.sleeping.store(false);
+        }
+        wk.cv.notify_one();
+    }
+}
+
+/* ─── worker loop ───────────────────────────────────────────────────────── */
+void HallExecutor::run(std::size_t index)
+{
+    tSelf = {this, index};
+    Worker& w = *workers_[index];
+
+    for (int spins = 0;;) {
+        if (Node* n = pop(w)) {
+            n->task();
+            delete n;
+            spins = 0;
+            continue;
+        }
+        if (++spins < kSpins) continue;
+
+        // Park.  `sleeping` is raised *before* the final emptiness check and
+        // post() reads it *after* its exchange, so one of the two always
+        // sees the other.
+        std::unique_lock lock{w.mtx};
+        w.sleeping.store(true);
+        if (!idle(w)) {
+            w.sleeping.store(false);
+            spins = 0;
+            continue;
+        }
+        if (stop_.load()) break;
+        w.cv.wait(lock, [&] { return !w.sleeping.load(); });
+        spins = 0;
+    }
+}
@@ -3,28 +3,64 @@
  *  @brief Simple thread-safe, in-memory implementation of
  *         booking::service::IBookingRepository.
  *
- *  The repository keeps all data in STL containers, guarded by a
- *  `std::shared_mutex`:
- *  * many concurrent read-only operations are allowed (`shared_lock`)
- *  * writers (`book()`) obtain an exclusive lock
+ *  The catalog (movies and their screenings) is an **immutable snapshot**
+ *  published through an atomic pointer, read-copy-update style:
+ *  * readers (`movies()`, `theaters()`, `freeSeats()`, `book()`) pin the
+ *    current snapshot by bumping a striped reader counter - no mutex at all;
+ *    seat state lives in the shared `Theater` objects, so `book()` only ever
+ *    takes the hall's own mutex (none at all via `reserveOwned()` /
+ *    `freeSeatsOwned()`, whose caller owns the hall)
+ *  * catalog writers (`addMovie()`, `addScreening()`, `retireScreening()`)
+ *    serialise on a writer mutex, copy the snapshot, publish the copy and
+ *    then wait for a grace period before freeing the old one - in-flight
+ *    bookings are never blocked
+ *  * with `BOOKING_LOCK_PROFILING` the writer mutex is reported as site
+ *    *catalog 0*
+ *  * `sales()` reads per-movie totals kept in per-core stripes beside each
+ *    entry (bumped by `reserve()`, kept across retired screenings) and the
+ *    halls' own counters
+ *  * `searchMovies()` runs against a @ref MovieIndex kept beside the
+ *    snapshot; addMovie() extends it after publishing, under its own
+ *    reader/writer lock
+ *  * movie titles and synopses are interned in a @ref StringArena, so an
+ *    entry holds a 32-byte `Movie` and snapshot copies / `movies()` copy
+ *    no strings; the arena may be shared between repositories (a standby
+ *    swaps in a new one on every resync)
+ *  * halls come from a @ref TheaterSlab: cache-line-aligned slab blocks,
+ *    recycled when a retired hall's last reference goes
  *
  *  @note
  *  * **No** persistence layer - everything lives only for the life-time
  *    of the process.
  *  * Capacity of every theatre is fixed to @c Theater::kCapacity (20).
+ *  * Every hall, seeded or added later, gets the same house seating rules.
  *  * The initial dataset is hard-coded in #seed().
  */
 
 #include "booking/service/IBookingRepository.hpp"
 #include "booking/domain/Movie.hpp"
+#include "booking/domain/StringArena.hpp"
 #include "booking/domain/Theater.hpp"
+#include "booking/domain/TheaterSlab.hpp"
+#include "booking/telemetry/LockProfiler.hpp"
+#include "booking/telemetry/Metrics.hpp"
+#include "booking/telemetry/Tracer.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <shared_mutex>
+#include <thread>
 #include <unordered_map>
-#include <memory>
 
+using booking::domain::BookStatus;
 using booking::domain::Movie;
+using booking::domain::StringArena;
 using booking::domain::Theater;
+using booking::domain::TheaterSlab;
 using booking::domain::Seat;
 
 namespace booking::service {
@@ -38,38 +74,125 @@ namespace booking::service {
  *  @brief Concrete implementation of IBookingRepository that stores everything
  *         in RAM.
  *
- *  All public member functions acquire a lock internally, therefore callers
+ *  All public member functions synchronise internally, therefore callers
  *  can use the same instance from multiple threads without additional
  *  synchronisation.
  */
 class InMemoryRepository final : public IBookingRepository
 {
+    /* ------------------------------------------------------------------ data */
+    /** Per-movie sales counters, striped per core; fields as in domain::Sales. */
+    enum SaleField : std::size_t { Attempts, Bookings, SeatsSold, Conflicts, Refused, Revenue, kSaleFields };
+    using MovieCounters = telemetry::CounterSet<kSaleFields>;
+
+    /** Simple aggregate that bundles one movie with all its theaters. */
+    struct Entry {
+        Movie movie;
+        std::map<Theater::Id, std::shared_ptr<Theater>> theaters;   ///< by id, for paging
+        std::shared_ptr<MovieCounters> sales = std::make_shared<MovieCounters>();   ///< shared by snapshots
+    };
+    /** One published snapshot. */
+    struct Catalog {
+        std::unordered_map<Movie::Id, Entry> byId;
+        std::vector<Movie::Id>               order;   ///< byId keys ascending, for paging
+    };
+
 public:
-    /** Constructs the repo and populates it with three movies / four theaters. */
-    InMemoryRepository() { seed(); }
+    /**
+     * Constructs the repo and populates it with three movies / four theaters;
+     * movie text goes to @p text (a private arena when `nullptr`).
+     */
+    explicit InMemoryRepository(const Theater::Rules&        house = {},
+                                std::shared_ptr<StringArena> text  = nullptr)
+        : house_{house}, text_{text ? std::move(text) : std::make_shared<StringArena>()}
+    {
+        telemetry::bindLockSite(writeMtx_, "catalog", 0);
+        auto initial = std::make_unique<Catalog>();
+        seed(*initial);
+        for (const auto& kv : initial->byId) {
+            index_.add(kv.second.movie);
+            initial->order.push_back(kv.first);
+        }
+        std::sort(initial->order.begin(), initial->order.end());
+        current_.store(initial.release());
+    }
+
+    ~InMemoryRepository() override { delete current_.load(); }
+
+    InMemoryRepository(const InMemoryRepository&)            = delete;
+    InMemoryRepository& operator=(const InMemoryRepository&) = delete;
 
     // ------------------------------------------------------------------ I/F --
     /// @copydoc IBookingRepository::movies()
     std::vector<Movie> movies() const override
     {
-        std::shared_lock read{rw_};
+        const ReadGuard read{*this};
 
         std::vector<Movie> result;
-        result.reserve(db_.size());
-        for (auto& kv : db_) {
+        result.reserve(read->byId.size());
+        for (auto& kv : read->byId) {
             result.push_back(kv.second.movie);
         }
         return result;
     }
 
+    /// @copydoc IBookingRepository::moviesPage()
+    Page<Movie> moviesPage(Movie::Id after, std::size_t limit) const override
+    {
+        const ReadGuard read{*this};
+
+        Page<Movie> page;
+        auto it = std::upper_bound(read->order.begin(), read->order.end(), after);
+        for (; it != read->order.end() && page.items.size() < limit; ++it)
+            page.items.push_back(read->byId.at(*it).movie);
+        page.more = it != read->order.end();
+        return page;
+    }
+
+    /// @copydoc IBookingRepository::theatersPage()
+    std::optional<Page<std::shared_ptr<const Theater>>>
+    theatersPage(Movie::Id m, Theater::Id after, std::size_t limit) const override
+    {
+        const ReadGuard read{*this};
+
+        const auto mIt = read->byId.find(m);
+        if (mIt == read->byId.end()) return std::nullopt;
+
+        const auto& halls = mIt->second.theaters;
+        Page<std::shared_ptr<const Theater>> page;
+        auto it = halls.upper_bound(after);
+        for (; it != halls.end() && page.items.size() < limit; ++it)
+            page.items.push_back(it->second);
+        page.more = it != halls.end();
+        return page;
+    }
+
+    /// @copydoc IBookingRepository::searchMovies()
+    std::vector<Movie> searchMovies(std::string_view query, std::size_t limit) const override
+    {
+        std::vector<MovieIndex::Hit> hits;
+        {
+            const std::shared_lock lk{indexMtx_};
+            hits = index_.search(query, limit);
+        }
+
+        const ReadGuard read{*this};
+        std::vector<Movie> result;
+        result.reserve(hits.size());
+        for (const auto& h : hits)
+            if (const auto it = read->byId.find(h.id); it != read->byId.end())
+                result.push_back(it->second.movie);
+        return result;
+    }
+
     /// @copydoc IBookingRepository::theaters()
     std::vector<std::shared_ptr<const Theater>> theaters(Movie::Id m) const override
     {
-        std::shared_lock read{rw_};
+        const ReadGuard read{*this};
 
         std::vector<std::shared_ptr<const Theater>> result;
-        const auto it = db_.find(m);
-        if (it == db_.end()) {
+        const auto it = read->byId.find(m);
+        if (it == read->byId.end()) {
             return result;                         // unknown movie -> empty list
         }
 
@@ -82,57 +205,273 @@ public:
     /// @copydoc IBookingRepository::freeSeats()
     std::vector<Seat> freeSeats(Movie::Id m, Theater::Id t) const override
     {
-        std::shared_lock read{rw_};
-        return db_.at(m).theaters.at(t)->freeSeats();
+        telemetry::TraceSpan lookup{"repository.lookup"};
+        const ReadGuard read{*this};
+        const auto& theater = read->byId.at(m).theaters.at(t);
+        lookup.finish();
+        return theater->freeSeats();
+    }
+
+    /// @copydoc IBookingRepository::freeSeatsOwned()
+    std::vector<Seat> freeSeatsOwned(Movie::Id m, Theater::Id t) const override
+    {
+        telemetry::TraceSpan lookup{"repository.lookup"};
+        const ReadGuard read{*this};
+        const auto& theater = read->byId.at(m).theaters.at(t);
+        lookup.finish();
+        return theater->freeSeatsOwned();
+    }
+
+    /// @copydoc IBookingRepository::quote()
+    std::optional<std::uint64_t> quote(Movie::Id m, Theater::Id t,
+                                       const std::vector<Seat>& seats) const override
+    {
+        const ReadGuard read{*this};
+
+        const auto mIt = read->byId.find(m);
+        if (mIt == read->byId.end()) return std::nullopt;
+        const auto tIt = mIt->second.theaters.find(t);
+        if (tIt == mIt->second.theaters.end()) return std::nullopt;
+
+        return tIt->second->quote(seats);
     }
 
     /// @copydoc IBookingRepository::book()
     bool book(Movie::Id m, Theater::Id t,
               const std::vector<Seat>& seats) override
     {
-        std::shared_lock read{rw_};
+        return reserve(m, t, seats, false).status == BookStatus::Booked;
+    }
+
+    /// @copydoc IBookingRepository::reserve()
+    Reservation reserve(Movie::Id m, Theater::Id t,
+                        const std::vector<Seat>& seats, bool accessible) override
+    {
+        return reserveIn(m, t, seats, accessible, false);
+    }
+
+    /// @copydoc IBookingRepository::reserveOwned()
+    Reservation reserveOwned(Movie::Id m, Theater::Id t,
+                             const std::vector<Seat>& seats, bool accessible) override
+    {
+        return reserveIn(m, t, seats, accessible, true);
+    }
+
+    /// @copydoc IBookingRepository::occupy()
+    CatalogStatus occupy(Movie::Id m, Theater::Id t, Theater::SeatMask seats) override
+    {
+        const ReadGuard read{*this};
+        const auto mIt = read->byId.find(m);
+        if (mIt == read->byId.end()) return CatalogStatus::NotFound;
+        const auto tIt = mIt->second.theaters.find(t);
+        if (tIt == mIt->second.theaters.end()) return CatalogStatus::NotFound;
+        tIt->second->occupy(seats);
+        return CatalogStatus::Ok;
+    }
+
+    /// @copydoc IBookingRepository::sales()
+    std::vector<MovieSales> sales(Movie::Id m) const override
+    {
+        const ReadGuard read{*this};
 
-        const auto mIt = db_.find(m);
-        if (mIt == db_.end()) {                    // unknown movie
-            return false;
+        std::vector<MovieSales> out;
+        for (const Movie::Id id : read->order) {
+            if (m != 0 && id != m) continue;
+            const Entry& e = read->byId.at(id);
+
+            MovieSales ms;
+            ms.id = id;
+            const auto v = e.sales->values();
+            ms.total = {v[Attempts], v[Bookings], v[SeatsSold], v[Conflicts], v[Refused], v[Revenue]};
+            ms.halls.reserve(e.theaters.size());
+            for (const auto& [tid, hall] : e.theaters) ms.halls.emplace_back(tid, hall->sales());
+            out.push_back(std::move(ms));
+        }
+        return out;
+    }
+
+    // --------------------------------------------------------- catalog I/F --
+    /// @copydoc IBookingRepository::addMovie()
+    CatalogStatus addMovie(Movie movie) override
+    {
+        if (movie.id() == 0) return CatalogStatus::Invalid;
+        movie = movie.interned(*text_);                  // caller's strings may go away
+
+        const CatalogStatus st = update([&](Catalog& next) {
+            if (next.byId.count(movie.id())) return CatalogStatus::AlreadyExists;
+            next.byId[movie.id()].movie = movie;
+            next.order.insert(std::upper_bound(next.order.begin(), next.order.end(), movie.id()),
+                              movie.id());
+            return CatalogStatus::Ok;
+        });
+        if (st == CatalogStatus::Ok) {
+            const std::unique_lock lk{indexMtx_};
+            index_.add(movie);
+        }
+        return st;
+    }
+
+    /// @copydoc IBookingRepository::addScreening()
+    CatalogStatus addScreening(Movie::Id m, Theater::Id t, std::string name) override
+    {
+        if (t == 0) return CatalogStatus::Invalid;
+
+        return update([&](Catalog& next) {
+            const auto it = next.byId.find(m);
+            if (it == next.byId.end()) return CatalogStatus::NotFound;
+            if (it->second.theaters.count(t)) return CatalogStatus::AlreadyExists;
+            it->second.theaters.emplace(t, hall(t, std::move(name)));
+            return CatalogStatus::Ok;
+        });
+    }
+
+    /// @copydoc IBookingRepository::retireScreening()
+    CatalogStatus retireScreening(Movie::Id m, Theater::Id t) override
+    {
+        return update([&](Catalog& next) {
+            const auto it = next.byId.find(m);
+            if (it == next.byId.end() || it->second.theaters.erase(t) == 0)
+                return CatalogStatus::NotFound;
+            return CatalogStatus::Ok;
+        });
+    }
+
+private:
+    /// reserve() body; @p owned skips the hall lock.
+    Reservation reserveIn(Movie::Id m, Theater::Id t,
+                          const std::vector<Seat>& seats, bool accessible, bool owned)
+    {
+        telemetry::TraceSpan lookup{"repository.lookup"};
+        const ReadGuard read{*this};
+
+        const auto mIt = read->byId.find(m);
+        if (mIt == read->byId.end()) {                  // unknown movie
+            return {BookStatus::NotFound};
         }
 
         const auto tIt = mIt->second.theaters.find(t);
         if (tIt == mIt->second.theaters.end()) {   // unknown theatre
-            return false;
+            return {BookStatus::NotFound};
         }
+        lookup.finish();
+
+        const BookStatus status = owned ? tIt->second->bookOwned(seats, accessible)
+                                        : tIt->second->book(seats, accessible);
+        if (status == BookStatus::Invalid) return {status};
 
-        return tIt->second->tryBook(seats);
+        MovieCounters& sales = *mIt->second.sales;         // survives retired halls
+        sales.inc(Attempts);
+        Reservation r{status};
+        switch (status) {
+            case BookStatus::Booked: {
+                const auto mask = Theater::maskOf(seats).value_or(0);   // duplicates collapse
+                r.totalCents = tIt->second->quote(mask);           // the hall just booked
+                sales.inc(Bookings);
+                sales.inc(SeatsSold, std::bitset<Theater::kCapacity>{mask}.count());
+                sales.inc(Revenue, r.totalCents);
+                break;
+            }
+            case BookStatus::Taken: sales.inc(Conflicts); break;
+            default:                sales.inc(Refused);   break;
+        }
+        return r;
     }
 
-private:
-    /** Populates #db_ with a fixed test dataset. */
-    void seed()
+    /** A new hall under the house rules. */
+    std::shared_ptr<Theater> hall(Theater::Id t, std::string name) const
+    {
+        return halls_.make(t, std::move(name), Theater::Pricing::standard(), house_);
+    }
+
+    /** Populates @p db with a fixed test dataset. */
+    void seed(Catalog& db) const
     {
-        Movie inter{1, "Interstellar"};
-        Movie inception{2, "Inception"};
+        const Movie inter     = Movie{1, "Interstellar"}.interned(*text_);
+        const Movie inception = Movie{2, "Inception"}.interned(*text_);
 
-        db_[inter.id()].movie    = inter;
-        db_[inception.id()].movie = inception;
+        db.byId[inter.id()].movie    = inter;
+        db.byId[inception.id()].movie = inception;
 
-        db_[1].theaters.emplace(
-            101, std::make_shared<Theater>(101, "CinemaA-Hall1"));
-        db_[1].theaters.emplace(
-            102, std::make_shared<Theater>(102, "CinemaA-Hall2"));
-        db_[2].theaters.emplace(
-            201, std::make_shared<Theater>(201, "CinemaB-Hall1"));
+        db.byId[1].theaters.emplace(
+            101, hall(101, "CinemaA-Hall1"));
+        db.byId[1].theaters.emplace(
+            102, hall(102, "CinemaA-Hall2"));
+        db.byId[2].theaters.emplace(
+            201, hall(201, "CinemaB-Hall1"));
     }
 
-private:
-    /* ------------------------------------------------------------------ impl */
-    /** Simple aggregate that bundles one movie with all its theaters. */
-    struct Entry {
-        Movie movie;
-        std::unordered_map<Theater::Id, std::shared_ptr<Theater>> theaters;
+    /* ------------------------------------------------------------ snapshot */
+    /**
+     * Pins the current catalog for the guard's lifetime.  The reader first
+     * registers in its counter stripe of the current epoch parity, *then*
+     * loads the pointer, so once a writer has seen every stripe of both
+     * parities drain, nobody can still hold the snapshot it replaced.
+     */
+    class ReadGuard
+    {
+    public:
+        explicit ReadGuard(const InMemoryRepository& r) noexcept
+            : ctr_{&r.readers_[r.epoch_.load() & 1][telemetry::stripeIndex()].n}
+        {
+            ctr_->fetch_add(1);
+            cat_ = r.current_.load();
+        }
+        ~ReadGuard() { ctr_->fetch_sub(1, std::memory_order_release); }
+
+        ReadGuard(const ReadGuard&)            = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        const Catalog* operator->() const noexcept { return cat_; }
+        const Catalog& operator*()  const noexcept { return *cat_; }
+
+    private:
+        std::atomic<std::uint64_t>* ctr_;
+        const Catalog*              cat_ = nullptr;
     };
 
-    mutable std::shared_mutex            rw_;   ///< readers/writer lock
-    std::unordered_map<Movie::Id, Entry> db_;   ///< whole dataset
+    /**
+     * Copy-modify-publish under the writer mutex.  @p mutate edits the copy
+     * and returns the outcome; nothing is published unless it is `Ok`.
+     */
+    template <class Fn>
+    CatalogStatus update(Fn&& mutate)
+    {
+        std::scoped_lock lk{writeMtx_};
+
+        auto next = std::make_unique<Catalog>(*current_.load());
+        const CatalogStatus st = mutate(*next);
+        if (st != CatalogStatus::Ok) return st;
+
+        const Catalog* old = current_.exchange(next.release());
+        synchronize();
+        delete old;
+        return CatalogStatus::Ok;
+    }
+
+    /** Grace period: flip the epoch twice, draining each parity in turn. */
+    void synchronize() const
+    {
+        for (int phase = 0; phase < 2; ++phase) {
+            const unsigned parity = epoch_.fetch_add(1) & 1;
+            for (const auto& stripe : readers_[parity])
+                while (stripe.n.load(std::memory_order_acquire) != 0)
+                    std::this_thread::yield();
+        }
+    }
+
+    struct alignas(64) Stripe { std::atomic<std::uint64_t> n{0}; };
+
+    std::atomic<const Catalog*>     current_{nullptr};   ///< live snapshot
+    mutable std::atomic<unsigned>   epoch_{0};           ///< reader parity
+    mutable Stripe                  readers_[2][telemetry::kStripes];
+    telemetry::Profiled<std::mutex> writeMtx_;           ///< catalog writers
+
+    MovieIndex                      index_;              ///< title / description search
+    mutable std::shared_mutex       indexMtx_;           ///< guards index_
+
+    Theater::Rules                  house_;              ///< seating rules of every hall
+    std::shared_ptr<StringArena>    text_;               ///< movie titles / synopses
+    TheaterSlab                     halls_;              ///< every hall's storage
 };
 
 /* ---------------------------------------------------------------------------*
@@ -149,4 +488,17 @@ std::shared_ptr<IBookingRepository> makeInMemoryRepository()
     return std::make_shared<InMemoryRepository>();
 }
 
+/// Same, every hall enforcing @p house seating rules.
+std::shared_ptr<IBookingRepository> makeInMemoryRepository(const Theater::Rules& house)
+{
+    return std::make_shared<InMemoryRepository>(house);
+}
+
+/// Same, movie text interned in @p text (shared with other repositories).
+std::shared_ptr<IBookingRepository> makeInMemoryRepository(const Theater::Rules&        house,
+                                                           std::shared_ptr<StringArena> text)
+{
+    return std::make_shared<InMemoryRepository>(house, std::move(text));
+}
+
 } // namespace booking::service
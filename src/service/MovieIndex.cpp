@@ -0,0 +1,248 @@
+#include "booking/service/MovieIndex.hpp"
+#include <algorithm>
+#include <cctype>
+
+using namespace booking::service;
+using booking::domain::Movie;
+
+namespace {
+
+constexpr std::uint8_t kTitle = 1;
+constexpr std::uint8_t kDesc  = 2;
+
+constexpr std::size_t kMaxWords      = 8;    ///< query words considered
+constexpr std::size_t kMaxExpansions = 64;   ///< terms per prefix, shortest first
+
+enum Match : std::uint8_t { Exact, Prefix, Typo };
+
+/// Score of one query word hitting one movie: [match][title, description only].
+constexpr std::uint32_t kScore[3][2] = {{8, 2}, {5, 1}, {3, 1}};
+
+/// Allowed edits for a query word of @p len characters.
+constexpr std::size_t maxEdits(std::size_t len) { return len >= 8 ? 2 : len >= 4 ? 1 : 0; }
+
+/// Distinct trigrams of "$$word$" (a word of n characters has up to n + 1);
+/// the double lead keeps "$$w" shared when the first letters are swapped.
+std::vector<std::uint32_t> gramsOf(std::string_view word)
+{
+    const std::string padded = "$$" + std::string{word} + '$';
+    std::vector<std::uint32_t> out;
+    for (std::size_t i = 0; i + 3 <= padded.size(); ++i)
+        out.push_back(std::uint32_t{static_cast<unsigned char>(padded[i])} << 16
+                      | std::uint32_t{static_cast<unsigned char>(padded[i + 1])} << 8
+                      | std::uint32_t{static_cast<unsigned char>(padded[i + 2])});
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return out;
+}
+
+/// Optimal-string-alignment distance of @p a and @p b, or k + 1 as soon as
+/// it is known to exceed @p k.
+std::size_t editDistance(std::string_view a, std::string_view b, std::size_t k)
+{
+    const std::size_t n = a.size(), m = b.size();
+    if (n > m + k || m > n + k) return k + 1;
+
+    thread_local std::vector<std::size_t> prev2, prev, cur;
+    prev2.assign(m + 1, 0);
+    prev.resize(m + 1);
+    cur.resize(m + 1);
+    for (std::size_t j = 0; j <= m; ++j) prev[j] = j;
+    for (std::size_t i = 1; i <= n; ++i) {
+        cur[0] = i;
+        std::size_t rowMin = i;
+        for (std::size_t j = 1; j <= m; ++j) {
+            const std::size_t cost = a[i - 1] == b[j - 1] ? 0 : 1;
+            cur[j] = std::min({prev[j] + 1, cur[j - 1] + 1, prev[j - 1] + cost});
+            if (i > 1 && j > 1 && a[i - 1] == b[j - 2] && a[i - 2] == b[j - 1])
+                cur[j] = std::min(cur[j], prev2[j - 2] + 1);
+            rowMin = std::min(rowMin, cur[j]);
+        }
+        if (rowMin > k) return k + 1;        // a row never gets cheaper than the one above
+        std::swap(prev2, prev);
+        std::swap(prev, cur);
+    }
+    return std::min(prev[m], k + 1);
+}
+
+} // namespace
+
+/* ─── tokenizer ─────────────────────────────────────────────────────────── */
+std::vector<std::string> MovieIndex::tokenize(std::string_view text)
+{
+    std::vector<std::string> out;
+    std::string word;
+    for (const char ch : text) {
+        const auto c = static_cast<unsigned char>(ch);
+        if (c < 0x80 && std::isalnum(c)) {
+            word += static_cast<char>(std::tolower(c));
+        } else if (!word.empty()) {
+            out.push_back(std::move(word));
+            word.clear();
+        }
+    }
+    if (!word.empty()) out.push_back(std::move(word));
+    return out;
+}
+
+/* ─── build ─────────────────────────────────────────────────────────────── */
+std::uint32_t MovieIndex::termOf(const std::string& word)
+{
+    std::uint32_t node = 0;
+    for (const char c : word) {
+        auto& kids = trie_[node].kids;
+        const auto it = std::lower_bound(kids.begin(), kids.end(), c,
+                                         [](const auto& kid, char v) { return kid.first < v; });
+        if (it != kids.end() && it->first == c) {
+            node = it->second;
+            continue;
+        }
+        const auto next = static_cast<std::uint32_t>(trie_.size());
+        kids.insert(it, {c, next});          // before emplace_back invalidates `kids`
+        trie_.emplace_back();
+        node = next;
+    }
+
+    auto& term = trie_[node].term;
+    if (term == kNone) {
+        term = static_cast<std::uint32_t>(terms_.size());
+        terms_.push_back(word);
+        postings_.emplace_back();
+        for (const auto g : gramsOf(word)) grams_[g].push_back(term);
+    }
+    return term;
+}
+
+void MovieIndex::add(const Movie& movie)
+{
+    const auto doc = static_cast<std::uint32_t>(ids_.size());
+    ids_.push_back(movie.id());
+
+    std::vector<std::pair<std::uint32_t, std::uint8_t>> seen;   // term, field
+    for (const auto& w : tokenize(movie.title())) seen.emplace_back(termOf(w), kTitle);
+    for (const auto& w : tokenize(movie.desc()))  seen.emplace_back(termOf(w), kDesc);
+    std::sort(seen.begin(), seen.end());
+
+    for (std::size_t i = 0; i < seen.size();) {                  // one posting per term
+        const auto term = seen[i].first;
+        std::uint8_t fields = 0;
+        for (; i < seen.size() && seen[i].first == term; ++i) fields |= seen[i].second;
+        postings_[term].push_back({doc, fields});
+    }
+}
+
+/* ─── query ─────────────────────────────────────────────────────────────── */
+std::uint32_t MovieIndex::find(std::string_view prefix) const
+{
+    std::uint32_t node = 0;
+    for (const char c : prefix) {
+        const auto& kids = trie_[node].kids;
+        const auto it = std::lower_bound(kids.begin(), kids.end(), c,
+                                         [](const auto& kid, char v) { return kid.first < v; });
+        if (it == kids.end() || it->first != c) return kNone;
+        node = it->second;
+    }
+    return node;
+}
+
+std::vector<MovieIndex::Hit> MovieIndex::search(std::string_view query, std::size_t limit) const
+{
+    auto words = tokenize(query);
+    if (words.size() > kMaxWords) words.resize(kMaxWords);
+    if (words.empty() || limit == 0) return {};
+
+    // Dense per-thread scratch, indexed by term / document ordinal and left
+    // all-zero between calls, so a query allocates next to nothing.
+    struct Scratch
+    {
+        std::vector<std::uint16_t> shared;     ///< per term: trigrams in common
+        std::vector<std::uint32_t> grammed;    ///< terms with shared != 0
+        std::vector<std::uint32_t> score;      ///< per doc: sum over matched words
+        std::vector<std::uint8_t>  wordBest;   ///< per doc: best score of this word
+        std::vector<std::uint32_t> alive;      ///< docs matching every word so far
+        std::vector<std::uint32_t> frontier;
+        std::vector<std::pair<std::uint32_t, Match>> matches;
+    };
+    thread_local Scratch s;
+    s.shared.resize(std::max(s.shared.size(), terms_.size()));
+    s.score.resize(std::max(s.score.size(), ids_.size()));
+    s.wordBest.resize(std::max(s.wordBest.size(), ids_.size()));
+    s.alive.clear();
+
+    for (std::size_t w = 0; w < words.size(); ++w) {
+        const std::string& word = words[w];
+        s.matches.clear();
+
+        // a) prefix: breadth-first below the word's trie node, shortest terms first
+        if (const auto root = find(word); root != kNone) {
+            s.frontier.assign(1, root);
+            for (std::size_t i = 0; i < s.frontier.size() && s.matches.size() < kMaxExpansions; ++i) {
+                const Node& n = trie_[s.frontier[i]];
+                if (n.term != kNone) s.matches.emplace_back(n.term, i == 0 ? Exact : Prefix);
+                for (const auto& kid : n.kids) s.frontier.push_back(kid.second);
+            }
+        }
+
+        // b) typos: terms sharing enough trigrams, verified by edit distance;
+        //    skipped when the word is itself a term
+        const bool exact = !s.matches.empty() && s.matches.front().second == Exact;
+        if (const std::size_t k = maxEdits(word.size()); k > 0 && !exact) {
+            const auto grams = gramsOf(word);
+            const std::size_t need = grams.size() > 4 * k ? grams.size() - 4 * k : 1;
+            for (const auto g : grams)
+                if (const auto it = grams_.find(g); it != grams_.end())
+                    for (const auto t : it->second)
+                        if (s.shared[t]++ == 0) s.grammed.push_back(t);
+
+            for (const auto& t : s.matches) s.shared[t.first] = 0;   // already a prefix hit
+            for (const auto t : s.grammed) {
+                if (s.shared[t] >= need && editDistance(word, terms_[t], k) <= k)
+                    s.matches.emplace_back(t, Typo);
+                s.shared[t] = 0;
+            }
+            s.grammed.clear();
+        }
+
+        // c) best score per document for this word; after the first word only
+        //    documents that matched every earlier word are kept
+        for (const auto& [t, kind] : s.matches)
+            for (const Posting& p : postings_[t]) {
+                const auto sc = static_cast<std::uint8_t>(kScore[kind][(p.fields & kTitle) ? 0 : 1]);
+                if (w > 0 && s.score[p.doc] == 0) continue;
+                if (w == 0 && s.wordBest[p.doc] == 0) s.alive.push_back(p.doc);
+                s.wordBest[p.doc] = std::max(s.wordBest[p.doc], sc);
+            }
+
+        std::size_t kept = 0;
+        for (const auto d : s.alive) {
+            if (s.wordBest[d] != 0) {
+                s.score[d] += s.wordBest[d];
+                s.wordBest[d] = 0;
+                s.alive[kept++] = d;
+            } else {
+                s.score[d] = 0;
+            }
+        }
+        s.alive.resize(kept);
+        if (s.alive.empty()) return {};                       // every word must match
+    }
+
+    std::vector<Hit> hits;
+    hits.reserve(s.alive.size());
+    for (const auto d : s.alive) {
+        hits.push_back({ids_[d], s.score[d]});
+        s.score[d] = 0;
+    }
+
+    const auto better = [](const Hit& a, const Hit& b) {
+        return a.score != b.score ? a.score > b.score : a.id < b.id;
+    };
+    if (hits.size() > limit) {
+        std::partial_sort(hits.begin(), hits.begin() + static_cast<std::ptrdiff_t>(limit),
+                          hits.end(), better);
+        hits.resize(limit);
+    } else {
+        std::sort(hits.begin(), hits.end(), better);
+    }
+    return hits;
+}
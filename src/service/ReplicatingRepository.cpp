@@ -0,0 +1,192 @@
+#include "booking/service/ReplicatingRepository.hpp"
+#include <mutex>
+
+using namespace booking::service;
+using booking::domain::BookStatus;
+using booking::domain::Movie;
+using booking::domain::Seat;
+using booking::domain::Theater;
+
+ReplicatingRepository::ReplicatingRepository(std::shared_ptr<IBookingRepository> inner,
+                                             std::shared_ptr<ReplicationLog>     log)
+    : inner_(std::move(inner)), log_(std::move(log)) {}
+
+/* ─── snapshot ──────────────────────────────────────────────────────────── */
+std::uint64_t ReplicatingRepository::snapshot(std::vector<LogRecord>& out) const
+{
+    const std::unique_lock gate{gate_};                  // no write half-logged
+    const std::uint64_t seq = log_->last();
+
+    for (const auto& m : inner_->movies()) {
+        LogRecord mv;
+        mv.seq   = seq;
+        mv.kind  = LogRecord::Kind::AddMovie;
+        mv.movie = m.id();
+        mv.title = m.title();
+        mv.desc  = m.desc();
+        out.push_back(std::move(mv));
+
+        for (const auto& hall : inner_->theaters(m.id())) {
+            LogRecord sc;
+            sc.seq     = seq;
+            sc.kind    = LogRecord::Kind::AddScreening;
+            sc.movie   = m.id();
+            sc.theater = hall->id();
+            sc.name    = hall->name();
+            out.push_back(std::move(sc));
+
+            const auto free = Theater::maskOf(hall->freeSeats()).value_or(0);
+            if (const auto sold = Theater::kAllSeats & ~free) {
+                LogRecord bk;
+                bk.seq     = seq;
+                bk.kind    = LogRecord::Kind::Book;
+                bk.movie   = m.id();
+                bk.theater = hall->id();
+                bk.seats   = sold;
+                out.push_back(std::move(bk));
+            }
+        }
+    }
+    return seq;
+}
+
+/* ─── reads ─────────────────────────────────────────────────────────────── */
+std::vector<Movie> ReplicatingRepository::movies() const { return inner_->movies(); }
+
+Page<Movie> ReplicatingRepository::moviesPage(Movie::Id after, std::size_t limit) const
+{
+    return inner_->moviesPage(after, limit);
+}
+
+std::vector<Movie> ReplicatingRepository::searchMovies(std::string_view query, std::size_t limit) const
+{
+    return inner_->searchMovies(query, limit);
+}
+
+std::vector<std::shared_ptr<const Theater>> ReplicatingRepository::theaters(Movie::Id id) const
+{
+    return inner_->theaters(id);
+}
+
+std::optional<Page<std::shared_ptr<const Theater>>>
+ReplicatingRepository::theatersPage(Movie::Id m, Theater::Id after, std::size_t limit) const
+{
+    return inner_->theatersPage(m, after, limit);
+}
+
+std::vector<Seat> ReplicatingRepository::freeSeats(Movie::Id m, Theater::Id t) const
+{
+    return inner_->freeSeats(m, t);
+}
+
+std::vector<Seat> ReplicatingRepository::freeSeatsOwned(Movie::Id m, Theater::Id t) const
+{
+    return inner_->freeSeatsOwned(m, t);
+}
+
+std::optional<std::uint64_t> ReplicatingRepository::quote(Movie::Id m, Theater::Id t,
+                                                          const std::vector<Seat>& s) const
+{
+    return inner_->quote(m, t, s);
+}
+
+std::vector<MovieSales> ReplicatingRepository::sales(Movie::Id m) const { return inner_->sales(m); }
+
+/* ─── bookings ──────────────────────────────────────────────────────────── */
+template <class Apply>
+Reservation ReplicatingRepository::booked(Movie::Id m, Theater::Id t,
+                                          const std::vector<Seat>& s, Apply apply)
+{
+    if (!log_->ready()) return {BookStatus::Unreplicated};   // nothing applied
+    std::uint64_t seq = 0;
+    Reservation   r;
+    {
+        const std::shared_lock gate{gate_};
+        r = apply();
+        if (r.status == BookStatus::Booked) {
+            LogRecord rec;
+            rec.kind    = LogRecord::Kind::Book;
+            rec.movie   = m;
+            rec.theater = t;
+            rec.seats   = Theater::maskOf(s).value_or(0);
+            seq = log_->append(std::move(rec));
+        }
+    }
+    if (seq && !log_->waitAcked(seq)) {                  // booked, not confirmed
+        r.status  = BookStatus::Unreplicated;
+        r.applied = true;
+    }
+    return r;
+}
+
+bool ReplicatingRepository::book(Movie::Id m, Theater::Id t, const std::vector<Seat>& s)
+{
+    return reserve(m, t, s, false).status == BookStatus::Booked;
+}
+
+Reservation ReplicatingRepository::reserve(Movie::Id m, Theater::Id t,
+                                           const std::vector<Seat>& s, bool accessible)
+{
+    return booked(m, t, s, [&] { return inner_->reserve(m, t, s, accessible); });
+}
+
+Reservation ReplicatingRepository::reserveOwned(Movie::Id m, Theater::Id t,
+                                                const std::vector<Seat>& s, bool accessible)
+{
+    return booked(m, t, s, [&] { return inner_->reserveOwned(m, t, s, accessible); });
+}
+
+/* ─── catalog ───────────────────────────────────────────────────────────── */
+template <class Apply>
+CatalogStatus ReplicatingRepository::changed(LogRecord r, Apply apply)
+{
+    if (!log_->ready()) return CatalogStatus::Unreplicated;
+    std::uint64_t seq = 0;
+    CatalogStatus st;
+    {
+        const std::unique_lock gate{gate_};
+        st = apply();
+        if (st == CatalogStatus::Ok) seq = log_->append(std::move(r));
+    }
+    if (seq && !log_->waitAcked(seq)) return CatalogStatus::Unreplicated;
+    return st;
+}
+
+CatalogStatus ReplicatingRepository::occupy(Movie::Id m, Theater::Id t, Theater::SeatMask seats)
+{
+    LogRecord r;
+    r.kind    = LogRecord::Kind::Book;
+    r.movie   = m;
+    r.theater = t;
+    r.seats   = seats;
+    return changed(std::move(r), [&] { return inner_->occupy(m, t, seats); });
+}
+
+CatalogStatus ReplicatingRepository::addMovie(Movie movie)
+{
+    LogRecord r;
+    r.kind  = LogRecord::Kind::AddMovie;
+    r.movie = movie.id();
+    r.title = movie.title();
+    r.desc  = movie.desc();
+    return changed(std::move(r), [&] { return inner_->addMovie(std::move(movie)); });
+}
+
+CatalogStatus ReplicatingRepository::addScreening(Movie::Id m, Theater::Id t, std::string name)
+{
+    LogRecord r;
+    r.kind    = LogRecord::Kind::AddScreening;
+    r.movie   = m;
+    r.theater = t;
+    r.name    = name;
+    return changed(std::move(r), [&] { return inner_->addScreening(m, t, std::move(name)); });
+}
+
+CatalogStatus ReplicatingRepository::retireScreening(Movie::Id m, Theater::Id t)
+{
+    LogRecord r;
+    r.kind    = LogRecord::Kind::RetireScreening;
+    r.movie   = m;
+    r.theater = t;
+    return changed(std::move(r), [&] { return inner_->retireScreening(m, t); });
+}
@@ -0,0 +1,123 @@
+#include "booking/service/ReplicationLog.hpp"
+#include <algorithm>
+#include <random>
+
+using namespace booking::service;
+
+/* ─── ctor ──────────────────────────────────────────────────────────────── */
+ReplicationLog::ReplicationLog() : ReplicationLog{Config{}} {}
+
+ReplicationLog::ReplicationLog(Config cfg)
+    : cfg_{cfg}, epoch_{std::random_device{}() | std::uint64_t{std::random_device{}()} << 32 | 1}
+{
+    cfg_.capacity = std::max<std::size_t>(1, cfg_.capacity);
+}
+
+/* ─── writer ────────────────────────────────────────────────────────────── */
+std::uint64_t ReplicationLog::append(LogRecord r)
+{
+    std::uint64_t seq = 0;
+    {
+        const std::lock_guard lock{mtx_};
+        seq = r.seq = ++last_;
+        if (records_.size() == cfg_.capacity) records_.pop_front();
+        records_.push_back(std::move(r));
+    }
+    appended_.notify_all();
+    return seq;
+}
+
+std::uint64_t ReplicationLog::last() const
+{
+    const std::lock_guard lock{mtx_};
+    return last_;
+}
+
+bool ReplicationLog::ready() const
+{
+    const std::lock_guard lock{mtx_};
+    return !cfg_.synchronous || (followers_ > 0 && !closed_);
+}
+
+bool ReplicationLog::waitAcked(std::uint64_t seq)
+{
+    std::unique_lock lock{mtx_};
+    if (!cfg_.synchronous) return true;
+    if (!acknowledged_.wait_for(lock, cfg_.ackTimeout,
+                                [&] { return acked_ >= seq || followers_ == 0 || closed_; }))
+        ++ackTimeouts_;
+    return acked_ >= seq;
+}
+
+/* ─── followers ─────────────────────────────────────────────────────────── */
+bool ReplicationLog::read(std::uint64_t after, std::vector<LogRecord>& out, std::size_t max,
+                          std::chrono::milliseconds wait)
+{
+    std::unique_lock lock{mtx_};
+    appended_.wait_for(lock, wait, [&] { return last_ > after || closed_; });
+
+    const std::uint64_t first = records_.empty() ? last_ + 1 : records_.front().seq;
+    if (after + 1 < first) return false;                 // trimmed away
+    for (std::size_t i = after + 1 - first;
+         i < records_.size() && max > 0; ++i, --max)
+        out.push_back(records_[i]);
+    return true;
+}
+
+void ReplicationLog::ack(std::uint64_t seq)
+{
+    {
+        const std::lock_guard lock{mtx_};
+        acked_ = std::max(acked_, std::min(seq, last_));
+    }
+    acknowledged_.notify_all();
+}
+
+std::uint64_t ReplicationLog::acked() const
+{
+    const std::lock_guard lock{mtx_};
+    return acked_;
+}
+
+void ReplicationLog::attach()
+{
+    const std::lock_guard lock{mtx_};
+    ++followers_;
+}
+
+void ReplicationLog::detach()
+{
+    {
+        const std::lock_guard lock{mtx_};
+        --followers_;
+    }
+    acknowledged_.notify_all();                          // nobody left to wait for
+}
+
+std::size_t ReplicationLog::followers() const
+{
+    const std::lock_guard lock{mtx_};
+    return followers_;
+}
+
+std::uint64_t ReplicationLog::ackTimeouts() const
+{
+    const std::lock_guard lock{mtx_};
+    return ackTimeouts_;
+}
+
+void ReplicationLog::close()
+{
+    {
+        const std::lock_guard lock{mtx_};
+        closed_ = true;
+    }
+    appended_.notify_all();
+    acknowledged_.notify_all();
+}
+
+bool ReplicationLog::closed() const
+{
+    const std::lock_guard lock{mtx_};
+    return closed_;
+}
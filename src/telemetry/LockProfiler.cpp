@@ -0,0 +1,153 @@
+#include "booking/telemetry/LockProfiler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <map>
+
+using namespace booking::telemetry;
+
+void LockStats::recordWait(std::uint64_t ns) noexcept
+{
+    waitNs.fetch_add(ns, std::memory_order_relaxed);
+    std::uint64_t cur = maxWaitNs.load(std::memory_order_relaxed);
+    while (ns > cur &&
+           !maxWaitNs.compare_exchange_weak(cur, ns, std::memory_order_relaxed)) {}
+}
+
+LockProfiler& LockProfiler::instance()
+{
+    static LockProfiler p;
+    return p;
+}
+
+LockStats& LockProfiler::site(const char* kind, std::uint64_t id)
+{
+    std::scoped_lock lk{mtx_};
+    for (auto& s : sites_)
+        if (s.id == id && std::strcmp(s.kind, kind) == 0)
+            return s;
+
+    auto& s = sites_.emplace_back();
+    s.kind = kind;
+    s.id   = id;
+    return s;
+}
+
+std::vector<LockProfiler::Row> LockProfiler::rows() const
+{
+    std::vector<Row> out;
+    {
+        std::scoped_lock lk{mtx_};
+        out.reserve(sites_.size());
+        for (const auto& s : sites_)
+            out.push_back({s.kind, s.id,
+                           s.acquisitions.load(std::memory_order_relaxed),
+                           s.contended.load(std::memory_order_relaxed),
+                           s.waitNs.load(std::memory_order_relaxed),
+                           s.maxWaitNs.load(std::memory_order_relaxed),
+                           s.holdNs.load(std::memory_order_relaxed)});
+    }
+    std::stable_sort(out.begin(), out.end(),
+                     [](const Row& a, const Row& b) {
+                         if (a.waitNs != b.waitNs)       return a.waitNs > b.waitNs;
+                         if (a.contended != b.contended) return a.contended > b.contended;
+                         return a.acquisitions > b.acquisitions;
+                     });
+    return out;
+}
+
+void LockProfiler::report(std::ostream& os, std::size_t top) const
+{
+    const auto all = rows();
+
+    if (!kLockProfiling)
+        os << "note: built without BOOKING_LOCK_PROFILING - no lock is instrumented\n";
+
+    // a) totals per family
+    std::map<std::string, Row> totals;
+    for (const auto& r : all) {
+        auto& t = totals[r.kind];
+        t.kind = r.kind;
+        ++t.id;                                    // re-used as site count
+        t.acquisitions += r.acquisitions;
+        t.contended    += r.contended;
+        t.waitNs       += r.waitNs;
+        t.maxWaitNs     = std::max(t.maxWaitNs, r.maxWaitNs);
+        t.holdNs       += r.holdNs;
+    }
+
+    const auto line = [&](const std::string& site, const std::string& id, const Row& r) {
+        const double pct = r.acquisitions
+            ? 100.0 * static_cast<double>(r.contended) / static_cast<double>(r.acquisitions) : 0.0;
+        os << std::left  << std::setw(12) << site << std::setw(8) << id << std::right
+           << std::setw(14) << r.acquisitions
+           << std::setw(12) << r.contended
+           << std::setw(9)  << std::fixed << std::setprecision(1) << pct << '%'
+           << std::setw(12) << std::setprecision(3) << static_cast<double>(r.waitNs) / 1e6
+           << std::setw(13) << std::setprecision(1) << static_cast<double>(r.maxWaitNs) / 1e3
+           << std::setw(12) << std::setprecision(3) << static_cast<double>(r.holdNs) / 1e6
+           << '\n';
+    };
+    const auto header = [&](const char* title) {
+        os << title << '\n'
+           << std::left  << std::setw(12) << "site" << std::setw(8) << "id" << std::right
+           << std::setw(14) << "acquisitions" << std::setw(12) << "contended"
+           << std::setw(10) << "ratio" << std::setw(12) << "wait_ms"
+           << std::setw(13) << "max_wait_us" << std::setw(12) << "hold_ms" << '\n';
+    };
+
+    header("== lock totals per site family (id column = number of sites)");
+    for (const auto& [kind, t] : totals)
+        line(kind, std::to_string(t.id), t);
+
+    // b) top-N per family - `all` is already sorted by wait time
+    for (const auto& [kind, t] : totals) {
+        os << '\n';
+        header(("== top contended: " + kind).c_str());
+        std::size_t n = 0;
+        for (const auto& r : all)
+            if (r.kind == kind && n++ < top)
+                line(r.kind, std::to_string(r.id), r);
+    }
+}
+
+void LockProfiler::exposition(std::ostream& os, std::size_t top) const
+{
+    const auto all = rows();
+    std::map<std::string, std::size_t> perKind;
+
+    os << "# HELP booking_lock_wait_seconds_total Time spent blocked on a lock site\n"
+          "# TYPE booking_lock_wait_seconds_total counter\n";
+    std::vector<const Row*> shown;
+    for (const auto& r : all)
+        if (perKind[r.kind]++ < top) shown.push_back(&r);
+
+    for (const Row* r : shown)
+        os << "booking_lock_wait_seconds_total{site=\"" << r->kind << "\",id=\"" << r->id
+           << "\"} " << static_cast<double>(r->waitNs) / 1e9 << '\n';
+
+    os << "# HELP booking_lock_contended_total Acquisitions that had to block\n"
+          "# TYPE booking_lock_contended_total counter\n";
+    for (const Row* r : shown)
+        os << "booking_lock_contended_total{site=\"" << r->kind << "\",id=\"" << r->id
+           << "\"} " << r->contended << '\n';
+
+    os << "# HELP booking_lock_acquisitions_total Successful acquisitions\n"
+          "# TYPE booking_lock_acquisitions_total counter\n";
+    for (const Row* r : shown)
+        os << "booking_lock_acquisitions_total{site=\"" << r->kind << "\",id=\"" << r->id
+           << "\"} " << r->acquisitions << '\n';
+}
+
+void LockProfiler::reset()
+{
+    std::scoped_lock lk{mtx_};
+    for (auto& s : sites_) {
+        s.acquisitions.store(0, std::memory_order_relaxed);
+        s.contended.store(0, std::memory_order_relaxed);
+        s.waitNs.store(0, std::memory_order_relaxed);
+        s.maxWaitNs.store(0, std::memory_order_relaxed);
+        s.holdNs.store(0, std::memory_order_relaxed);
+    }
+}
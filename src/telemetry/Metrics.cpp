@@ -0,0 +1,186 @@
+#include "booking/telemetry/Metrics.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+
+using namespace booking::telemetry;
+
+namespace {
+
+/// Prometheus `le` edges (seconds) exported for every histogram: 1 µs … 10 s.
+constexpr double kLe[] = {
+    1e-6, 2.5e-6, 5e-6, 1e-5, 2.5e-5, 5e-5, 1e-4, 2.5e-4, 5e-4,
+    1e-3, 2.5e-3, 5e-3, 1e-2, 2.5e-2, 5e-2, 0.1,  0.25,   0.5,
+    1.0,  2.5,    5.0,  10.0};
+
+std::string escape(const std::string& v)
+{
+    std::string out;
+    out.reserve(v.size());
+    for (char c : v) {
+        if      (c == '\\') out += "\\\\";
+        else if (c == '"')  out += "\\\"";
+        else if (c == '\n') out += "\\n";
+        else                out += c;
+    }
+    return out;
+}
+
+/// Append one extra label to an existing label string.
+std::string withLabel(const Labels& base, const char* k, const std::string& v)
+{
+    Labels l = base;
+    l.emplace_back(k, v);
+    return formatLabels(l);
+}
+
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// Counter / Histogram
+// ────────────────────────────────────────────────────────────────────────────
+std::uint64_t Counter::value() const noexcept
+{
+    std::uint64_t sum = 0;
+    for (const auto& s : stripes_) sum += s.v.load(std::memory_order_relaxed);
+    return sum;
+}
+
+std::uint64_t Histogram::lowerBound(std::size_t b) noexcept
+{
+    if (b < kSub) return b;
+    const std::size_t oct = (b - kSub) / kSub;
+    const std::size_t sub = (b - kSub) % kSub;
+    return (std::uint64_t{kSub} + sub) << oct;
+}
+
+std::uint64_t Histogram::upperBound(std::size_t b) noexcept
+{
+    if (b < kSub) return b + 1;
+    const std::size_t oct = (b - kSub) / kSub;
+    return lowerBound(b) + (std::uint64_t{1} << oct);
+}
+
+Histogram::Snapshot Histogram::snapshot() const noexcept
+{
+    Snapshot out;
+    for (std::size_t s = 0; s < kStripes; ++s) {
+        const Stripe& st = stripes_[s];
+        for (std::size_t b = 0; b < kBuckets; ++b)
+            out.buckets[b] += st.buckets[b].load(std::memory_order_relaxed);
+        out.sum += st.sum.load(std::memory_order_relaxed);
+    }
+    for (auto c : out.buckets) out.count += c;
+    return out;
+}
+
+std::uint64_t Histogram::Snapshot::quantile(double q) const noexcept
+{
+    if (count == 0) return 0;
+    const auto rank = static_cast<std::uint64_t>(
+        std::ceil(std::clamp(q, 0.0, 1.0) * static_cast<double>(count)));
+    std::uint64_t seen = 0;
+    for (std::size_t b = 0; b < kBuckets; ++b) {
+        seen += buckets[b];
+        if (seen >= std::max<std::uint64_t>(rank, 1))
+            return upperBound(b);
+    }
+    return upperBound(kBuckets - 1);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Registry
+// ────────────────────────────────────────────────────────────────────────────
+std::string booking::telemetry::formatLabels(const Labels& labels)
+{
+    if (labels.empty()) return {};
+    std::string out = "{";
+    for (std::size_t i = 0; i < labels.size(); ++i) {
+        if (i) out += ',';
+        out += labels[i].first + "=\"" + escape(labels[i].second) + '"';
+    }
+    return out + '}';
+}
+
+template <class T>
+T& Registry::getOrCreate(std::deque<std::pair<std::string, Family<T>>>& fams,
+                         const std::string& name, const std::string& help, Labels labels)
+{
+    auto fam = std::find_if(fams.begin(), fams.end(),
+                            [&](const auto& f) { return f.first == name; });
+    if (fam == fams.end()) {
+        fams.emplace_back(name, Family<T>{help, {}});
+        fam = std::prev(fams.end());
+    }
+
+    auto& series = fam->second.series;
+    const auto it = std::find_if(series.begin(), series.end(),
+                                 [&](const auto& s) { return s.first == labels; });
+    if (it != series.end()) return *it->second;
+
+    series.emplace_back(std::move(labels), std::make_unique<T>());
+    return *series.back().second;
+}
+
+Counter& Registry::counter(const std::string& name, const std::string& help, Labels labels)
+{
+    std::scoped_lock lk{mtx_};
+    return getOrCreate(counters_, name, help, std::move(labels));
+}
+
+Histogram& Registry::histogram(const std::string& name, const std::string& help, Labels labels)
+{
+    std::scoped_lock lk{mtx_};
+    return getOrCreate(histograms_, name, help, std::move(labels));
+}
+
+void Registry::addCollector(Collector c)
+{
+    std::scoped_lock lk{mtx_};
+    collectors_.push_back(std::move(c));
+}
+
+std::string Registry::exposition() const
+{
+    std::scoped_lock lk{mtx_};
+    std::ostringstream os;
+    os << std::setprecision(9);
+
+    for (const auto& [name, fam] : counters_) {
+        os << "# HELP " << name << ' ' << fam.help << '\n'
+           << "# TYPE " << name << " counter\n";
+        for (const auto& [labels, c] : fam.series)
+            os << name << formatLabels(labels) << ' ' << c->value() << '\n';
+    }
+
+    for (const auto& [name, fam] : histograms_) {
+        os << "# HELP " << name << ' ' << fam.help << '\n'
+           << "# TYPE " << name << " histogram\n";
+        for (const auto& [labels, h] : fam.series) {
+            const auto snap = h->snapshot();
+
+            // fold the fine HDR buckets into the coarse `le` edges
+            std::size_t   b   = 0;
+            std::uint64_t cum = 0;
+            for (double le : kLe) {
+                const auto edgeNs = static_cast<std::uint64_t>(le * 1e9);
+                while (b < Histogram::kBuckets && Histogram::upperBound(b) <= edgeNs)
+                    cum += snap.buckets[b++];
+                std::ostringstream leStr;
+                leStr << le;
+                os << name << "_bucket" << withLabel(labels, "le", leStr.str())
+                   << ' ' << cum << '\n';
+            }
+            os << name << "_bucket" << withLabel(labels, "le", "+Inf")
+               << ' ' << snap.count << '\n'
+               << name << "_sum"   << formatLabels(labels) << ' '
+               << static_cast<double>(snap.sum) / 1e9 << '\n'
+               << name << "_count" << formatLabels(labels) << ' ' << snap.count << '\n';
+        }
+    }
+
+    for (const auto& c : collectors_) c(os);
+    return os.str();
+}
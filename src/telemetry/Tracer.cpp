@@ -0,0 +1,220 @@
+#include "booking/telemetry/Tracer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+
+using namespace booking::telemetry;
+
+namespace {
+
+/// One ring slot - relaxed atomics so a concurrent snapshot is race-free.
+struct Slot
+{
+    std::atomic<const char*>   name{nullptr};
+    std::atomic<const char*>   argName{nullptr};
+    std::atomic<std::uint64_t> arg{0};
+    std::atomic<std::uint64_t> startNs{0};
+    std::atomic<std::uint64_t> durNs{0};
+    std::atomic<std::uint64_t> reqId{0};
+};
+
+/// Single-producer ring owned by one thread at a time.
+struct Ring
+{
+    explicit Ring(std::uint32_t id) : tid{id} {}
+
+    const std::uint32_t        tid;
+    std::unique_ptr<Slot[]>    slots{new Slot[Tracer::kRingSize]};
+    std::atomic<std::uint64_t> head{0};          ///< next write position
+};
+
+/// Every ring ever created; rings of exited threads are recycled.
+struct RingRegistry
+{
+    std::mutex                         mtx;
+    std::vector<std::unique_ptr<Ring>> all;
+    std::vector<Ring*>                 idle;
+
+    Ring* acquire()
+    {
+        std::scoped_lock lk{mtx};
+        if (!idle.empty()) {
+            Ring* r = idle.back();
+            idle.pop_back();
+            return r;
+        }
+        all.push_back(std::make_unique<Ring>(static_cast<std::uint32_t>(all.size() + 1)));
+        return all.back().get();
+    }
+
+    void release(Ring* r)
+    {
+        std::scoped_lock lk{mtx};
+        idle.push_back(r);
+    }
+};
+
+RingRegistry& registry()
+{
+    static RingRegistry* r = new RingRegistry;   // leaked: outlives thread_locals
+    return *r;
+}
+
+/// Thread-local handle; hands the ring back when the thread exits.
+struct RingLease
+{
+    Ring* ring = nullptr;
+    ~RingLease() { if (ring) registry().release(ring); }
+
+    Ring& get()
+    {
+        if (!ring) ring = registry().acquire();
+        return *ring;
+    }
+};
+
+thread_local RingLease tlRing;
+std::atomic<std::uint64_t> nextReq{1};
+
+void jsonEvent(std::ostream& os, const TraceEvent& e, std::uint64_t base)
+{
+    os << "{\"name\":\"" << e.name << "\",\"cat\":\"booking\",\"ph\":\"X\",\"pid\":1"
+       << ",\"tid\":"  << e.tid
+       << ",\"ts\":"   << static_cast<double>(e.startNs - base) / 1e3
+       << ",\"dur\":"  << static_cast<double>(e.durNs) / 1e3
+       << ",\"args\":{\"req\":" << e.reqId;
+    if (e.argName) os << ",\"" << e.argName << "\":" << e.arg;
+    os << "}}";
+}
+
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// Recording (called by TraceRequest / TraceSpan on sampled requests only)
+// ────────────────────────────────────────────────────────────────────────────
+std::uint64_t booking::telemetry::detail::traceNow() noexcept
+{
+    return static_cast<std::uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count());
+}
+
+std::uint64_t booking::telemetry::detail::traceBegin() noexcept
+{
+    return nextReq.fetch_add(1, std::memory_order_relaxed);
+}
+
+void booking::telemetry::detail::traceEmit(const char* name,
+                                           std::uint64_t startNs, std::uint64_t endNs,
+                                           const char* argName, std::uint64_t arg) noexcept
+{
+    Ring& r = tlRing.get();
+    const std::uint64_t h = r.head.load(std::memory_order_relaxed);
+    Slot& s = r.slots[h & (Tracer::kRingSize - 1)];
+
+    s.name.store(name, std::memory_order_relaxed);
+    s.argName.store(argName, std::memory_order_relaxed);
+    s.arg.store(arg, std::memory_order_relaxed);
+    s.startNs.store(startNs, std::memory_order_relaxed);
+    s.durNs.store(endNs - startNs, std::memory_order_relaxed);
+    s.reqId.store(traceReq, std::memory_order_relaxed);
+    r.head.store(h + 1, std::memory_order_release);
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// Tracer
+// ────────────────────────────────────────────────────────────────────────────
+Tracer& Tracer::instance()
+{
+    static Tracer t;
+    return t;
+}
+
+void Tracer::setSampling(std::uint32_t every) noexcept
+{
+    detail::traceEvery.store(every, std::memory_order_relaxed);
+}
+
+std::uint32_t Tracer::sampling() const noexcept
+{
+    return detail::traceEvery.load(std::memory_order_relaxed);
+}
+
+void Tracer::clear() noexcept
+{
+    clearedAt_.store(detail::traceNow(), std::memory_order_relaxed);
+}
+
+std::vector<TraceEvent> Tracer::collect() const
+{
+    const std::uint64_t since = clearedAt_.load(std::memory_order_relaxed);
+    std::vector<TraceEvent> out;
+
+    auto& reg = registry();
+    std::scoped_lock lk{reg.mtx};
+    for (const auto& r : reg.all) {
+        const std::uint64_t h1    = r->head.load(std::memory_order_acquire);
+        const std::uint64_t first = h1 > kRingSize ? h1 - kRingSize : 0;
+        const std::size_t   mark  = out.size();
+
+        for (std::uint64_t i = first; i < h1; ++i) {
+            const Slot& s = r->slots[i & (kRingSize - 1)];
+            TraceEvent e;
+            e.name    = s.name.load(std::memory_order_relaxed);
+            e.argName = s.argName.load(std::memory_order_relaxed);
+            e.arg     = s.arg.load(std::memory_order_relaxed);
+            e.startNs = s.startNs.load(std::memory_order_relaxed);
+            e.durNs   = s.durNs.load(std::memory_order_relaxed);
+            e.reqId   = s.reqId.load(std::memory_order_relaxed);
+            e.tid     = r->tid;
+            out.push_back(e);
+        }
+
+        // drop slots the producer may have overwritten while we copied
+        std::atomic_thread_fence(std::memory_order_acquire);
+        const std::uint64_t h2   = r->head.load(std::memory_order_relaxed);
+        const std::uint64_t safe = h2 + 1 > kRingSize ? h2 + 1 - kRingSize : 0;
+        if (safe > first) {
+            const auto torn = std::min<std::uint64_t>(safe - first, h1 - first);
+            out.erase(out.begin() + static_cast<std::ptrdiff_t>(mark),
+                      out.begin() + static_cast<std::ptrdiff_t>(mark + torn));
+        }
+    }
+
+    out.erase(std::remove_if(out.begin(), out.end(),
+                             [&](const TraceEvent& e) { return e.startNs < since; }),
+              out.end());
+    std::sort(out.begin(), out.end(),
+              [](const TraceEvent& a, const TraceEvent& b) { return a.startNs < b.startNs; });
+    return out;
+}
+
+std::size_t Tracer::writeChromeJson(std::ostream& os) const
+{
+    const auto events = collect();
+    const std::uint64_t base = events.empty() ? 0 : events.front().startNs;
+
+    os << std::fixed << std::setprecision(3)
+       << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+
+    std::vector<std::uint32_t> tids;
+    bool first = true;
+    for (const auto& e : events) {
+        if (!first) os << ',';
+        first = false;
+        os << '\n';
+        jsonEvent(os, e, base);
+        if (std::find(tids.begin(), tids.end(), e.tid) == tids.end()) tids.push_back(e.tid);
+    }
+    for (auto tid : tids) {
+        os << (first ? "\n" : ",\n")
+           << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid
+           << ",\"args\":{\"name\":\"worker-" << tid << "\"}}";
+        first = false;
+    }
+    os << "\n]}\n";
+    return events.size();
+}
@@ -92,7 +92,7 @@ bool exerciseChannel(const std::string& lbl,
     // 1) ListMovies ----------------------------------------------------------
     grpc::ClientContext ctx1;
     booking::MovieList  movieList;
-    if (!stub->ListMovies(&ctx1, booking::Empty{}, &movieList).ok()) {
+    if (!stub->ListMovies(&ctx1, booking::ListMoviesReq{}, &movieList).ok()) {
         std::cerr << "[ " << lbl << " ] ListMovies RPC failed\n";
         return false;
     }
@@ -104,7 +104,7 @@ bool exerciseChannel(const std::string& lbl,
 
     // 2) ListTheaters --------------------------------------------------------
     grpc::ClientContext ctx2;
-    booking::MovieId mid;  mid.set_id(movieId);
+    booking::ListTheatersReq mid;  mid.set_movie_id(movieId);
     booking::TheaterList theaterList;
     if (!stub->ListTheaters(&ctx2, mid, &theaterList).ok()) {
         std::cerr << "  ListTheaters RPC failed\n";
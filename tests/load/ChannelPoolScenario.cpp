@@ -0,0 +1,246 @@
+// tests/load/ChannelPoolScenario.cpp
+// ─────────────────────────────────────────────────────────────────────────────
+// Tail latency of ListFreeSeats with a single channel, a round-robin
+// transport::ChannelPool and a pool with hedged reads.
+//
+// Starts an in-process booking server on an ephemeral TCP port whose
+// repository stalls one in <stall-every> freeSeats() calls for <stall-ms>
+// (a GC pause / noisy neighbour stand-in).  <clients> threads then issue
+// ListFreeSeats on zipf-picked halls, paced to <rate> requests/s in
+// total as booking_loadgen does in closed mode with --rate, and latency is
+// measured from the intended send time:
+//
+//   run 1  "1 channel"     - every client shares one connection
+//   run 2  "pool"          - ChannelPool of <channels> connections
+//   run 3  "pool+hedge"    - same pool, hedgedCall() with a backup attempt
+//                            after <hedge-us> on the next connection, at
+//                            most <hedge-budget> hedges per call overall
+//
+// Admission control is disabled so only the transport differs.
+//
+//   channel_pool_scenario [--clients 16] [--rate 2000] [--seconds 5]
+//                         [--channels 4] [--stall-every 100] [--stall-ms 20]
+//                         [--hedge-us 2000] [--hedge-budget 0.1]
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include "BookingServiceImpl.hpp"
+#include "Workload.hpp"
+#include "booking/service/IBookingRepository.hpp"
+#include "booking/telemetry/Metrics.hpp"
+#include "transport/ChannelFactory.hpp"
+
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/server_builder.h>
+
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace booking::service {
+std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+using booking::domain::Movie;
+using booking::domain::Seat;
+using booking::domain::Theater;
+using booking::service::CatalogStatus;
+using booking::service::IBookingRepository;
+
+namespace {            // ─────────────────────────── helpers / CLI
+using Clock = std::chrono::steady_clock;
+
+struct Cmd {
+    int    clients    = 16;
+    double rate       = 2000;
+    double seconds    = 5;
+    int    channels   = 4;
+    int    stallEvery = 100;
+    int    stallMs    = 20;
+    long   hedgeUs    = 2000;
+    double budget     = 0.1;
+};
+
+Cmd parse(int argc, char** argv)
+{
+    Cmd cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{argv[i]};
+        auto next = [&] {
+            if (++i >= argc)
+                throw std::runtime_error("no value for " + arg);
+            return std::stod(argv[i]);
+        };
+        if      (arg == "--clients")     cfg.clients    = static_cast<int>(next());
+        else if (arg == "--rate")        cfg.rate       = next();
+        else if (arg == "--seconds")     cfg.seconds    = next();
+        else if (arg == "--channels")    cfg.channels   = static_cast<int>(next());
+        else if (arg == "--stall-every") cfg.stallEvery = static_cast<int>(next());
+        else if (arg == "--stall-ms")    cfg.stallMs    = static_cast<int>(next());
+        else if (arg == "--hedge-us")    cfg.hedgeUs    = static_cast<long>(next());
+        else if (arg == "--hedge-budget") cfg.budget    = next();
+        else if (arg == "--help") {
+            std::cout << "channel_pool_scenario [--clients <n>] [--rate <req/s>] "
+                         "[--seconds <s>] [--channels <n>] [--stall-every <n>] "
+                         "[--stall-ms <n>] [--hedge-us <n>] [--hedge-budget <f>]\n";
+            std::exit(0);
+        } else {
+            throw std::runtime_error("unknown option " + arg);
+        }
+    }
+    return cfg;
+}
+
+/// Forwards to the in-memory repository; freeSeats() stalls now and then.
+class StallingRepository final : public IBookingRepository
+{
+public:
+    StallingRepository(int every, std::chrono::milliseconds stall)
+        : inner_{booking::service::makeInMemoryRepository()}, every_{every}, stall_{stall} {}
+
+    std::vector<Movie> movies() const override { return inner_->movies(); }
+    std::vector<std::shared_ptr<const Theater>> theaters(Movie::Id m) const override
+    {
+        return inner_->theaters(m);
+    }
+    std::vector<Seat> freeSeats(Movie::Id m, Theater::Id t) const override
+    {
+        thread_local std::minstd_rand rng{std::random_device{}()};
+        if (every_ > 0 && rng() % static_cast<unsigned>(every_) == 0)
+            std::this_thread::sleep_for(stall_);
+        return inner_->freeSeats(m, t);
+    }
+    bool book(Movie::Id m, Theater::Id t, const std::vector<Seat>& s) override
+    {
+        return inner_->book(m, t, s);
+    }
+    CatalogStatus addMovie(Movie movie) override { return inner_->addMovie(std::move(movie)); }
+    CatalogStatus addScreening(Movie::Id m, Theater::Id t, std::string name) override
+    {
+        return inner_->addScreening(m, t, std::move(name));
+    }
+    CatalogStatus retireScreening(Movie::Id m, Theater::Id t) override
+    {
+        return inner_->retireScreening(m, t);
+    }
+
+private:
+    std::shared_ptr<IBookingRepository> inner_;
+    int                                 every_;
+    std::chrono::milliseconds           stall_;
+};
+
+enum class Mode { Single, Pool, Hedged };
+
+void report(const char* lbl, const booking::telemetry::Histogram& h, std::uint64_t errors)
+{
+    const auto s  = h.snapshot();
+    const auto us = [&](double q) { return static_cast<double>(s.quantile(q)) / 1000.0; };
+    std::cout << std::left << std::setw(12) << lbl << std::right << std::fixed << std::setprecision(0)
+              << " calls=" << std::setw(7) << s.count
+              << " p50=" << std::setw(6) << us(0.50) << "us"
+              << " p99=" << std::setw(6) << us(0.99) << "us"
+              << " p999=" << std::setw(6) << us(0.999) << "us"
+              << " errors=" << errors << '\n';
+}
+
+// ---------------------------------------------------------------------------
+void run(const Cmd& cfg, Mode mode, const char* lbl)
+{
+    auto repo = std::make_shared<StallingRepository>(cfg.stallEvery,
+                                                     std::chrono::milliseconds{cfg.stallMs});
+    std::vector<Theater::Id> halls;
+    for (Theater::Id t = 1001; t <= 1064; ++t) {
+        repo->addScreening(1, t, "Hall-" + std::to_string(t));
+        halls.push_back(t);
+    }
+    auto mgr = std::make_shared<booking::service::BookingManager>(repo);
+
+    ServiceOptions opts;
+    opts.admission.enabled = false;
+    BookingServiceImpl svc{mgr, opts};
+
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&svc);
+    auto server = builder.BuildAndStart();
+    if (!server) throw std::runtime_error("failed to start in-process server");
+
+    transport::PoolOptions po;
+    po.size = mode == Mode::Single ? 1 : static_cast<std::size_t>(cfg.channels);
+    const auto pool  = transport::makeChannelPool("127.0.0.1", port, po);
+    const auto stubs = pool.stubs<booking::Booking>();
+
+    transport::HedgeBudget budget{cfg.budget};
+    transport::HedgePolicy hedge;
+    hedge.delay  = std::chrono::microseconds{cfg.hedgeUs};
+    hedge.budget = &budget;
+
+    const loadgen::SeatPicker picker{loadgen::Dist::Zipf, halls.size(), 1, 1.1};
+    booking::telemetry::Histogram latency;
+    std::atomic<std::uint64_t> errors{0};
+
+    const auto period = std::chrono::duration<double>(static_cast<double>(cfg.clients) / cfg.rate);
+    const auto start  = Clock::now() + std::chrono::milliseconds{100};
+    const auto end    = start + std::chrono::duration_cast<Clock::duration>(
+                                    std::chrono::duration<double>(cfg.seconds));
+
+    std::vector<std::thread> clients;
+    for (int c = 0; c < cfg.clients; ++c)
+        clients.emplace_back([&, c] {
+            std::mt19937_64 rng(static_cast<unsigned>(c));
+            const auto offset = period * (static_cast<double>(c) / cfg.clients);
+            for (std::uint64_t k = 0;; ++k) {
+                const auto intended = start + std::chrono::duration_cast<Clock::duration>(
+                                                  offset + period * static_cast<double>(k));
+                if (intended >= end) break;
+                std::this_thread::sleep_until(intended);
+
+                booking::TheaterReq req;
+                req.set_movie_id(1);
+                req.set_theater_id(halls[picker(rng)]);
+                booking::SeatList rep;
+                grpc::Status st;
+                if (mode == Mode::Hedged) {
+                    st = transport::hedgedCall(stubs, pool.pick(),
+                                               &booking::Booking::Stub::AsyncListFreeSeats,
+                                               req, &rep, hedge);
+                } else {
+                    grpc::ClientContext ctx;
+                    st = stubs[pool.pick()]->ListFreeSeats(&ctx, req, &rep);
+                }
+                if (!st.ok()) errors.fetch_add(1);
+                latency.record(static_cast<std::uint64_t>(
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - intended).count()));
+            }
+        });
+    for (auto& t : clients) t.join();
+
+    server->Shutdown();
+    report(lbl, latency, errors.load());
+}
+// ---------------------------------------------------------------------------
+} // unnamed namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+int main(int argc, char** argv)
+try {
+    const Cmd cfg = parse(argc, argv);
+    std::cout << "ListFreeSeats: " << cfg.clients << " clients at " << cfg.rate
+              << " req/s for " << cfg.seconds << "s, 1 in " << cfg.stallEvery
+              << " calls stalls " << cfg.stallMs << "ms\n";
+
+    run(cfg, Mode::Single, "1 channel");
+    run(cfg, Mode::Pool,   "pool");
+    run(cfg, Mode::Hedged, "pool+hedge");
+    return 0;
+}
+catch (const std::exception& e) {
+    std::cerr << "error: " << e.what() << '\n';
+    return 1;
+}
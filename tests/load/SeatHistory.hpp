@@ -0,0 +1,234 @@
+#ifndef STRESS_SEAT_HISTORY_HPP
+#define STRESS_SEAT_HISTORY_HPP
+//  SeatHistory.hpp
+//  ---------------------------------------------------------------------------
+//  Operation histories recorded by stress_scenario and the checker that
+//  validates them against the sequential specification of a hall.
+//
+//  A hall is a 20-bit set that only ever grows: `book(S)` adds S if it is
+//  disjoint from the current set and fails otherwise, `list()` returns the
+//  set.  For such an object a history is linearizable exactly when every
+//  call can be placed at one instant inside its [invoke, reply] window.
+//  Because each seat is taken at most once, the checker does not search
+//  orderings; it tests, per hall, the conditions any such placement forces:
+//
+//    • double-booking      - a seat is in two successful bookings
+//    • lost-booking        - a booked seat is free in the final state
+//    • phantom-seat        - a seat is taken at the end, nobody booked it
+//    • false-conflict      - a booking failed although no overlapping
+//                            successful booking had started before it ended
+//    • phantom-read        - a list saw a seat taken before its booking began
+//    • stale-read          - a list missed a booking that completed before
+//                            the list was invoked
+//    • torn-read           - a list saw only part of one booking
+//    • non-monotonic-read  - a list missed a seat that an earlier list
+//                            (completed before it started) had seen taken
+//  ---------------------------------------------------------------------------
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace stress {
+
+using Mask = std::uint32_t;                ///< bit i == seat index i
+inline constexpr unsigned kSeats = 20;     ///< Theater::kCapacity
+
+/// One completed call; times are steady-clock nanoseconds.
+struct Event
+{
+    std::int64_t  invoke = 0;   ///< taken just before the call
+    std::int64_t  reply  = 0;   ///< taken just after it returned
+    std::uint32_t hall   = 0;
+    Mask          seats  = 0;   ///< book: requested / list: seen taken
+    bool          book   = false;
+    bool          ok     = false;   ///< book succeeded
+};
+
+/// Kind of violation, see the file header.
+enum class Anomaly : std::uint8_t
+{
+    DoubleBooking,
+    LostBooking,
+    PhantomSeat,
+    FalseConflict,
+    PhantomRead,
+    StaleRead,
+    TornRead,
+    NonMonotonicRead,
+};
+inline constexpr std::size_t kAnomalies = 8;
+
+inline const char* anomalyName(Anomaly a) noexcept
+{
+    switch (a) {
+        case Anomaly::DoubleBooking:    return "double-booking";
+        case Anomaly::LostBooking:      return "lost-booking";
+        case Anomaly::PhantomSeat:      return "phantom-seat";
+        case Anomaly::FalseConflict:    return "false-conflict";
+        case Anomaly::PhantomRead:      return "phantom-read";
+        case Anomaly::StaleRead:        return "stale-read";
+        case Anomaly::TornRead:         return "torn-read";
+        case Anomaly::NonMonotonicRead: return "non-monotonic-read";
+    }
+    return "?";
+}
+
+/// Outcome of check(): a count per anomaly plus the first few in words.
+struct Verdict
+{
+    std::size_t                             events = 0;
+    std::size_t                             halls  = 0;
+    std::array<std::size_t, kAnomalies>     count{};
+    std::vector<std::string>                examples;
+
+    [[nodiscard]] std::size_t total() const noexcept
+    {
+        std::size_t n = 0;
+        for (auto c : count) n += c;
+        return n;
+    }
+    [[nodiscard]] std::size_t operator[](Anomaly a) const noexcept
+    {
+        return count[static_cast<std::size_t>(a)];
+    }
+};
+
+namespace detail {
+class HallChecker
+{
+public:
+    HallChecker(Verdict& v, std::size_t maxExamples, std::int64_t t0)
+        : v_{v}, max_{maxExamples}, t0_{t0} {}
+
+    /// @p ev: every event of one hall; @p final: its seats taken at the end.
+    void run(const Event* first, const Event* last, std::uint32_t hall, Mask final)
+    {
+        hall_ = hall;
+        owner_.fill(nullptr);
+
+        Mask booked = 0;
+        for (const Event* e = first; e != last; ++e) {
+            if (!e->book || !e->ok) continue;
+            for (unsigned s = 0; s < kSeats; ++s) {
+                if (!(e->seats & (1u << s))) continue;
+                if (owner_[s]) report(Anomaly::DoubleBooking, s, *owner_[s], *e);
+                else           owner_[s] = e;
+            }
+            booked |= e->seats;
+        }
+        for (unsigned s = 0; s < kSeats; ++s) {
+            const Mask bit = 1u << s;
+            if ((booked & bit) && !(final & bit)) report(Anomaly::LostBooking, s, *owner_[s]);
+            if (!(booked & bit) && (final & bit)) report(Anomaly::PhantomSeat, s);
+        }
+
+        // earliest reply of a list that saw the seat taken
+        std::array<std::int64_t, kSeats> seen;
+        seen.fill(INT64_MAX);
+        for (const Event* e = first; e != last; ++e) {
+            if (e->book) { if (!e->ok) failed(*e); continue; }
+            listed(*e);
+            for (unsigned s = 0; s < kSeats; ++s)
+                if (e->seats & (1u << s)) seen[s] = std::min(seen[s], e->reply);
+        }
+        for (const Event* e = first; e != last; ++e) {
+            if (e->book) continue;
+            for (unsigned s = 0; s < kSeats; ++s)
+                if (!(e->seats & (1u << s)) && e->invoke > seen[s])
+                    report(Anomaly::NonMonotonicRead, s, *e);
+        }
+    }
+
+private:
+    /// Some overlapping booking must have started before the failure returned.
+    void failed(const Event& e)
+    {
+        for (unsigned s = 0; s < kSeats; ++s)
+            if ((e.seats & (1u << s)) && owner_[s] && owner_[s]->invoke < e.reply) return;
+        report(Anomaly::FalseConflict, firstSeat(e.seats), e);
+    }
+
+    void listed(const Event& e)
+    {
+        for (unsigned s = 0; s < kSeats; ++s) {
+            const Event* b = owner_[s];
+            if (e.seats & (1u << s)) {
+                if (!b || b->invoke > e.reply)         report(Anomaly::PhantomRead, s, e);
+                else if ((b->seats & e.seats) != b->seats) report(Anomaly::TornRead, s, e, *b);
+            } else if (b && b->reply < e.invoke) {
+                report(Anomaly::StaleRead, s, e, *b);
+            }
+        }
+    }
+
+    static unsigned firstSeat(Mask m) noexcept
+    {
+        unsigned s = 0;
+        while (s < kSeats && !(m & (1u << s))) ++s;
+        return s;
+    }
+
+    void report(Anomaly a, unsigned seat, const Event& x = {}, const Event& y = {})
+    {
+        ++v_.count[static_cast<std::size_t>(a)];
+        if (v_.examples.size() >= max_) return;
+        std::ostringstream os;
+        os << anomalyName(a) << ": hall " << hall_ << " seat A" << seat + 1;
+        for (const Event* e : {&x, &y}) {
+            if (!e->invoke && !e->reply) continue;
+            os << (e->book ? (e->ok ? " book-ok" : " book-fail") : " list")
+               << "[" << (e->invoke - t0_) / 1000 << "us.." << (e->reply - t0_) / 1000
+               << "us mask=0x" << std::hex << e->seats << std::dec << "]";
+        }
+        v_.examples.push_back(os.str());
+    }
+
+    Verdict&                            v_;
+    std::size_t                         max_;
+    std::int64_t                        t0_;
+    std::uint32_t                       hall_ = 0;
+    std::array<const Event*, kSeats>    owner_{};   ///< successful booking per seat
+};
+} // namespace detail
+
+/**
+ * @brief Check a complete history (every call made against the halls in
+ *        @p finalTaken) for the anomalies listed in the file header.
+ *
+ * @param history     events of all threads, any order
+ * @param finalTaken  seats taken per hall after every call returned; halls
+ *                    missing here count as empty
+ * @param maxExamples how many violations to describe in words
+ */
+inline Verdict check(std::vector<Event>                              history,
+                     const std::unordered_map<std::uint32_t, Mask>&  finalTaken,
+                     std::size_t                                     maxExamples = 10)
+{
+    Verdict v;
+    v.events = history.size();
+    std::sort(history.begin(), history.end(), [](const Event& a, const Event& b) {
+        return a.hall != b.hall ? a.hall < b.hall : a.invoke < b.invoke;
+    });
+    std::int64_t t0 = INT64_MAX;
+    for (const Event& e : history) t0 = std::min(t0, e.invoke);
+
+    detail::HallChecker hc{v, maxExamples, t0};
+    for (auto it = history.begin(); it != history.end();) {
+        const auto end = std::find_if(it, history.end(),
+                                      [h = it->hall](const Event& e) { return e.hall != h; });
+        const auto f = finalTaken.find(it->hall);
+        hc.run(&*it, &*it + (end - it), it->hall, f == finalTaken.end() ? 0 : f->second);
+        ++v.halls;
+        it = end;
+    }
+    return v;
+}
+
+} // namespace stress
+
+#endif //STRESS_SEAT_HISTORY_HPP
@@ -0,0 +1,350 @@
+// tests/load/StressScenario.cpp
+// ─────────────────────────────────────────────────────────────────────────────
+// Concurrency stress test for the booking core, with history checking.
+//
+// <threads> threads hammer a BookingManager over the in-memory repository
+// for <seconds>, each picking an operation from <mix>:
+//
+//   list  - freeSeats() on the hall
+//   book  - book one or two random seats
+//   hold  - book a block of 2-4 adjacent seats in one all-or-nothing call
+//           (the domain has no separate hold state; this is the
+//           multi-seat path that a torn or partial booking would break)
+//
+// Contention is kept high by aiming every thread at the same <halls>
+// screenings.  Those fill up within microseconds, so the run moves
+// through epochs: a worker that finds a hall sold out (or keeps failing
+// to book) advances everyone to the next set of halls, which the main
+// thread has already published.  Hall ids are recycled through a ring of
+// epochs - retireScreening() + addScreening() once no worker is still on
+// the old epoch - so the catalog stays small and its writer path runs
+// under full load the whole time.
+//
+// Every call is recorded as [invoke, reply] with its arguments and result.
+// After the run the histories are checked (tests/load/SeatHistory.hpp) for
+// double-booking and linearizability violations against the final seat
+// maps, and throughput is reported per operation.  The exit status is 1 if
+// any violation was found, so the scenario doubles as a ctest gate.
+//
+//   stress_scenario [--threads 8] [--seconds 5] [--halls 4]
+//                   [--mix list=30,book=50,hold=20] [--seed 1]
+//                   [--max-events 20000000]
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include "SeatHistory.hpp"
+#include "Workload.hpp"
+#include "booking/service/BookingManager.hpp"
+#include "booking/service/IBookingRepository.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace booking::service {
+std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+using booking::domain::Seat;
+using booking::domain::Theater;
+using booking::service::BookingManager;
+using booking::service::CatalogStatus;
+using loadgen::Op;
+
+namespace {            // ─────────────────────────── helpers / CLI
+using Clock = std::chrono::steady_clock;
+
+constexpr booking::domain::Movie::Id kMovie      = 1;
+constexpr Theater::Id                kFirstHall  = 10'000;
+constexpr stress::Mask               kAllSeats   = (1u << Theater::kCapacity) - 1;
+constexpr int                        kRing       = 8;    // epochs sharing hall ids
+constexpr int                        kAhead      = 2;    // epochs published in advance
+constexpr int                        kMaxFailures = 32;  // failed books before moving on
+
+struct Cmd {
+    int          threads   = static_cast<int>(std::max(4u, 2 * std::thread::hardware_concurrency()));
+    double       seconds   = 5;
+    int          halls     = 4;
+    loadgen::Mix mix       = loadgen::Mix::parse("list=30,book=50,hold=20");
+    unsigned     seed      = 1;
+    std::size_t  maxEvents = 20'000'000;
+};
+
+Cmd parse(int argc, char** argv)
+{
+    Cmd cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{argv[i]};
+        auto next = [&]() -> std::string {
+            if (++i >= argc)
+                throw std::runtime_error("no value for " + arg);
+            return argv[i];
+        };
+        if      (arg == "--threads")    cfg.threads   = std::stoi(next());
+        else if (arg == "--seconds")    cfg.seconds   = std::stod(next());
+        else if (arg == "--halls")      cfg.halls     = std::stoi(next());
+        else if (arg == "--mix")        cfg.mix       = loadgen::Mix::parse(next());
+        else if (arg == "--seed")       cfg.seed      = static_cast<unsigned>(std::stoul(next()));
+        else if (arg == "--max-events") cfg.maxEvents = std::stoull(next());
+        else if (arg == "--help") {
+            std::cout << "stress_scenario [--threads <n>] [--seconds <s>] [--halls <n>] "
+                         "[--mix list=..,book=..,hold=..] [--seed <n>] [--max-events <n>]\n";
+            std::exit(0);
+        } else {
+            throw std::runtime_error("unknown option " + arg);
+        }
+    }
+    if (cfg.threads < 1 || cfg.halls < 1 || cfg.seconds <= 0)
+        throw std::runtime_error("--threads, --halls and --seconds must be positive");
+    return cfg;
+}
+
+std::int64_t nowNs()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        Clock::now().time_since_epoch()).count();
+}
+
+std::vector<Seat> toSeats(stress::Mask m)
+{
+    std::vector<Seat> seats;
+    for (std::uint8_t i = 0; i < Theater::kCapacity; ++i)
+        if (m & (1u << i)) seats.push_back(Seat::fromIndex(i));
+    return seats;
+}
+
+stress::Mask takenSeats(const BookingManager& mgr, Theater::Id hall)
+{
+    stress::Mask freeMask = 0;
+    for (const Seat& s : mgr.freeSeats(kMovie, hall)) freeMask |= 1u << s.index;
+    return kAllSeats & ~freeMask;
+}
+
+struct Counters {
+    std::uint64_t ops[loadgen::kOps] = {};
+    std::uint64_t ok[loadgen::kOps]  = {};
+};
+
+struct alignas(64) Worker {
+    std::atomic<int>           pinned{0};   // epoch of the call in flight
+    std::vector<stress::Event> history;
+    Counters                   n;
+    bool                       truncated = false;   // hit its event budget
+};
+
+/**
+ * Epoch bookkeeping shared by the workers and the main thread.  A hall
+ * has a physical id (recycled every kRing epochs) and a logical one
+ * (`epoch * halls + h`, unique for the run) under which its calls are
+ * recorded.
+ */
+struct Epochs {
+    int              halls;
+    std::atomic<int> current{0};   // where workers book
+    std::atomic<int> ready{0};     // newest epoch whose halls exist
+
+    [[nodiscard]] Theater::Id physical(int epoch, int h) const
+    {
+        return kFirstHall + static_cast<Theater::Id>((epoch % kRing) * halls + h);
+    }
+    [[nodiscard]] std::uint32_t logical(int epoch, int h) const
+    {
+        return static_cast<std::uint32_t>(epoch * halls + h);
+    }
+    /// Move everyone on from @p from, if the next epoch is published.
+    void advance(int from)
+    {
+        if (ready.load() > from) current.compare_exchange_strong(from, from + 1);
+    }
+};
+
+// ---------------------------------------------------------------------------
+void work(const Cmd& cfg, BookingManager& mgr, Epochs& epochs,
+          const std::atomic<bool>& stop, unsigned id, Worker& w)
+{
+    std::mt19937 rng{cfg.seed * 7919u + id};
+    std::uniform_real_distribution<double>  unit{0.0, 1.0};
+    std::uniform_int_distribution<int>      hallOf{0, cfg.halls - 1};
+    std::uniform_int_distribution<unsigned> seatOf{0, Theater::kCapacity - 1};
+    std::uniform_int_distribution<unsigned> blockOf{2, 4};
+
+    const std::size_t budget = cfg.maxEvents / static_cast<std::size_t>(cfg.threads);
+    w.history.reserve(std::min<std::size_t>(budget, 1u << 20));
+    int failures = 0;
+
+    while (!stop.load(std::memory_order_relaxed)) {
+        if (w.history.size() >= budget) { w.truncated = true; break; }
+
+        // pin the epoch, then confirm it is still current: the main thread
+        // only recycles an epoch's hall ids once no worker is pinned to it
+        const int epoch = epochs.current.load();
+        w.pinned.store(epoch);
+        if (epochs.current.load() != epoch) continue;
+
+        const Op  op   = cfg.mix.pick(unit(rng));
+        const int h    = hallOf(rng);
+        const auto hall = epochs.physical(epoch, h);
+        stress::Event e;
+        e.hall = epochs.logical(epoch, h);
+
+        if (op == Op::List) {
+            e.invoke = nowNs();
+            e.seats  = takenSeats(mgr, hall);
+            e.reply  = nowNs();
+            if (e.seats == kAllSeats) epochs.advance(epoch);
+        } else {
+            if (op == Op::Book) {
+                e.seats = 1u << seatOf(rng);
+                if (unit(rng) < 0.5) e.seats |= 1u << seatOf(rng);
+            } else {
+                const unsigned len   = blockOf(rng);
+                const unsigned start = seatOf(rng) % (Theater::kCapacity - len + 1);
+                e.seats = ((1u << len) - 1) << start;
+            }
+            const auto seats = toSeats(e.seats);
+            e.book   = true;
+            e.invoke = nowNs();
+            e.ok     = mgr.book(kMovie, hall, seats);
+            e.reply  = nowNs();
+            failures = e.ok ? 0 : failures + 1;
+            if (failures >= kMaxFailures) { epochs.advance(epoch); failures = 0; }
+        }
+        const auto k = static_cast<std::size_t>(op);
+        ++w.n.ops[k];
+        w.n.ok[k] += op == Op::List || e.ok;
+        w.history.push_back(e);
+    }
+    w.pinned.store(std::numeric_limits<int>::max());
+}
+
+/// Record the final seat maps of @p epoch's halls, then retire them.
+void retire(booking::service::IBookingRepository& repo, const BookingManager& mgr,
+            const Epochs& epochs, int epoch,
+            std::unordered_map<std::uint32_t, stress::Mask>& finalTaken)
+{
+    for (int h = 0; h < epochs.halls; ++h) {
+        finalTaken[epochs.logical(epoch, h)] = takenSeats(mgr, epochs.physical(epoch, h));
+        if (repo.retireScreening(kMovie, epochs.physical(epoch, h)) != CatalogStatus::Ok)
+            throw std::runtime_error("cannot retire hall " + std::to_string(epochs.physical(epoch, h)));
+    }
+}
+
+void publish(booking::service::IBookingRepository& repo, const Epochs& epochs, int epoch)
+{
+    for (int h = 0; h < epochs.halls; ++h) {
+        const Theater::Id id = epochs.physical(epoch, h);
+        if (repo.addScreening(kMovie, id, "Stress-" + std::to_string(id)) != CatalogStatus::Ok)
+            throw std::runtime_error("cannot add hall " + std::to_string(id));
+    }
+}
+// ---------------------------------------------------------------------------
+} // unnamed namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+int main(int argc, char** argv)
+try {
+    const Cmd cfg = parse(argc, argv);
+    std::cout << "stress: " << cfg.threads << " threads x " << cfg.seconds << "s, "
+              << cfg.halls << " halls per epoch, mix " << cfg.mix.str() << '\n';
+
+    auto repo = booking::service::makeInMemoryRepository();
+    BookingManager mgr{repo};
+    Epochs epochs{cfg.halls};
+    std::unordered_map<std::uint32_t, stress::Mask> finalTaken;
+    publish(*repo, epochs, 0);
+
+    std::atomic<bool>        stop{false};
+    std::vector<Worker>      workers(static_cast<std::size_t>(cfg.threads));
+    std::vector<std::thread> threads;
+    for (unsigned i = 0; i < workers.size(); ++i)
+        threads.emplace_back(work, std::cref(cfg), std::ref(mgr), std::ref(epochs),
+                             std::cref(stop), i, std::ref(workers[i]));
+
+    // keep kAhead epochs published, recycling the hall ids of the epoch
+    // kRing back once every worker has moved past it
+    const auto start    = Clock::now();
+    const auto deadline = start + std::chrono::duration<double>(cfg.seconds);
+    int oldest = 0;                                     // oldest live epoch
+    while (Clock::now() < deadline) {
+        const int next = epochs.ready.load() + 1;
+        if (next > epochs.current.load() + kAhead) {
+            std::this_thread::yield();
+            continue;
+        }
+        if (next - kRing >= oldest) {
+            int pinned = std::numeric_limits<int>::max();
+            for (const Worker& w : workers) pinned = std::min(pinned, w.pinned.load());
+            if (pinned <= oldest) {
+                std::this_thread::yield();
+                continue;
+            }
+            retire(*repo, mgr, epochs, oldest++, finalTaken);
+        }
+        publish(*repo, epochs, next);
+        epochs.ready.store(next);
+    }
+    stop = true;
+    for (auto& t : threads) t.join();
+    const double wallS = std::chrono::duration<double>(Clock::now() - start).count();
+    for (int e = oldest; e <= epochs.ready.load(); ++e)
+        for (int h = 0; h < cfg.halls; ++h)
+            finalTaken[epochs.logical(e, h)] = takenSeats(mgr, epochs.physical(e, h));
+
+    // ── throughput
+    Counters    total;
+    std::size_t events = 0;
+    bool        truncated = false;
+    for (const Worker& w : workers) {
+        for (std::size_t k = 0; k < loadgen::kOps; ++k) {
+            total.ops[k] += w.n.ops[k];
+            total.ok[k]  += w.n.ok[k];
+        }
+        events    += w.history.size();
+        truncated |= w.truncated;
+    }
+    std::uint64_t all = 0;
+    for (std::size_t k = 0; k < loadgen::kOps; ++k) {
+        all += total.ops[k];
+        std::cout << std::left << std::setw(6) << loadgen::opName(static_cast<Op>(k))
+                  << " ops=" << std::setw(10) << total.ops[k]
+                  << " ok="  << std::setw(10) << total.ok[k]
+                  << " ops/s=" << std::fixed << std::setprecision(0)
+                  << static_cast<double>(total.ops[k]) / wallS << '\n';
+    }
+    std::cout << std::left << std::setw(6) << "total" << " ops=" << std::setw(10) << all
+              << " epochs=" << std::setw(7) << epochs.current.load() + 1
+              << " ops/s=" << static_cast<double>(all) / wallS
+              << (truncated ? "  (event budget reached, some threads stopped early)" : "")
+              << '\n';
+
+    // ── history check
+    std::vector<stress::Event> history;
+    history.reserve(events);
+    for (Worker& w : workers) {
+        history.insert(history.end(), w.history.begin(), w.history.end());
+        std::vector<stress::Event>{}.swap(w.history);
+    }
+    const auto checkStart = Clock::now();
+    const stress::Verdict v = stress::check(std::move(history), finalTaken);
+    std::cout << "check  events=" << v.events << " halls=" << v.halls
+              << " violations=" << v.total() << " ("
+              << std::setprecision(2)
+              << std::chrono::duration<double>(Clock::now() - checkStart).count() << "s)\n";
+    for (std::size_t a = 0; a < stress::kAnomalies; ++a)
+        if (v.count[a])
+            std::cout << "  " << std::setw(20) << stress::anomalyName(static_cast<stress::Anomaly>(a))
+                      << v.count[a] << '\n';
+    for (const auto& ex : v.examples) std::cout << "  " << ex << '\n';
+    return v.total() ? 1 : 0;
+}
+catch (const std::exception& e) {
+    std::cerr << "error: " << e.what() << '\n';
+    return 1;
+}
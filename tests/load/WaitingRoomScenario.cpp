@@ -0,0 +1,219 @@
+// tests/load/WaitingRoomScenario.cpp
+// ─────────────────────────────────────────────────────────────────────────────
+// On-sale burst scenario for the virtual waiting room.
+//
+// Starts an in-process booking server twice on an ephemeral TCP port:
+//
+//   run 1  "direct"        - every client hits BookSeats immediately
+//   run 2  "waiting-room"  - movie 1 is gated; clients JoinQueue, poll
+//                            QueueStatus until admitted, then book
+//
+// In both runs <clients> threads start at the same instant and each issues
+// <attempts> BookSeats calls on random seats of movie 1.  Only BookSeats
+// latency is recorded (queue time is reported separately), so the two
+// p50 / p99 / max lines are directly comparable.
+//
+// Admission control is disabled in both runs to isolate the waiting room.
+//
+//   waiting_room_scenario [--clients 512] [--attempts 4] [--channels 8]
+// ─────────────────────────────────────────────────────────────────────────────
+
+#include "BookingServiceImpl.hpp"
+#include "booking/service/IBookingRepository.hpp"
+#include "transport/ChannelFactory.hpp"
+
+#include <grpcpp/grpcpp.h>
+#include <grpcpp/server_builder.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace booking::service {
+std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+namespace {            // ─────────────────────────── helpers / CLI
+using Clock = std::chrono::steady_clock;
+using std::chrono::microseconds;
+
+struct Cmd {
+    int clients  = 512;
+    int attempts = 4;
+    int channels = 8;
+};
+
+Cmd parse(int argc, char** argv)
+{
+    Cmd cfg;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg{argv[i]};
+        auto next = [&] {
+            if (++i >= argc)
+                throw std::runtime_error("no value for " + arg);
+            return std::stoi(argv[i]);
+        };
+        if      (arg == "--clients")  cfg.clients  = next();
+        else if (arg == "--attempts") cfg.attempts = next();
+        else if (arg == "--channels") cfg.channels = next();
+        else if (arg == "--help") {
+            std::cout << "waiting_room_scenario [--clients <n>] "
+                         "[--attempts <n>] [--channels <n>]\n";
+            std::exit(0);
+        } else {
+            throw std::runtime_error("unknown option " + arg);
+        }
+    }
+    return cfg;
+}
+
+struct Result {
+    std::vector<long> bookUs;      // per BookSeats call
+    std::vector<long> queueUs;     // per client, join -> admitted
+    double            wallS = 0;
+};
+
+long pct(std::vector<long>& v, double p)
+{
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    return v[std::min(v.size() - 1, static_cast<std::size_t>(p * static_cast<double>(v.size())))];
+}
+
+void report(const char* lbl, Result& r)
+{
+    std::cout << std::left << std::setw(14) << lbl
+              << " calls=" << std::setw(6) << r.bookUs.size()
+              << " p50="   << std::setw(7) << pct(r.bookUs, 0.50) << "us"
+              << " p99="   << std::setw(7) << pct(r.bookUs, 0.99) << "us"
+              << " max="   << std::setw(7) << pct(r.bookUs, 1.00) << "us";
+    if (!r.queueUs.empty())
+        std::cout << " queue-p99=" << pct(r.queueUs, 0.99) / 1000 << "ms";
+    std::cout << " wall=" << std::fixed << std::setprecision(2) << r.wallS << "s\n";
+}
+
+// ---------------------------------------------------------------------------
+Result run(const Cmd& cfg, bool gated)
+{
+    auto mgr = std::make_shared<booking::service::BookingManager>(
+        booking::service::makeInMemoryRepository());
+
+    ServiceOptions opts;
+    opts.admission.enabled = false;
+    if (gated) {
+        WaitingRoom::Config wr;
+        wr.movies   = {1};
+        wr.tick     = std::chrono::milliseconds{20};
+        wr.minBatch = 16;
+        wr.bookingsPerToken = static_cast<std::uint32_t>(std::clamp(cfg.attempts, 1, 255));
+        opts.waitingRoom = std::make_shared<WaitingRoom>(wr);
+    }
+    BookingServiceImpl svc{mgr, opts};
+
+    int port = 0;
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    builder.RegisterService(&svc);
+    auto server = builder.BuildAndStart();
+    if (!server) throw std::runtime_error("failed to start in-process server");
+
+    std::vector<std::unique_ptr<booking::Booking::Stub>> stubs;
+    for (int i = 0; i < cfg.channels; ++i) {
+        grpc::ChannelArguments args;
+        args.SetInt("grpc.channel_id", i);      // distinct connections
+        stubs.push_back(booking::Booking::NewStub(grpc::CreateCustomChannel(
+            transport::Endpoints::tcp("127.0.0.1", port),
+            grpc::InsecureChannelCredentials(), args)));
+    }
+
+    Result res;
+    std::mutex resMtx;
+    std::atomic<bool> go{false};
+
+    auto client = [&](int id) {
+        auto& stub = *stubs[static_cast<std::size_t>(id % cfg.channels)];
+        std::mt19937 rng(static_cast<unsigned>(id));
+        std::uniform_int_distribution<unsigned> seat(0, booking::domain::Theater::kCapacity - 1);
+        std::vector<long> mine;
+        long queued = -1;
+
+        while (!go.load(std::memory_order_acquire)) std::this_thread::yield();
+
+        std::uint64_t token = 0;
+        if (gated) {
+            const auto t0 = Clock::now();
+            booking::QueueReq qr; qr.set_movie_id(1);
+            booking::QueueTicket t;
+            grpc::ClientContext jc;
+            if (!stub.JoinQueue(&jc, qr, &t).ok()) return;
+            while (!t.admitted()) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(t.retry_after_ms()));
+                booking::TicketReq tr; tr.set_movie_id(1); tr.set_token(t.token());
+                grpc::ClientContext pc;
+                if (!stub.QueueStatus(&pc, tr, &t).ok()) return;
+            }
+            token  = t.token();
+            queued = std::chrono::duration_cast<microseconds>(Clock::now() - t0).count();
+        }
+
+        for (int a = 0; a < cfg.attempts; ++a) {
+            booking::BookingReq br;
+            br.set_movie_id(1);
+            br.set_theater_id(a % 2 ? 102 : 101);
+            br.set_queue_token(token);
+            const auto idx = seat(rng);
+            auto* s = br.add_seats();
+            s->set_index(idx);
+            s->set_label("A" + std::to_string(idx + 1));
+
+            booking::BookingRep rep;
+            grpc::ClientContext bc;
+            const auto t0 = Clock::now();
+            stub.BookSeats(&bc, br, &rep);      // conflicts are expected
+            mine.push_back(std::chrono::duration_cast<microseconds>(Clock::now() - t0).count());
+        }
+
+        std::scoped_lock lk{resMtx};
+        res.bookUs.insert(res.bookUs.end(), mine.begin(), mine.end());
+        if (queued >= 0) res.queueUs.push_back(queued);
+    };
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < cfg.clients; ++i) workers.emplace_back(client, i);
+
+    const auto start = Clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& t : workers) t.join();
+    res.wallS = std::chrono::duration<double>(Clock::now() - start).count();
+
+    server->Shutdown();
+    return res;
+}
+// ---------------------------------------------------------------------------
+} // unnamed namespace
+
+// ─────────────────────────────────────────────────────────────────────────────
+int main(int argc, char** argv)
+try {
+    const Cmd cfg = parse(argc, argv);
+    std::cout << "on-sale burst: " << cfg.clients << " clients x "
+              << cfg.attempts << " BookSeats over " << cfg.channels << " channels\n";
+
+    auto direct = run(cfg, false);
+    report("direct", direct);
+
+    auto gated  = run(cfg, true);
+    report("waiting-room", gated);
+    return 0;
+}
+catch (const std::exception& e) {
+    std::cerr << "error: " << e.what() << '\n';
+    return 1;
+}
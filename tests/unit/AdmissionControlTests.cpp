@@ -0,0 +1,87 @@
+//  AdmissionControlTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the AIMD limiter + priority-aware admission controller of
+//  the gRPC layer (grpc/AdmissionControl.hpp).
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <vector>
+#include "AdmissionControl.hpp"
+
+using namespace std::chrono_literals;
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Limiter admits exactly `limit` concurrent calls
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("AIMD limiter caps concurrency")
+{
+    AimdLimiter lim{{4, 1, 16, 0.5, 1000us}};
+
+    for (int i = 0; i < 4; ++i) REQUIRE( lim.tryAcquire() );
+    REQUIRE_FALSE( lim.tryAcquire() );
+    REQUIRE( lim.inflight() == 4 );
+
+    lim.release(10us);
+    REQUIRE( lim.tryAcquire() );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Slow completion halves the limit, fast completions grow it again
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("AIMD limiter adapts to latency")
+{
+    AimdLimiter lim{{8, 2, 16, 0.5, 1000us}};
+
+    REQUIRE( lim.tryAcquire() );
+    lim.release(5ms);                              // above target -> back-off
+    REQUIRE( lim.limit() == 4.0 );
+    REQUIRE( lim.congested() );
+
+    // saturate and complete fast -> additive increase
+    for (int round = 0; round < 8; ++round) {
+        for (int i = 0; i < 4; ++i) REQUIRE( lim.tryAcquire() );
+        for (int i = 0; i < 4; ++i) lim.release(10us);
+    }
+    REQUIRE( lim.limit() > 4.0 );
+    REQUIRE( lim.limit() <= 16.0 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. Reads are shed while the write path is saturated, writes still admitted
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Writes have priority over reads")
+{
+    AdmissionController::Config cfg;
+    cfg.writes = {2, 1, 4, 0.9, 10ms};
+    AdmissionController ac{cfg};
+
+    std::vector<AdmissionController::Permit> held;
+    held.push_back(ac.admit(RpcKind::BookSeats, nullptr));
+    held.push_back(ac.admit(RpcKind::BookSeats, nullptr));
+    REQUIRE( held[0] );
+    REQUIRE( held[1] );
+
+    const auto read = ac.admit(RpcKind::ListFreeSeats, nullptr);
+    REQUIRE_FALSE( read );
+    REQUIRE( read.status().error_code() == grpc::StatusCode::RESOURCE_EXHAUSTED );
+
+    held.clear();                                  // fast completions
+    REQUIRE( ac.admit(RpcKind::ListFreeSeats, nullptr) );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4. Disabled controller never sheds
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Disabled admission admits everything")
+{
+    AdmissionController::Config cfg;
+    cfg.enabled = false;
+    cfg.writes  = {1, 1, 1, 0.9, 10ms};
+    AdmissionController ac{cfg};
+
+    std::vector<AdmissionController::Permit> held;
+    for (int i = 0; i < 10; ++i) {
+        held.push_back(ac.admit(RpcKind::BookSeats, nullptr));
+        REQUIRE( held.back() );
+    }
+}
@@ -7,13 +7,17 @@
 #define CATCH_CONFIG_MAIN
 #include <catch2/catch_test_macros.hpp>
 #include <atomic>
+#include <cstdint>
 #include <thread>
 #include <future>
+#include <stdexcept>
+#include "booking/domain/TheaterSlab.hpp"
 #include "booking/service/BookingManager.hpp"
 #include "booking/service/IBookingRepository.hpp"
 
 namespace booking::service {
     std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+    std::shared_ptr<IBookingRepository> makeInMemoryRepository(const domain::Theater::Rules& house);
 }
 
 // ────────────────────────────────────────────────────────────────────────────
@@ -118,3 +122,172 @@ TEST_CASE("Book all seats then reject")
     // Any further attempt must fail
     REQUIRE_FALSE( mgr.book(1,101,{{0,"A1"}}) );
 }
+
+// ────────────────────────────────────────────────────────────────────────────
+// 8. Quotes follow the seat tiers and do not depend on occupancy
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Quote sums tier prices")
+{
+    using namespace booking::domain;
+    booking::service::BookingManager mgr{booking::service::makeInMemoryRepository()};
+
+    // house layout: A1-A4 9.00, A5-A16 12.00, A17-A20 15.00
+    REQUIRE( mgr.quote(1, 101, {Seat::fromIndex(0)})  == 900u );
+    REQUIRE( mgr.quote(1, 101, {Seat::fromIndex(3), Seat::fromIndex(4), Seat::fromIndex(19)})
+             == 900u + 1200u + 1500u );
+    REQUIRE( mgr.book(1, 101, {Seat::fromIndex(19)}) );
+    REQUIRE( mgr.quote(1, 101, {Seat::fromIndex(19)}) == 1500u );   // taken, still priced
+
+    REQUIRE_FALSE( mgr.quote(1, 101, {{25, "A26"}}) );
+    REQUIRE_FALSE( mgr.quote(1, 999, {{0, "A1"}}) );
+
+    Theater::Pricing flat{};                           // every seat tier 0
+    flat.cents = {700, 0, 0, 0};
+    const Theater hall{7, "Flat", flat};
+    REQUIRE( hall.quote(Theater::SeatMask{0xFFFFF}) == 20u * 700u );
+    REQUIRE( hall.quote(Theater::SeatMask{0}) == 0u );
+
+    Theater::Pricing bad = Theater::Pricing::standard();
+    bad.tier[5] = Theater::kTiers;
+    REQUIRE_THROWS_AS( (Theater{8, "Bad", bad}), std::invalid_argument );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 9. Seating rules: wheelchair bays, distancing, no lone empty seats
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Seating rules refuse bookings inside the hall lock")
+{
+    using namespace booking::domain;
+    auto seat = [](std::uint8_t i) { return Seat::fromIndex(i); };
+
+    Theater::Rules rules;
+    rules.noSingleGaps = true;
+    rules.accessible   = Theater::SeatMask{1} << 19;          // A20
+    Theater hall{9, "Rules", Theater::Pricing::standard(), rules};
+    REQUIRE( hall.rules().noSingleGaps );
+    REQUIRE( hall.rules().accessible == (1u << 19) );
+
+    REQUIRE( hall.book({seat(19)}) == BookStatus::Accessible );
+    REQUIRE( hall.book({seat(19)}, /*accessible*/true) == BookStatus::Booked );
+    REQUIRE( hall.book({seat(4)}) == BookStatus::Booked );
+    REQUIRE( hall.book({seat(6)}) == BookStatus::SingleGap );        // strands A6
+    REQUIRE( hall.book({seat(6), seat(5)}) == BookStatus::Booked );
+    REQUIRE( hall.book({seat(0)}) == BookStatus::Booked );           // row end is no neighbour
+    REQUIRE( hall.book({seat(2)}) == BookStatus::SingleGap );        // strands A2 and A4
+    REQUIRE( hall.book({seat(4)}) == BookStatus::Taken );
+    REQUIRE( hall.book({{30, "A31"}}) == BookStatus::Invalid );
+    REQUIRE_FALSE( hall.tryBook({seat(2)}) );
+    REQUIRE( hall.freeSeats().size() == 15 );
+
+    // admits() is the same check without the lock or the state
+    Theater::Rules apart;
+    apart.buffer = 2;
+    const Theater spaced{10, "Spaced", Theater::Pricing::standard(), apart};
+    REQUIRE( spaced.admits(0b1, 0b100, false)   == BookStatus::Distancing );
+    REQUIRE( spaced.admits(0b1, 0b1000, false)  == BookStatus::Booked );
+    REQUIRE( spaced.admits(0b1, 0b1110, false)  == BookStatus::Distancing );
+    REQUIRE( spaced.admits(0, 0b111, false)     == BookStatus::Booked );   // one party
+    REQUIRE( Theater{11, "Open"}.admits(0b101, 0b10, false) == BookStatus::Booked );
+
+    Theater::Rules bad;
+    bad.accessible = Theater::SeatMask{1} << 25;
+    REQUIRE_THROWS_AS( (Theater{12, "Bad", Theater::Pricing::standard(), bad}), std::invalid_argument );
+
+    // the repository applies its house rules to every hall
+    Theater::Rules house;
+    house.buffer = 1;
+    booking::service::BookingManager mgr{booking::service::makeInMemoryRepository(house)};
+    REQUIRE( mgr.reserve(1, 101, {seat(0)}).status     == BookStatus::Booked );
+    REQUIRE( mgr.reserve(1, 101, {seat(1)}).status     == BookStatus::Distancing );
+    REQUIRE( mgr.reserve(1, 999, {seat(1)}).status == BookStatus::NotFound );
+    REQUIRE( mgr.book(1, 101, {seat(2)}) );
+    REQUIRE( mgr.addScreening(1, 103, "Hall3") == booking::service::CatalogStatus::Ok );
+    REQUIRE( mgr.reserve(1, 103, {seat(5)}).status == BookStatus::Booked );
+    REQUIRE( mgr.reserve(1, 103, {seat(6)}).status == BookStatus::Distancing );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 10. Sales counters per hall and per movie; movie totals outlive a hall
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Sales counters track bookings, conflicts and refusals")
+{
+    using namespace booking::domain;
+    auto seat = [](std::uint8_t i) { return Seat::fromIndex(i); };
+
+    Theater::Rules house;
+    house.buffer = 1;
+    booking::service::BookingManager mgr{booking::service::makeInMemoryRepository(house)};
+    const auto first = mgr.reserve(1, 101, {seat(0), seat(19)});
+    REQUIRE( first.status == BookStatus::Booked );
+    REQUIRE( first.totalCents == 2400 );                                  // 9.00 + 15.00
+    REQUIRE( mgr.reserve(1, 101, {seat(0)}).status     == BookStatus::Taken );
+    REQUIRE( mgr.reserve(1, 101, {seat(1)}).status     == BookStatus::Distancing );
+    REQUIRE( mgr.reserve(1, 101, {{30, "A31"}}).status == BookStatus::Invalid );    // not counted
+    REQUIRE( mgr.reserve(1, 102, {seat(8)}).status     == BookStatus::Booked );
+
+    auto all = mgr.sales();
+    REQUIRE( all.size() == 2 );
+    const auto& inter = all[0];
+    REQUIRE( inter.id == 1 );
+    REQUIRE( inter.halls.size() == 2 );
+    REQUIRE( inter.halls[0].first == 101 );
+    const Sales& h1 = inter.halls[0].second;
+    REQUIRE( h1.attempts == 3 );
+    REQUIRE( h1.bookings == 1 );
+    REQUIRE( h1.seatsSold == 2 );
+    REQUIRE( h1.conflicts == 1 );
+    REQUIRE( h1.refused == 1 );
+    REQUIRE( h1.revenueCents == 900u + 1500u );
+    REQUIRE( inter.total.bookings == 2 );
+    REQUIRE( inter.total.seatsSold == 3 );
+    REQUIRE( inter.total.revenueCents == 900u + 1500u + 1200u );
+    REQUIRE( all[1].total.attempts == 0 );
+
+    REQUIRE( mgr.retireScreening(1, 102) == booking::service::CatalogStatus::Ok );
+    const auto after = mgr.sales(1);
+    REQUIRE( after.size() == 1 );
+    REQUIRE( after[0].halls.size() == 1 );
+    REQUIRE( after[0].total.seatsSold == 3 );
+    REQUIRE( mgr.sales(99).empty() );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 11. Halls come from line-aligned slab blocks, recycled once released
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Theater slab hands out line-aligned halls and recycles them")
+{
+    using namespace booking::domain;
+    const auto addr = [](const void* p) { return reinterpret_cast<std::uintptr_t>(p); };
+
+    std::shared_ptr<Theater> survivor;
+    {
+        TheaterSlab slab{4};
+        std::vector<std::shared_ptr<Theater>> halls;
+        for (Theater::Id i = 1; i <= 5; ++i) halls.push_back(slab.make(i, "Hall" + std::to_string(i)));
+        REQUIRE( slab.live() == 5 );
+        REQUIRE( slab.slabs() == 2 );
+        REQUIRE( slab.blockSize() % Theater::kCacheLine == 0 );
+        REQUIRE( slab.blockSize() >= sizeof(Theater) );
+        for (std::size_t i = 0; i < halls.size(); ++i) {
+            REQUIRE( addr(halls[i].get()) % Theater::kCacheLine == 0 );
+            for (std::size_t j = 0; j < i; ++j) {               // no line in common
+                const auto a = addr(halls[i].get()), b = addr(halls[j].get());
+                REQUIRE( (a > b ? a - b : b - a) >= sizeof(Theater) );
+            }
+        }
+
+        REQUIRE( halls[2]->tryBook({Seat::fromIndex(3)}) );
+        survivor = halls[2];
+        halls.clear();
+        REQUIRE( slab.live() == 1 );
+        for (Theater::Id i = 6; i <= 9; ++i) halls.push_back(slab.make(i, "Hall" + std::to_string(i)));
+        REQUIRE( slab.slabs() == 2 );                            // freed blocks reused
+        REQUIRE( slab.live() == 5 );
+    }
+    REQUIRE( survivor->id() == 3 );                              // outlives its slab
+    REQUIRE( survivor->freeSeats().size() == Theater::kCapacity - 1 );
+
+    const auto repo = booking::service::makeInMemoryRepository();
+    for (const auto& hall : repo->theaters(1))
+        REQUIRE( addr(hall.get()) % Theater::kCacheLine == 0 );
+}
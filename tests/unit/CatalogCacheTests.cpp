@@ -0,0 +1,164 @@
+//  CatalogCacheTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the catalog version feed (grpc/CatalogFeed.hpp) and the
+//  client-side catalog cache (transport/CatalogCache.hpp) against an
+//  in-process server.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <grpcpp/server_builder.h>
+#include "BookingAdminImpl.hpp"
+#include "BookingServiceImpl.hpp"
+#include "booking/service/IBookingRepository.hpp"
+#include "transport/CatalogCache.hpp"
+#include "transport/ChannelFactory.hpp"
+
+namespace booking::service {
+    std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+using namespace std::chrono_literals;
+using booking::domain::Movie;
+using booking::domain::Seat;
+using booking::domain::Theater;
+using booking::service::CatalogStatus;
+
+namespace {
+/// In-memory repository that counts catalog reads.
+class CountingRepository final : public booking::service::IBookingRepository
+{
+public:
+    mutable std::atomic<int> reads{0};
+
+    std::vector<Movie> movies() const override { ++reads; return inner_->movies(); }
+    std::vector<std::shared_ptr<const Theater>> theaters(Movie::Id m) const override { ++reads; return inner_->theaters(m); }
+    std::vector<Seat> freeSeats(Movie::Id m, Theater::Id t) const override { return inner_->freeSeats(m, t); }
+    bool book(Movie::Id m, Theater::Id t, const std::vector<Seat>& s) override { return inner_->book(m, t, s); }
+    CatalogStatus addMovie(Movie mv) override { return inner_->addMovie(std::move(mv)); }
+    CatalogStatus addScreening(Movie::Id m, Theater::Id t, std::string n) override { return inner_->addScreening(m, t, std::move(n)); }
+    CatalogStatus retireScreening(Movie::Id m, Theater::Id t) override { return inner_->retireScreening(m, t); }
+
+private:
+    std::shared_ptr<IBookingRepository> inner_ = booking::service::makeInMemoryRepository();
+};
+
+struct Server {
+    std::shared_ptr<CountingRepository> repo = std::make_shared<CountingRepository>();
+    std::shared_ptr<booking::service::BookingManager> mgr =
+        std::make_shared<booking::service::BookingManager>(repo);
+    std::shared_ptr<CatalogFeed>        feed = std::make_shared<CatalogFeed>();
+    BookingServiceImpl                  svc{mgr, {{}, nullptr, nullptr, feed}};
+    BookingAdminImpl                    admin{mgr, nullptr, feed};
+    int                                 port = 0;
+    std::unique_ptr<grpc::Server>       server;
+
+    Server()
+    {
+        grpc::ServerBuilder b;
+        b.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+        b.RegisterService(&svc);
+        b.RegisterService(&admin);
+        server = b.BuildAndStart();
+    }
+    ~Server()
+    {
+        feed->close();
+        server->Shutdown();
+    }
+};
+
+/// Poll @p pred for up to 2 s.
+template <class Pred>
+bool eventually(Pred pred)
+{
+    for (int i = 0; i < 200 && !pred(); ++i) std::this_thread::sleep_for(10ms);
+    return pred();
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Feed: versions only move on applied changes and reach every watcher
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("CatalogFeed stamps replies and streams version bumps")
+{
+    Server srv;
+    REQUIRE( srv.server );
+    auto stub  = booking::Booking::NewStub(transport::makeNetworkChannel("127.0.0.1", srv.port));
+    auto admin = booking::BookingAdmin::NewStub(transport::makeNetworkChannel("127.0.0.1", srv.port));
+
+    grpc::ClientContext lctx;
+    booking::MovieList movies;
+    REQUIRE( stub->ListMovies(&lctx, booking::ListMoviesReq{}, &movies).ok() );
+    REQUIRE( movies.catalog_version() == 1 );
+
+    grpc::ClientContext wctx;
+    auto reader = stub->WatchCatalog(&wctx, booking::Empty{});
+    booking::CatalogVersion v;
+    REQUIRE( reader->Read(&v) );                       // current version first
+    REQUIRE( v.version() == 1 );
+    REQUIRE( eventually([&] { return srv.feed->watchers() == 1; }) );
+
+    booking::Movie dup;                                // rejected -> no bump
+    dup.set_id(1);
+    grpc::ClientContext dctx;
+    booking::Empty none;
+    REQUIRE( admin->AddMovie(&dctx, dup, &none).error_code() == grpc::StatusCode::ALREADY_EXISTS );
+
+    booking::ScreeningReq add;
+    add.set_movie_id(1);
+    add.set_theater_id(777);
+    add.set_name("Hall-777");
+    grpc::ClientContext actx;
+    REQUIRE( admin->AddScreening(&actx, add, &none).ok() );
+    REQUIRE( reader->Read(&v) );
+    REQUIRE( v.version() == 2 );
+
+    wctx.TryCancel();
+    reader->Finish();
+    REQUIRE( eventually([&] { return srv.feed->watchers() == 0; }) );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Cache: repeat reads stay local until the catalog changes
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("CatalogCache serves repeats locally and refetches after a change")
+{
+    Server srv;
+    auto channel = transport::makeNetworkChannel("127.0.0.1", srv.port);
+    auto admin   = booking::BookingAdmin::NewStub(channel);
+
+    transport::CatalogCache cache{channel};
+    REQUIRE( cache.waitLive(2s) );
+
+    booking::MovieList movies;
+    booking::TheaterList theaters;
+    REQUIRE( cache.movies(&movies).ok() );
+    REQUIRE( cache.theaters(1, &theaters).ok() );
+    const int cold = srv.repo->reads.load();
+
+    for (int i = 0; i < 50; ++i) {
+        REQUIRE( cache.movies(&movies).ok() );
+        REQUIRE( cache.theaters(1, &theaters).ok() );
+    }
+    REQUIRE( srv.repo->reads.load() == cold );
+    REQUIRE( cache.stats().hits == 100 );
+    REQUIRE( movies.movies_size() == 2 );
+
+    booking::TheaterList unknown;                      // errors pass through
+    REQUIRE( cache.theaters(99, &unknown).error_code() == grpc::StatusCode::NOT_FOUND );
+
+    booking::Movie dune;
+    dune.set_id(3);
+    dune.set_title("Dune");
+    grpc::ClientContext actx;
+    booking::Empty none;
+    REQUIRE( admin->AddMovie(&actx, dune, &none).ok() );
+    REQUIRE( eventually([&] { return cache.version() == 2; }) );
+
+    REQUIRE( cache.movies(&movies).ok() );
+    REQUIRE( movies.movies_size() == 3 );
+    REQUIRE( cache.movies(&movies).ok() );             // cached again
+    REQUIRE( srv.repo->reads.load() == cold + 3 );     // NOT_FOUND probe (2) + refetch
+}
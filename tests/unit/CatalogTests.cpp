@@ -0,0 +1,182 @@
+//  CatalogTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for live catalog maintenance (AddMovie / AddScreening /
+//  RetireScreening) on the in-memory repository.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "booking/domain/StringArena.hpp"
+#include "booking/service/BookingManager.hpp"
+#include "booking/service/IBookingRepository.hpp"
+
+namespace booking::service {
+    std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+using booking::service::BookingManager;
+using booking::service::CatalogStatus;
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. A new movie + screening becomes bookable immediately
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Catalog: add movie and screening")
+{
+    BookingManager mgr{booking::service::makeInMemoryRepository()};
+
+    REQUIRE( mgr.addMovie({3, "Dune", "Part Two"}) == CatalogStatus::Ok );
+    REQUIRE( mgr.movies().size() == 3 );
+    REQUIRE( mgr.theaters(3).empty() );
+
+    REQUIRE( mgr.addScreening(3, 301, "CinemaC-Hall1") == CatalogStatus::Ok );
+    REQUIRE( mgr.theaters(3).size() == 1 );
+    REQUIRE( mgr.theaters(3).front()->name() == "CinemaC-Hall1" );
+    REQUIRE( mgr.freeSeats(3, 301).size() == booking::domain::Theater::kCapacity );
+    REQUIRE( mgr.book(3, 301, {{0, "A1"}}) );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Conflicts and invalid input are reported, catalog unchanged
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Catalog: error outcomes")
+{
+    BookingManager mgr{booking::service::makeInMemoryRepository()};
+
+    REQUIRE( mgr.addMovie({1, "Duplicate"}) == CatalogStatus::AlreadyExists );
+    REQUIRE( mgr.addMovie({0, "No id"})     == CatalogStatus::Invalid );
+    REQUIRE( mgr.movies().size() == 2 );
+
+    REQUIRE( mgr.addScreening(9, 901, "x") == CatalogStatus::NotFound );
+    REQUIRE( mgr.addScreening(1, 101, "x") == CatalogStatus::AlreadyExists );
+    REQUIRE( mgr.addScreening(1, 0,   "x") == CatalogStatus::Invalid );
+
+    REQUIRE( mgr.retireScreening(1, 999) == CatalogStatus::NotFound );
+    REQUIRE( mgr.retireScreening(9, 101) == CatalogStatus::NotFound );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. Existing seat state survives catalog updates; retired halls reject
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Catalog: updates keep bookings, retire removes the hall")
+{
+    BookingManager mgr{booking::service::makeInMemoryRepository()};
+
+    REQUIRE( mgr.book(1, 101, {{4, "A5"}}) );
+    REQUIRE( mgr.addMovie({3, "Dune"}) == CatalogStatus::Ok );
+    REQUIRE( mgr.addScreening(1, 103, "CinemaA-Hall3") == CatalogStatus::Ok );
+    REQUIRE_FALSE( mgr.book(1, 101, {{4, "A5"}}) );          // still taken
+
+    REQUIRE( mgr.retireScreening(1, 102) == CatalogStatus::Ok );
+    REQUIRE( mgr.theaters(1).size() == 2 );
+    REQUIRE_FALSE( mgr.book(1, 102, {{0, "A1"}}) );
+    REQUIRE( mgr.book(1, 103, {{0, "A1"}}) );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4. Bookings keep flowing while the catalog churns
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Catalog: concurrent updates never lose or duplicate bookings")
+{
+    BookingManager mgr{booking::service::makeInMemoryRepository()};
+    std::atomic<bool> stop{false};
+    std::atomic<int>  wins{0}, errors{0};       // Catch2 asserts are main-thread only
+
+    std::thread churn([&] {
+        for (booking::domain::Theater::Id t = 1000; !stop.load(); ++t) {
+            if (mgr.addScreening(2, t, "pop-up") != CatalogStatus::Ok) ++errors;
+            if (mgr.retireScreening(2, t)        != CatalogStatus::Ok) ++errors;
+        }
+    });
+
+    std::vector<std::thread> bookers;
+    for (int i = 0; i < 4; ++i)
+        bookers.emplace_back([&] {
+            for (std::uint8_t s = 0; s < booking::domain::Theater::kCapacity; ++s) {
+                if (mgr.book(1, 101, {{s, "X"}})) ++wins;
+                if (mgr.theaters(1).size() != 2) ++errors;
+            }
+        });
+
+    for (auto& t : bookers) t.join();
+    stop = true;
+    churn.join();
+
+    REQUIRE( errors == 0 );
+    REQUIRE( wins == static_cast<int>(booking::domain::Theater::kCapacity) );
+    REQUIRE( mgr.freeSeats(1, 101).empty() );
+    REQUIRE( mgr.theaters(2).size() == 1 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 5. Keyset pages walk the catalog in id order, even across inserts
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Catalog: paged listings")
+{
+    BookingManager mgr{booking::service::makeInMemoryRepository()};
+    for (booking::domain::Movie::Id m : {40u, 10u, 30u}) {
+        const auto title = "M" + std::to_string(m);
+        REQUIRE( mgr.addMovie({m, title}) == CatalogStatus::Ok );
+    }
+
+    auto page = mgr.moviesPage(0, 2);                       // ids 1 2 10 30 40
+    REQUIRE( page.items.size() == 2 );
+    REQUIRE( page.items[1].id() == 2 );
+    REQUIRE( page.more );
+
+    REQUIRE( mgr.addMovie({20, "M20"}) == CatalogStatus::Ok );   // lands after the cursor
+    page = mgr.moviesPage(page.items.back().id(), 3);
+    REQUIRE( page.items.size() == 3 );
+    REQUIRE( page.items[0].id() == 10 );
+    REQUIRE( page.items[1].id() == 20 );
+    REQUIRE( page.more );
+    page = mgr.moviesPage(page.items.back().id(), 3);
+    REQUIRE( page.items.size() == 1 );
+    REQUIRE_FALSE( page.more );
+
+    const auto halls = mgr.theatersPage(1, 101, 10);
+    REQUIRE( halls );
+    REQUIRE( halls->items.size() == 1 );
+    REQUIRE( halls->items[0]->id() == 102 );
+    REQUIRE( mgr.theatersPage(10, 0, 10)->items.empty() );      // no screenings yet
+    REQUIRE_FALSE( mgr.theatersPage(99, 0, 10) );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 6. Movie text lives in the repository's arena, not the caller's strings
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Catalog: movie text is interned")
+{
+    using booking::domain::Movie;
+    using booking::domain::StringArena;
+    static_assert(std::is_trivially_copyable_v<Movie>);
+    static_assert(sizeof(Movie) <= 32);
+    static_assert(!std::is_constructible_v<Movie, Movie::Id, std::string>);   // would dangle
+    static_assert(!std::is_constructible_v<Movie, Movie::Id, const std::string&, std::string>);
+    static_assert(std::is_constructible_v<Movie, Movie::Id, const std::string&>);
+
+    StringArena arena{256};
+    const auto a = arena.intern("Dune");
+    REQUIRE( arena.intern(std::string{"Dune"}).data() == a.data() );   // stored once
+    REQUIRE( arena.intern("").empty() );
+    const std::string big(1000, 'x');                     // longer than a chunk
+    REQUIRE( arena.intern(big) == big );
+    REQUIRE( arena.intern("Heat") == "Heat" );
+    REQUIRE( a == "Dune" );
+    REQUIRE( arena.strings() == 3 );
+    REQUIRE( arena.used() == 4 + 1000 + 4 );
+
+    BookingManager mgr{booking::service::makeInMemoryRepository()};
+    {
+        std::string title = "Blade Runner", synopsis(300, 's');
+        REQUIRE( mgr.addMovie({3, title, synopsis}) == CatalogStatus::Ok );
+        title.assign(title.size(), '?');                  // caller reuses its buffers
+        synopsis.clear();
+    }
+    const auto movies = mgr.searchMovies("blade", 5);
+    REQUIRE( movies.size() == 1 );
+    REQUIRE( movies[0].title() == "Blade Runner" );
+    REQUIRE( movies[0].desc() == std::string(300, 's') );
+}
@@ -0,0 +1,154 @@
+//  ChannelPoolTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the pooled channel helpers and hedged reads
+//  (transport/ChannelFactory.hpp) against an in-process server.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <grpcpp/server_builder.h>
+#include "BookingServiceImpl.hpp"
+#include "booking/service/IBookingRepository.hpp"
+#include "transport/ChannelFactory.hpp"
+
+namespace booking::service {
+    std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+using namespace std::chrono_literals;
+using booking::domain::Movie;
+using booking::domain::Seat;
+using booking::domain::Theater;
+using booking::service::CatalogStatus;
+
+namespace {
+/// In-memory repository whose next `stalls` freeSeats() calls sleep 500 ms.
+class SlowRepository final : public booking::service::IBookingRepository
+{
+public:
+    mutable std::atomic<int> stalls{0};
+
+    std::vector<Movie> movies() const override { return inner_->movies(); }
+    std::vector<std::shared_ptr<const Theater>> theaters(Movie::Id m) const override { return inner_->theaters(m); }
+    std::vector<Seat> freeSeats(Movie::Id m, Theater::Id t) const override
+    {
+        if (stalls.fetch_sub(1) > 0) std::this_thread::sleep_for(500ms);
+        return inner_->freeSeats(m, t);
+    }
+    bool book(Movie::Id m, Theater::Id t, const std::vector<Seat>& s) override { return inner_->book(m, t, s); }
+    CatalogStatus addMovie(Movie mv) override { return inner_->addMovie(std::move(mv)); }
+    CatalogStatus addScreening(Movie::Id m, Theater::Id t, std::string n) override { return inner_->addScreening(m, t, std::move(n)); }
+    CatalogStatus retireScreening(Movie::Id m, Theater::Id t) override { return inner_->retireScreening(m, t); }
+
+private:
+    std::shared_ptr<IBookingRepository> inner_ = booking::service::makeInMemoryRepository();
+};
+
+struct Server {
+    std::shared_ptr<SlowRepository> repo = std::make_shared<SlowRepository>();
+    BookingServiceImpl              svc{std::make_shared<booking::service::BookingManager>(repo), {}};
+    int                             port = 0;
+    std::unique_ptr<grpc::Server>   server;
+
+    Server()
+    {
+        grpc::ServerBuilder b;
+        b.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+        b.RegisterService(&svc);
+        server = b.BuildAndStart();
+    }
+    ~Server() { server->Shutdown(); }
+};
+
+booking::TheaterReq hall(std::uint32_t m, std::uint32_t t)
+{
+    booking::TheaterReq r;
+    r.set_movie_id(m);
+    r.set_theater_id(t);
+    return r;
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Pool hands out its connections round-robin; reads work with retries on
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("ChannelPool round-robins over distinct channels")
+{
+    Server srv;
+    REQUIRE( srv.server );
+
+    const auto pool = transport::makeChannelPool("127.0.0.1", srv.port, {3});
+    REQUIRE( pool.size() == 3 );
+    const auto a = pool.next(), b = pool.next(), c = pool.next();
+    REQUIRE( a != b );
+    REQUIRE( b != c );
+    REQUIRE( pool.next() == a );
+
+    REQUIRE( transport::readRetryServiceConfig().find("\"method\":\"ListFreeSeats\"") != std::string::npos );
+    REQUIRE( transport::readRetryServiceConfig().find("BookSeats") == std::string::npos );
+
+    for (const auto& stub : pool.stubs<booking::Booking>()) {
+        grpc::ClientContext ctx;
+        booking::MovieList movies;
+        REQUIRE( stub->ListMovies(&ctx, booking::ListMoviesReq{}, &movies).ok() );
+        REQUIRE( movies.movies_size() == 2 );
+    }
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Hedge budget earns a fraction of a token per call
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("HedgeBudget limits hedges to a share of calls")
+{
+    transport::HedgeBudget budget{0.25, 1};
+    REQUIRE( budget.spend() );                     // starts full (burst 1)
+    REQUIRE_FALSE( budget.spend() );
+
+    for (int i = 0; i < 3; ++i) budget.earn();
+    REQUIRE_FALSE( budget.spend() );
+    budget.earn();
+    REQUIRE( budget.spend() );
+
+    for (int i = 0; i < 100; ++i) budget.earn();   // capped at burst
+    REQUIRE( budget.spend() );
+    REQUIRE_FALSE( budget.spend() );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. A stalled attempt is overtaken by the hedge; final errors pass through
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("hedgedCall answers from the backup attempt when the first stalls")
+{
+    Server srv;
+    const auto pool  = transport::makeChannelPool("127.0.0.1", srv.port, {2});
+    const auto stubs = pool.stubs<booking::Booking>();
+
+    transport::HedgePolicy policy;
+    policy.delay = 20ms;
+
+    srv.repo->stalls = 1;
+    booking::SeatList seats;
+    const auto t0 = std::chrono::steady_clock::now();
+    const auto st = transport::hedgedCall(stubs, 0, &booking::Booking::Stub::AsyncListFreeSeats,
+                                          hall(1, 101), &seats, policy);
+    REQUIRE( st.ok() );
+    REQUIRE( seats.seats_size() == static_cast<int>(Theater::kCapacity) );
+    REQUIRE( std::chrono::steady_clock::now() - t0 < 400ms );
+
+    // without a hedge the caller waits the stall out
+    srv.repo->stalls = 1;
+    transport::HedgeBudget empty{0, 0};
+    policy.budget = &empty;
+    const auto t1 = std::chrono::steady_clock::now();
+    REQUIRE( transport::hedgedCall(stubs, 0, &booking::Booking::Stub::AsyncListFreeSeats,
+                                   hall(1, 101), &seats, policy).ok() );
+    REQUIRE( std::chrono::steady_clock::now() - t1 >= 500ms );
+
+    booking::ListTheatersReq unknown;
+    unknown.set_movie_id(99);
+    booking::TheaterList theaters;
+    REQUIRE( transport::hedgedCall(stubs, 1, &booking::Booking::Stub::AsyncListTheaters,
+                                   unknown, &theaters, policy).error_code()
+             == grpc::StatusCode::NOT_FOUND );
+}
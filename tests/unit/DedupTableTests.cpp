@@ -0,0 +1,112 @@
+//  DedupTableTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the BookSeats idempotency table (grpc/DedupTable.hpp) and
+//  idempotent retries through the service.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <string>
+#include <thread>
+#include "DedupTable.hpp"
+#include "EmbeddedServer.hpp"
+
+using namespace std::chrono_literals;
+using booking::domain::BookStatus;
+using Claim = DedupTable::Claim;
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Claim -> complete -> replay, per key and request fingerprint
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("DedupTable replays the first outcome of a key")
+{
+    DedupTable table;
+
+    REQUIRE( table.claim("k1", 7).claim == Claim::Fresh );
+    REQUIRE( table.claim("k1", 7).claim == Claim::InFlight );
+    REQUIRE( table.claim("k1", 8).claim == Claim::Mismatch );
+    table.complete("k1", {BookStatus::Booked, 1200});
+
+    const auto hit = table.claim("k1", 7);
+    REQUIRE( hit.claim == Claim::Replay );
+    REQUIRE( hit.outcome.status == BookStatus::Booked );
+    REQUIRE( hit.outcome.totalCents == 1200 );
+    REQUIRE( table.claim("k1", 8).claim == Claim::Mismatch );
+
+    REQUIRE( table.claim("k2", 7).claim == Claim::Fresh );   // abandoned: next call books
+    table.abandon("k2");
+    REQUIRE( table.claim("k2", 7).claim == Claim::Fresh );
+    REQUIRE( table.size() == 2 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Bounded: CLOCK eviction keeps replayed keys, TTL expires the rest
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("DedupTable stays within capacity")
+{
+    DedupTable::Config cfg;
+    cfg.capacity = 64;                                   // 4 slots per shard
+    cfg.ttl      = 1s;
+    DedupTable table{cfg};
+    REQUIRE( table.capacity() == 64 );
+
+    for (int i = 0; i < 1000; ++i) {
+        const auto key = "key-" + std::to_string(i);
+        REQUIRE( table.claim(key, 1).claim == Claim::Fresh );
+        table.complete(key, {BookStatus::Taken, 0});
+        if (i % 2 == 0)                                  // keep key-0 hot
+            REQUIRE( table.claim("key-0", 1).claim == Claim::Replay );
+    }
+    REQUIRE( table.size() <= table.capacity() );
+    REQUIRE( table.claim("key-0", 1).claim == Claim::Replay );
+    REQUIRE( table.claim("key-1", 1).claim == Claim::Fresh );   // long evicted
+
+    DedupTable::Config shortLived;
+    shortLived.ttl = std::chrono::seconds{0};
+    DedupTable expiring{shortLived};
+    REQUIRE( expiring.claim("k", 1).claim == Claim::Fresh );
+    expiring.complete("k", {BookStatus::Booked, 900});
+    std::this_thread::sleep_for(1ms);
+    REQUIRE( expiring.claim("k", 1).claim == Claim::Fresh );
+
+    DedupTable::Config tiny;                             // every slot in flight
+    tiny.capacity = 1;
+    DedupTable full{tiny};
+    for (int i = 0; i < 16; ++i) (void)full.claim("p" + std::to_string(i), 1);
+    bool untracked = false;
+    for (int i = 16; i < 64 && !untracked; ++i)
+        untracked = full.claim("p" + std::to_string(i), 1).claim == Claim::Untracked;
+    REQUIRE( untracked );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. A retried BookSeats gets the original reply instead of ALREADY_EXISTS
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("BookSeats retries with an idempotency key are replayed")
+{
+    EmbeddedOptions opts;
+    opts.service.dedup = std::make_shared<DedupTable>();
+    EmbeddedServer server{opts};
+    auto stub = booking::Booking::NewStub(server.channel());
+
+    booking::BookingReq req;
+    req.set_movie_id(1);
+    req.set_theater_id(101);
+    auto* seat = req.add_seats();
+    seat->set_index(4);
+    seat->set_label("A5");
+    req.set_idempotency_key("order-42");
+
+    booking::BookingRep first, retry;
+    grpc::ClientContext c1, c2, c3, c4;
+    REQUIRE( stub->BookSeats(&c1, req, &first).ok() );
+    REQUIRE( stub->BookSeats(&c2, req, &retry).ok() );
+    REQUIRE( retry.success() );
+    REQUIRE( retry.total_cents() == first.total_cents() );
+
+    req.set_idempotency_key("order-43");                // another client, same seat
+    REQUIRE( stub->BookSeats(&c3, req, &retry).error_code() == grpc::StatusCode::ALREADY_EXISTS );
+
+    req.set_idempotency_key("order-42");                // key reused for other seats
+    req.mutable_seats(0)->set_index(5);
+    REQUIRE( stub->BookSeats(&c4, req, &retry).error_code() == grpc::StatusCode::INVALID_ARGUMENT );
+}
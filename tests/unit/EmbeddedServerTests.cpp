@@ -0,0 +1,207 @@
+//  EmbeddedServerTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the embedding API (grpc/EmbeddedServer.hpp) and the
+//  in-process channel (transport::makeInProcessChannel).
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include "EmbeddedServer.hpp"
+#include "transport/ChannelFactory.hpp"
+#include <string>
+#include <vector>
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. In-process calls reach the embedded service, socket listeners share it
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("EmbeddedServer serves in-process and TCP clients from one manager")
+{
+    EmbeddedOptions opts;
+    opts.tcp = "127.0.0.1:0";
+    EmbeddedServer server{opts};
+    REQUIRE( server.tcpPort() > 0 );
+
+    auto local  = booking::Booking::NewStub(server.channel());
+    auto remote = booking::Booking::NewStub(transport::makeNetworkChannel("127.0.0.1", server.tcpPort()));
+
+    grpc::ClientContext lctx;
+    booking::MovieList movies;
+    REQUIRE( local->ListMovies(&lctx, booking::ListMoviesReq{}, &movies).ok() );
+    REQUIRE( movies.movies_size() == 2 );
+    REQUIRE( movies.catalog_version() == 1 );          // feed created by default
+
+    booking::BookingReq req;
+    req.set_movie_id(1);
+    req.set_theater_id(101);
+    auto* seat = req.add_seats();
+    seat->set_index(0);
+    seat->set_label("A1");
+    booking::BookingRep rep;
+    grpc::ClientContext bctx;
+    REQUIRE( local->BookSeats(&bctx, req, &rep).ok() );
+    REQUIRE( rep.total_cents() == 900 );               // front tier
+
+    grpc::ClientContext rctx;                          // same hall seen over TCP
+    REQUIRE( remote->BookSeats(&rctx, req, &rep).error_code() == grpc::StatusCode::ALREADY_EXISTS );
+
+    auto admin = booking::BookingAdmin::NewStub(server.adminChannel());
+    booking::Movie dune;
+    dune.set_id(3);
+    dune.set_title("Dune");
+    booking::Empty none;
+    grpc::ClientContext actx;
+    REQUIRE( admin->AddMovie(&actx, dune, &none).ok() );
+    REQUIRE( server.manager()->movies().size() == 3 );
+
+    auto exposed = booking::BookingAdmin::NewStub(  // catalog changes stay off the socket
+        transport::makeNetworkChannel("127.0.0.1", server.tcpPort()));
+    booking::TheaterReq retire;
+    retire.set_movie_id(1);
+    retire.set_theater_id(101);
+    grpc::ClientContext xctx;
+    REQUIRE( exposed->RetireScreening(&xctx, retire, &none).error_code() == grpc::StatusCode::UNIMPLEMENTED );
+    REQUIRE( server.manager()->theaters(1).size() == 2 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. QuotePrice prices a selection without booking it
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("QuotePrice returns the total BookSeats will charge")
+{
+    EmbeddedServer server;
+    auto stub = booking::Booking::NewStub(server.channel());
+
+    booking::BookingReq req;
+    req.set_movie_id(2);
+    req.set_theater_id(201);
+    for (std::uint32_t i : {4u, 5u, 17u}) {
+        auto* seat = req.add_seats();
+        seat->set_index(i);
+        seat->set_label("A" + std::to_string(i + 1));
+    }
+
+    booking::PriceQuote quote;
+    grpc::ClientContext qctx;
+    REQUIRE( stub->QuotePrice(&qctx, req, &quote).ok() );
+    REQUIRE( quote.total_cents() == 1200 + 1200 + 1500 );
+    REQUIRE( server.manager()->freeSeats(2, 201).size() == 20 );   // nothing booked
+
+    booking::BookingRep rep;
+    grpc::ClientContext bctx;
+    REQUIRE( stub->BookSeats(&bctx, req, &rep).ok() );
+    REQUIRE( rep.total_cents() == quote.total_cents() );
+
+    req.mutable_seats(0)->set_index(20);
+    grpc::ClientContext ictx;
+    REQUIRE( stub->QuotePrice(&ictx, req, &quote).error_code() == grpc::StatusCode::INVALID_ARGUMENT );
+    req.mutable_seats(0)->set_index(0);
+    req.set_theater_id(999);
+    grpc::ClientContext nctx;
+    REQUIRE( stub->QuotePrice(&nctx, req, &quote).error_code() == grpc::StatusCode::NOT_FOUND );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. Catalog listings page with opaque tokens and honour field masks
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("ListMovies / ListTheaters page and mask fields")
+{
+    EmbeddedServer server;
+    const std::string synopsis(200, 'x');
+    for (std::uint32_t m = 3; m <= 7; ++m) {
+        const auto title = "Movie " + std::to_string(m);
+        server.manager()->addMovie({m, title, synopsis});
+    }
+    auto stub = booking::Booking::NewStub(server.channel());
+
+    booking::ListMoviesReq req;
+    req.set_page_size(3);
+    req.add_fields("title");
+    std::vector<std::uint32_t> seen;
+    int pages = 0;
+    do {
+        grpc::ClientContext ctx;
+        booking::MovieList page;
+        REQUIRE( stub->ListMovies(&ctx, req, &page).ok() );
+        for (const auto& m : page.movies()) {
+            seen.push_back(m.id());
+            REQUIRE( !m.title().empty() );
+            REQUIRE( m.description().empty() );                 // masked out
+        }
+        req.set_page_token(page.next_page_token());
+        ++pages;
+    } while (!req.page_token().empty());
+    REQUIRE( pages == 3 );
+    REQUIRE( seen == std::vector<std::uint32_t>{1, 2, 3, 4, 5, 6, 7} );
+
+    booking::ListTheatersReq treq;
+    treq.set_movie_id(1);
+    treq.set_page_size(1);
+    treq.add_fields("id");
+    booking::TheaterList halls;
+    grpc::ClientContext tctx;
+    REQUIRE( stub->ListTheaters(&tctx, treq, &halls).ok() );
+    REQUIRE( halls.theaters_size() == 1 );
+    REQUIRE( halls.theaters(0).name().empty() );
+    REQUIRE_FALSE( halls.next_page_token().empty() );
+
+    treq.set_movie_id(2);                                       // token belongs to movie 1
+    treq.set_page_token(halls.next_page_token());
+    grpc::ClientContext xctx;
+    REQUIRE( stub->ListTheaters(&xctx, treq, &halls).error_code() == grpc::StatusCode::INVALID_ARGUMENT );
+
+    req.clear_page_token();
+    req.add_fields("rating");
+    grpc::ClientContext mctx;
+    booking::MovieList none;
+    REQUIRE( stub->ListMovies(&mctx, req, &none).error_code() == grpc::StatusCode::INVALID_ARGUMENT );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4. GetStats / WatchStats report sales without touching the seat maps
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("GetStats and WatchStats report per-hall sales")
+{
+    EmbeddedServer server;
+    auto stub  = booking::Booking::NewStub(server.channel());
+    auto admin = booking::BookingAdmin::NewStub(server.adminChannel());
+
+    booking::BookingReq req;
+    req.set_movie_id(1);
+    req.set_theater_id(102);
+    auto* seat = req.add_seats();
+    seat->set_index(10);
+    seat->set_label("A11");
+    booking::BookingRep rep;
+    grpc::ClientContext b1, b2;
+    REQUIRE( stub->BookSeats(&b1, req, &rep).ok() );
+    REQUIRE( stub->BookSeats(&b2, req, &rep).error_code() == grpc::StatusCode::ALREADY_EXISTS );
+
+    booking::StatsReq sreq;
+    sreq.set_movie_id(1);
+    booking::Stats stats;
+    grpc::ClientContext sctx;
+    REQUIRE( admin->GetStats(&sctx, sreq, &stats).ok() );
+    REQUIRE( stats.movies_size() == 1 );
+    REQUIRE( stats.movies(0).halls_size() == 2 );
+    const auto& hall = stats.movies(0).halls(1);
+    REQUIRE( hall.theater_id() == 102 );
+    REQUIRE( hall.capacity() == 20 );
+    REQUIRE( hall.sales().bookings() == 1 );
+    REQUIRE( hall.sales().conflicts() == 1 );
+    REQUIRE( stats.total().revenue_cents() == 1200 );
+
+    sreq.set_movie_id(99);
+    grpc::ClientContext nctx;
+    REQUIRE( admin->GetStats(&nctx, sreq, &stats).error_code() == grpc::StatusCode::NOT_FOUND );
+
+    sreq.set_movie_id(0);
+    sreq.set_interval_ms(50);
+    grpc::ClientContext wctx;
+    auto reader = admin->WatchStats(&wctx, sreq);
+    booking::Stats pushed;
+    REQUIRE( reader->Read(&pushed) );
+    REQUIRE( pushed.movies_size() == 2 );
+    REQUIRE( pushed.total().seats_sold() == 1 );
+    REQUIRE( reader->Read(&pushed) );                           // next tick
+    wctx.TryCancel();
+    while (reader->Read(&pushed)) {}
+    REQUIRE( reader->Finish().error_code() == grpc::StatusCode::CANCELLED );
+}
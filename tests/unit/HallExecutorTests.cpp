@@ -0,0 +1,118 @@
+//  HallExecutorTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for thread-per-core hall ownership
+//  (booking/service/HallExecutor.hpp) and BookingManager routing through it.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include "booking/service/BookingManager.hpp"
+#include "booking/service/HallExecutor.hpp"
+
+namespace booking::service {
+    std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+using booking::domain::BookStatus;
+using booking::domain::Seat;
+using booking::service::HallExecutor;
+using booking::service::Reservation;
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Every task runs once, on its worker, in per-producer order
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("HallExecutor runs posted tasks in order on their worker")
+{
+    constexpr int kProducers = 4;
+    constexpr int kTasks     = 20000;
+    std::vector<std::vector<int>> seen(kProducers);   // written by worker 1 only
+    std::atomic<int> wrongThread{0}, done{0};
+    {
+        HallExecutor exec{3, /*pin*/false};
+        REQUIRE( exec.workers() == 3 );
+        REQUIRE( exec.current() == 3 );                   // not a worker
+        REQUIRE( exec.ownerOf(1, 101) == exec.ownerOf(1, 101) );
+        REQUIRE( exec.ownerOf(1, 101) < 3 );
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p)
+            producers.emplace_back([&, p] {
+                for (int i = 0; i < kTasks; ++i)
+                    exec.post(1, [&, p, i] {
+                        if (exec.current() != 1) ++wrongThread;
+                        seen[p].push_back(i);
+                        ++done;
+                    });
+            });
+        for (auto& t : producers) t.join();
+    }                                                     // dtor drains the queues
+    REQUIRE( done == kProducers * kTasks );
+    REQUIRE( wrongThread == 0 );
+    for (const auto& s : seen) {
+        REQUIRE( s.size() == static_cast<std::size_t>(kTasks) );
+        bool ordered = true;
+        for (int i = 0; i < kTasks; ++i) ordered = ordered && s[i] == i;
+        REQUIRE( ordered );
+    }
+
+    HallExecutor idle{1, false};                          // wakes from a parked worker
+    std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    std::promise<void> ran;
+    idle.post(0, [&] { ran.set_value(); });
+    REQUIRE( ran.get_future().wait_for(std::chrono::seconds{5}) == std::future_status::ready );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Owned halls: same outcomes as the shared-lock mode, without the lock
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("BookingManager routes halls to their owning worker")
+{
+    auto exec = std::make_shared<HallExecutor>(2, false);
+    booking::service::BookingManager mgr{booking::service::makeInMemoryRepository(), exec};
+    REQUIRE( mgr.owners() == exec );
+
+    std::atomic<int> winners{0};                          // racing threads, one winner
+    std::vector<std::thread> ts;
+    for (int i = 0; i < 8; ++i)
+        ts.emplace_back([&] { if (mgr.book(1, 101, {Seat::fromIndex(1)})) ++winners; });
+    for (auto& t : ts) t.join();
+    REQUIRE( winners == 1 );
+    REQUIRE( mgr.freeSeats(1, 101).size() == 19 );
+    REQUIRE( mgr.reserve(1, 999, {Seat::fromIndex(1)}).status == BookStatus::NotFound );
+    REQUIRE_THROWS( mgr.freeSeats(1, 999) );
+
+    std::promise<BookStatus> first, again;               // async, completes on the owner
+    mgr.reserveAsync(1, 102, {Seat::fromIndex(0), Seat::fromIndex(1)}, false,
+                     [&](Reservation r) { first.set_value(r.status); });
+    mgr.reserveAsync(1, 102, {Seat::fromIndex(1)}, false,
+                     [&](Reservation r) { again.set_value(r.status); });
+    REQUIRE( first.get_future().get() == BookStatus::Booked );
+    REQUIRE( again.get_future().get() == BookStatus::Taken );
+
+    std::promise<BookStatus> after;                      // a throwing callback spares the worker
+    mgr.reserveAsync(1, 102, {Seat::fromIndex(5)}, false,
+                     [](Reservation) { throw std::runtime_error("reply lost"); });
+    mgr.reserveAsync(1, 102, {Seat::fromIndex(5)}, false,
+                     [&](Reservation r) { after.set_value(r.status); });
+    REQUIRE( after.get_future().get() == BookStatus::Taken );
+
+    std::promise<std::size_t> left, none;
+    mgr.freeSeatsAsync(1, 102, [&](std::vector<Seat> v) { left.set_value(v.size()); });
+    mgr.freeSeatsAsync(1, 999, [&](std::vector<Seat> v) { none.set_value(v.size()); });
+    REQUIRE( left.get_future().get() == 17 );
+    REQUIRE( none.get_future().get() == 0 );
+
+    const auto sales = mgr.sales(1);                      // counters kept as before
+    REQUIRE( sales[0].total.bookings == 3 );
+    REQUIRE( sales[0].total.conflicts == 9 );
+
+    booking::service::BookingManager shared{booking::service::makeInMemoryRepository()};
+    std::promise<BookStatus> direct;                     // no executor: runs inline
+    shared.reserveAsync(2, 201, {Seat::fromIndex(3)}, false,
+                        [&](Reservation r) { direct.set_value(r.status); });
+    REQUIRE( direct.get_future().get() == BookStatus::Booked );
+}
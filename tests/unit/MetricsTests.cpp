@@ -0,0 +1,84 @@
+//  MetricsTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the striped counters, log-linear histogram and Prometheus
+//  registry (booking/telemetry/Metrics.hpp).
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+#include "booking/telemetry/Metrics.hpp"
+
+using namespace booking::telemetry;
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Bucket edges are contiguous and contain the values mapped to them
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Histogram buckets tile the value range")
+{
+    for (std::size_t b = 0; b + 1 < Histogram::kBuckets; ++b)
+        REQUIRE( Histogram::upperBound(b) == Histogram::lowerBound(b + 1) );
+
+    for (std::uint64_t v : {0ull, 1ull, 15ull, 16ull, 17ull, 1000ull, 123456789ull}) {
+        const auto b = Histogram::bucketOf(v);
+        REQUIRE( Histogram::lowerBound(b) <= v );
+        REQUIRE( v < Histogram::upperBound(b) );
+    }
+    REQUIRE( Histogram::bucketOf(~0ull) == Histogram::kBuckets - 1 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Quantiles are within the 1/16 relative bucket error
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Histogram quantiles")
+{
+    Histogram h;
+    for (std::uint64_t v = 1; v <= 10000; ++v) h.record(v * 1000);   // 1 µs … 10 ms
+
+    const auto snap = h.snapshot();
+    REQUIRE( snap.count == 10000 );
+
+    const auto p50 = snap.quantile(0.50);
+    const auto p99 = snap.quantile(0.99);
+    REQUIRE( p50 >= 5'000'000 );
+    REQUIRE( p50 <= 5'000'000 + 5'000'000 / 16 );
+    REQUIRE( p99 >= 9'900'000 );
+    REQUIRE( p99 <= 9'900'000 + 9'900'000 / 16 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. Striped counter sums increments from many threads
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Counter is exact under concurrency")
+{
+    Counter c;
+    std::vector<std::thread> ts;
+    for (int t = 0; t < 8; ++t)
+        ts.emplace_back([&] { for (int i = 0; i < 10000; ++i) c.inc(); });
+    for (auto& t : ts) t.join();
+
+    REQUIRE( c.value() == 80000 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4. Registry de-duplicates series and renders Prometheus text
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Registry exposition")
+{
+    Registry reg;
+    auto& a = reg.counter("demo_total", "Demo counter", {{"k", "v"}});
+    auto& b = reg.counter("demo_total", "Demo counter", {{"k", "v"}});
+    REQUIRE( &a == &b );
+    a.inc(3);
+
+    reg.histogram("demo_seconds", "Demo latency").record(2000);   // 2 µs
+    reg.addCollector([](std::ostream& os) { os << "extra_line 1\n"; });
+
+    const auto text = reg.exposition();
+    REQUIRE( text.find("# TYPE demo_total counter") != std::string::npos );
+    REQUIRE( text.find("demo_total{k=\"v\"} 3")     != std::string::npos );
+    REQUIRE( text.find("demo_seconds_bucket{le=\"1e-06\"} 0")   != std::string::npos );
+    REQUIRE( text.find("demo_seconds_bucket{le=\"2.5e-06\"} 1") != std::string::npos );
+    REQUIRE( text.find("demo_seconds_count 1") != std::string::npos );
+    REQUIRE( text.find("extra_line 1")         != std::string::npos );
+}
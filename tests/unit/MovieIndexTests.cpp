@@ -0,0 +1,73 @@
+//  MovieIndexTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the title / description search index
+//  (booking/service/MovieIndex.hpp) and SearchMovies on the repository.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+#include <vector>
+#include "booking/service/BookingManager.hpp"
+#include "booking/service/MovieIndex.hpp"
+
+namespace booking::service {
+    std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+using booking::domain::Movie;
+using booking::service::MovieIndex;
+
+namespace {
+std::vector<Movie::Id> ids(const std::vector<MovieIndex::Hit>& hits)
+{
+    std::vector<Movie::Id> out;
+    for (const auto& h : hits) out.push_back(h.id);
+    return out;
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Prefix, typo and multi-word matching, ranked title-first
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("MovieIndex finds movies by prefix and with typos")
+{
+    MovieIndex index;
+    index.add({1, "Interstellar", "A team travels through a wormhole"});
+    index.add({2, "Inception", "A thief steals secrets through dreams"});
+    index.add({3, "Blade Runner 2049", "A young blade runner unearths a secret"});
+    index.add({4, "Dune", "Paul Atreides travels to the desert planet Arrakis"});
+    REQUIRE( index.size() == 4 );
+    REQUIRE( MovieIndex::tokenize("Blade-Runner 2049!") == std::vector<std::string>{"blade", "runner", "2049"} );
+
+    REQUIRE( ids(index.search("inter")) == std::vector<Movie::Id>{1} );
+    REQUIRE( ids(index.search("IN")) == std::vector<Movie::Id>{1, 2} );
+    REQUIRE( ids(index.search("interstelar")) == std::vector<Movie::Id>{1} );     // deletion
+    REQUIRE( ids(index.search("Incpetion")) == std::vector<Movie::Id>{2} );       // transposition
+    REQUIRE( ids(index.search("blade 2049")) == std::vector<Movie::Id>{3} );      // every word
+    REQUIRE( index.search("blade dune").empty() );
+    REQUIRE( index.search("xyz").empty() );
+    REQUIRE( index.search("  -- ").empty() );
+
+    // title hits outrank description hits, ties go to the lower id
+    index.add({5, "Travels", ""});
+    REQUIRE( ids(index.search("travels")) == std::vector<Movie::Id>{5, 1, 4} );
+    REQUIRE( ids(index.search("travels", 2)) == std::vector<Movie::Id>{5, 1} );
+    REQUIRE( ids(index.search("secret")) == std::vector<Movie::Id>{3, 2} );       // exact before "secrets"
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. The repository keeps the index in step with addMovie
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("searchMovies sees movies added at runtime")
+{
+    booking::service::BookingManager mgr{booking::service::makeInMemoryRepository()};
+
+    auto hits = mgr.searchMovies("incep");
+    REQUIRE( hits.size() == 1 );
+    REQUIRE( hits[0].id() == 2 );
+    REQUIRE( mgr.searchMovies("dune").empty() );
+
+    REQUIRE( mgr.addMovie({3, "Dune", "Desert planet epic"}) == booking::service::CatalogStatus::Ok );
+    hits = mgr.searchMovies("desrt");
+    REQUIRE( hits.size() == 1 );
+    REQUIRE( hits[0].title() == "Dune" );
+}
@@ -0,0 +1,424 @@
+//  ReplicationTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for log shipping: the write log and its decorator
+//  (booking/service/ReplicationLog.hpp, ReplicatingRepository.hpp) and a
+//  primary → standby pair over a loopback gRPC server.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include "BookingAdminImpl.hpp"
+#include "BookingServiceImpl.hpp"
+#include "DedupTable.hpp"
+#include "ReplicationServiceImpl.hpp"
+#include "Standby.hpp"
+#include "booking/service/BookingManager.hpp"
+#include "booking/service/ReplicatingRepository.hpp"
+#include <grpcpp/grpcpp.h>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace booking::service {
+    std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+}
+
+using namespace std::chrono_literals;
+using booking::domain::BookStatus;
+using booking::domain::Seat;
+using booking::service::CatalogStatus;
+using booking::service::LogRecord;
+using booking::service::ReplicatingRepository;
+using booking::service::ReplicationLog;
+
+namespace {
+/// Primary started with --replicate, listening on a free loopback port.
+struct Primary {
+    std::shared_ptr<ReplicationLog>        log;
+    std::shared_ptr<ReplicatingRepository> repo;
+    ReplicationServiceImpl                 replication;
+    int                                    port = 0;
+    std::unique_ptr<grpc::Server>          server;
+
+    explicit Primary(ReplicationLog::Config cfg)
+        : log(std::make_shared<ReplicationLog>(cfg)),
+          repo(std::make_shared<ReplicatingRepository>(
+              booking::service::makeInMemoryRepository(), log)),
+          replication(repo)
+    {
+        grpc::ServerBuilder b;
+        b.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+        b.RegisterService(&replication);
+        server = b.BuildAndStart();
+    }
+    ~Primary()
+    {
+        log->close();
+        server->Shutdown();
+    }
+
+    std::shared_ptr<grpc::Channel> channel() const
+    {
+        return grpc::CreateChannel("127.0.0.1:" + std::to_string(port),
+                                   grpc::InsecureChannelCredentials());
+    }
+};
+
+/// Poll @p pred for up to 5 s.
+template <class Pred>
+bool eventually(Pred pred)
+{
+    for (int i = 0; i < 500 && !pred(); ++i) std::this_thread::sleep_for(10ms);
+    return pred();
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Log: only applied writes, bounded, snapshot == log prefix
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("ReplicatingRepository logs applied writes and snapshots")
+{
+    ReplicationLog::Config cfg;
+    cfg.capacity = 4;
+    auto log  = std::make_shared<ReplicationLog>(cfg);
+    ReplicatingRepository repo{booking::service::makeInMemoryRepository(), log};
+
+    const auto charged = repo.reserve(1, 101, {Seat::fromIndex(0), Seat::fromIndex(2)}, false);
+    REQUIRE( charged.status == BookStatus::Booked );
+    REQUIRE( charged.totalCents == repo.quote(1, 101, {Seat::fromIndex(0), Seat::fromIndex(2)}) );
+    REQUIRE( repo.reserve(1, 101, {Seat::fromIndex(2)}, false).status == BookStatus::Taken );   // not logged
+    REQUIRE( repo.addScreening(1, 999, "Late") == CatalogStatus::Ok );
+    REQUIRE( repo.addScreening(1, 999, "Late") == CatalogStatus::AlreadyExists );
+    REQUIRE( log->last() == 2 );
+
+    std::vector<LogRecord> recs;
+    REQUIRE( log->read(0, recs, 10, 0ms) );
+    REQUIRE( recs.size() == 2 );
+    REQUIRE( recs[0].kind == LogRecord::Kind::Book );
+    REQUIRE( recs[0].seats == 0b101 );
+    REQUIRE( recs[1].kind == LogRecord::Kind::AddScreening );
+    REQUIRE( recs[1].name == "Late" );
+
+    for (int i = 0; i < 4; ++i) repo.book(2, 201, {Seat::fromIndex(static_cast<std::uint8_t>(i))});
+    recs.clear();
+    REQUIRE_FALSE( log->read(0, recs, 10, 0ms) );        // first records trimmed
+    REQUIRE( log->read(2, recs, 10, 0ms) );
+    REQUIRE( recs.size() == 4 );
+
+    recs.clear();
+    const auto seq = repo.snapshot(recs);
+    REQUIRE( seq == 6 );
+    std::size_t books = 0;
+    for (const auto& r : recs) {
+        REQUIRE( r.seq == seq );
+        if (r.kind == LogRecord::Kind::Book && r.movie == 1 && r.theater == 101) REQUIRE( r.seats == 0b101 );
+        if (r.kind == LogRecord::Kind::Book && r.movie == 2 && r.theater == 201) REQUIRE( r.seats == 0b1111 );
+        books += r.kind == LogRecord::Kind::Book;
+    }
+    REQUIRE( books == 2 );
+
+    REQUIRE( log->waitAcked(seq) );                       // asynchronous: never waits
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Standby: catches up from a snapshot, tails the log, refuses writes
+//    until promoted
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Standby follows the primary and takes over on promotion")
+{
+    Primary primary{ReplicationLog::Config{}};
+    REQUIRE( primary.server );
+    REQUIRE( primary.repo->book(1, 101, {Seat::fromIndex(0)}) );           // before the standby
+    REQUIRE( primary.repo->retireScreening(1, 102) == CatalogStatus::Ok );
+
+    std::atomic<int> catalogChanges{0};
+    Standby::Config cfg;
+    cfg.retry     = 50ms;
+    cfg.onCatalog = [&] { ++catalogChanges; };
+    auto standby = std::make_shared<Standby>(primary.channel(), cfg);
+    auto mgr     = std::make_shared<booking::service::BookingManager>(standby->repository());
+    BookingAdminImpl admin{mgr, nullptr, nullptr, nullptr, standby};
+
+    REQUIRE( eventually([&] { return standby->applied() == primary.log->last(); }) );
+    REQUIRE( standby->epoch() == primary.log->epoch() );
+    REQUIRE( mgr->freeSeats(1, 101).size() == 19 );
+    REQUIRE( mgr->theaters(1).size() == 1 );                             // retired hall gone
+    REQUIRE( catalogChanges >= 1 );
+
+    REQUIRE( primary.repo->book(1, 101, {Seat::fromIndex(5), Seat::fromIndex(6)}) );   // tail
+    REQUIRE( primary.repo->addMovie({7, "Heat"}) == CatalogStatus::Ok );
+    REQUIRE( primary.repo->addScreening(7, 701, "Hall 7") == CatalogStatus::Ok );
+    REQUIRE( eventually([&] { return mgr->freeSeats(1, 101).size() == 17
+                                   && mgr->theaters(7).size() == 1; }) );
+    REQUIRE( eventually([&] { return primary.log->acked() == primary.log->last(); }) );
+
+    REQUIRE( mgr->reserve(1, 101, {Seat::fromIndex(9)}).status == BookStatus::ReadOnly );
+    REQUIRE( mgr->addMovie({8, "Ran"}) == CatalogStatus::ReadOnly );
+    REQUIRE( mgr->freeSeats(1, 101).size() == 17 );
+
+    ServiceOptions opts;                                  // keyed client retrying a refusal
+    opts.dedup = std::make_shared<DedupTable>();
+    BookingServiceImpl service{mgr, opts};
+    booking::BookingReq req;
+    req.set_movie_id(1);
+    req.set_theater_id(101);
+    auto* seat = req.add_seats();
+    seat->set_index(10);
+    seat->set_label("A11");
+    req.set_idempotency_key("order-7");
+    booking::BookingRep rep;
+    grpc::ServerContext c1, c2, c3;
+    REQUIRE( service.BookSeats(&c1, &req, &rep).error_code() == grpc::StatusCode::UNAVAILABLE );
+
+    grpc::ServerContext ctx;
+    booking::Empty none;
+    REQUIRE( admin.Promote(&ctx, &none, &none).ok() );
+    REQUIRE( standby->promoted() );
+    REQUIRE( admin.Promote(&ctx, &none, &none).error_code() == grpc::StatusCode::FAILED_PRECONDITION );
+    REQUIRE( service.BookSeats(&c2, &req, &rep).ok() );  // same key, now books
+    REQUIRE( rep.success() );
+    REQUIRE( service.BookSeats(&c3, &req, &rep).ok() );  // and is replayed
+    REQUIRE( mgr->freeSeats(1, 101).size() == 16 );
+    REQUIRE( mgr->reserve(1, 101, {Seat::fromIndex(9)}).status == BookStatus::Booked );
+    REQUIRE( mgr->reserve(1, 101, {Seat::fromIndex(5)}).status == BookStatus::Taken );   // replicated sale kept
+
+    REQUIRE( primary.repo->book(1, 101, {Seat::fromIndex(12)}) );         // no longer followed
+    std::this_thread::sleep_for(100ms);
+    REQUIRE( mgr->freeSeats(1, 101).size() == 15 );
+
+    BookingAdminImpl plain{mgr, nullptr};
+    REQUIRE( plain.Promote(&ctx, &none, &none).error_code() == grpc::StatusCode::FAILED_PRECONDITION );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. Synchronous ack: a confirmed booking is already on the standby; with
+//    no standby attached nothing is confirmed
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Synchronous replication confirms bookings only once applied")
+{
+    ReplicationLog::Config cfg;
+    cfg.synchronous = true;
+    Primary primary{cfg};
+    REQUIRE( primary.repo->reserve(1, 101, {Seat::fromIndex(0)}, false).status == BookStatus::Unreplicated );
+    REQUIRE( primary.repo->addScreening(1, 999, "Late") == CatalogStatus::Unreplicated );
+    REQUIRE( primary.repo->freeSeats(1, 101).size() == 20 );              // refused up front
+    REQUIRE( primary.log->last() == 0 );
+
+    Standby standby{primary.channel(), Standby::Config{}};
+    REQUIRE( eventually([&] { return primary.log->followers() == 1
+                                   && standby.applied() == primary.log->last(); }) );
+
+    auto replica = standby.repository();
+    for (std::uint8_t i = 0; i < 10; ++i) {
+        REQUIRE( primary.repo->book(1, 101, {Seat::fromIndex(i)}) );
+        REQUIRE( replica->freeSeats(1, 101).size() == 19u - i );           // already applied
+    }
+    REQUIRE( primary.log->ackTimeouts() == 0 );
+
+    REQUIRE( standby.promote() );                          // follower gone: writes refused at once
+    REQUIRE( eventually([&] { return primary.log->followers() == 0; }) );
+    const auto t0 = std::chrono::steady_clock::now();
+    REQUIRE( primary.repo->reserve(1, 101, {Seat::fromIndex(15)}, false).status == BookStatus::Unreplicated );
+    REQUIRE( std::chrono::steady_clock::now() - t0 < 500ms );
+    REQUIRE( primary.repo->freeSeats(1, 101).size() == 10 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4. Thread-per-core standby: replicated bookings are replayed on the hall's
+//    owner, which lists seats without the hall lock meanwhile
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Standby with hall owners replays bookings on the owning worker")
+{
+    Primary primary{ReplicationLog::Config{}};
+    auto owners = std::make_shared<booking::service::HallExecutor>(2, false);
+
+    Standby::Config cfg;
+    cfg.retry  = 50ms;
+    cfg.owners = owners;
+    Standby standby{primary.channel(), cfg};
+    booking::service::BookingManager mgr{standby.repository(), owners};
+    REQUIRE( eventually([&] { return standby.applied() == primary.log->last(); }) );
+
+    std::atomic<bool> done{false};
+    std::thread reader{[&] {
+        while (!done) (void)mgr.freeSeats(1, 101);          // on the owner, unlocked
+    }};
+    for (std::uint8_t i = 0; i < 10; ++i)
+        REQUIRE( primary.repo->book(1, 101, {Seat::fromIndex(i)}) );
+    REQUIRE( eventually([&] { return mgr.freeSeats(1, 101).size() == 10; }) );
+    done = true;
+    reader.join();
+
+    REQUIRE( standby.promote() );
+    REQUIRE( mgr.reserve(1, 101, {Seat::fromIndex(3)}).status == BookStatus::Taken );
+    REQUIRE( mgr.reserve(1, 101, {Seat::fromIndex(15)}).status == BookStatus::Booked );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 5. Synchronous write the attached standby never acknowledges: applied on
+//    the primary, but not reported as done; a keyed retry gets the seats
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Unacknowledged synchronous write is reported Unreplicated")
+{
+    ReplicationLog::Config cfg;
+    cfg.synchronous = true;
+    cfg.ackTimeout  = 100ms;
+    auto log  = std::make_shared<ReplicationLog>(cfg);
+    auto repo = std::make_shared<ReplicatingRepository>(booking::service::makeInMemoryRepository(), log);
+
+    log->attach();                                        // silent follower
+    REQUIRE( log->ready() );
+    const auto r = repo->reserve(1, 101, {Seat::fromIndex(4)}, false);
+    REQUIRE( r.status == BookStatus::Unreplicated );
+    REQUIRE( r.applied );
+    REQUIRE( log->ackTimeouts() == 1 );
+    REQUIRE( log->last() == 1 );                          // still in the log ...
+    REQUIRE( repo->freeSeats(1, 101).size() == 19 );      // ... and applied
+
+    log->ack(1);
+    REQUIRE( log->waitAcked(1) );
+
+    ServiceOptions opts;
+    opts.dedup = std::make_shared<DedupTable>();
+    BookingServiceImpl service{std::make_shared<booking::service::BookingManager>(repo), opts};
+    booking::BookingReq req;
+    req.set_movie_id(1);
+    req.set_theater_id(101);
+    auto* seat = req.add_seats();
+    seat->set_index(7);
+    seat->set_label("A8");
+    req.set_idempotency_key("order-9");
+    booking::BookingRep rep;
+    grpc::ServerContext c1, c2, c3, c4;
+    REQUIRE( service.BookSeats(&c1, &req, &rep).error_code() == grpc::StatusCode::UNAVAILABLE );
+    REQUIRE( service.BookSeats(&c2, &req, &rep).ok() );  // ack timed out: replayed as booked
+    REQUIRE( rep.success() );
+    REQUIRE( rep.total_cents() == repo->quote(1, 101, {Seat::fromIndex(7)}) );
+    REQUIRE( log->last() == 2 );                          // booked once
+
+    log->detach();
+    REQUIRE_FALSE( log->ready() );
+    REQUIRE_FALSE( log->waitAcked(3) );
+    req.set_idempotency_key("order-10");
+    seat->set_index(8);
+    seat->set_label("A9");
+    REQUIRE( service.BookSeats(&c3, &req, &rep).error_code() == grpc::StatusCode::UNAVAILABLE );
+    REQUIRE( repo->freeSeats(1, 101).size() == 18 );      // refused up front: key released
+    log->attach();
+    std::thread standby{[&] {                             // acknowledges this time
+        while (log->last() < 3) std::this_thread::sleep_for(1ms);
+        log->ack(3);
+    }};
+    const auto retried = service.BookSeats(&c4, &req, &rep);
+    standby.join();
+    REQUIRE( retried.ok() );
+    REQUIRE( repo->freeSeats(1, 101).size() == 17 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 6. Racing promotions: exactly one caller tears the follower down
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Concurrent promote calls promote once")
+{
+    Primary primary{ReplicationLog::Config{}};
+    REQUIRE( primary.server );
+    Standby::Config cfg;
+    cfg.retry = 50ms;
+    Standby standby{primary.channel(), cfg};
+    REQUIRE( eventually([&] { return standby.epoch() == primary.log->epoch(); }) );
+
+    std::atomic<int> won{0};
+    std::vector<std::thread> callers;
+    for (int i = 0; i < 4; ++i)
+        callers.emplace_back([&] { won += standby.promote() ? 1 : 0; });
+    for (auto& t : callers) t.join();
+    REQUIRE( won == 1 );
+    REQUIRE( standby.promoted() );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 7. A record the standby cannot apply is never acknowledged: the stream is
+//    dropped and the next Follow asks for a snapshot
+// ────────────────────────────────────────────────────────────────────────────
+namespace {
+/// Primary whose first stream books a hall its snapshot did not contain.
+struct DivergingPrimary final : booking::Replication::Service {
+    std::atomic<int>                                follows{0};
+    std::atomic<std::uint64_t>                      resyncEpoch{~0ull};
+    std::mutex                                      mtx;
+    std::vector<std::pair<int, std::uint64_t>>      acks;   ///< (follows, seq)
+
+    static booking::LogEntry entry(std::uint64_t seq, booking::LogEntry::Kind kind, bool snapshot)
+    {
+        booking::LogEntry e;
+        e.set_seq(seq);
+        e.set_epoch(7);
+        e.set_kind(kind);
+        e.set_snapshot(snapshot);
+        e.set_movie_id(1);
+        e.set_theater_id(101);
+        return e;
+    }
+
+    grpc::Status Follow(grpc::ServerContext* ctx, const booking::FollowReq* in,
+                        grpc::ServerWriter<booking::LogEntry>* out) override
+    {
+        const int n = ++follows;
+        if (n == 1) {
+            out->Write(entry(1, booking::LogEntry::SNAPSHOT_END, true));  // no halls
+            out->Write(entry(2, booking::LogEntry::BOOK, false));
+            for (int i = 0; i < 500 && !ctx->IsCancelled(); ++i)
+                std::this_thread::sleep_for(10ms);
+        }
+        else if (n == 2) {
+            resyncEpoch = in->epoch();
+            out->Write(entry(1, booking::LogEntry::ADD_SCREENING, true));
+            auto book = entry(1, booking::LogEntry::BOOK, true);
+            book.set_seats(1);
+            out->Write(book);
+            out->Write(entry(2, booking::LogEntry::SNAPSHOT_END, true));
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status Ack(grpc::ServerContext*, const booking::AckReq* in, booking::Empty*) override
+    {
+        const std::lock_guard lock{mtx};
+        acks.emplace_back(follows.load(), in->seq());
+        return grpc::Status::OK;
+    }
+
+    bool acked(std::uint64_t seq)
+    {
+        const std::lock_guard lock{mtx};
+        for (const auto& [n, s] : acks)
+            if (s >= seq) return true;
+        return false;
+    }
+};
+} // namespace
+
+TEST_CASE("Standby resyncs instead of acknowledging a record it cannot apply")
+{
+    DivergingPrimary primary;
+    int port = 0;
+    grpc::ServerBuilder b;
+    b.AddListeningPort("127.0.0.1:0", grpc::InsecureServerCredentials(), &port);
+    b.RegisterService(&primary);
+    auto server = b.BuildAndStart();
+    REQUIRE( server );
+
+    Standby::Config cfg;
+    cfg.retry = 50ms;
+    Standby standby{grpc::CreateChannel("127.0.0.1:" + std::to_string(port),
+                                        grpc::InsecureChannelCredentials()),
+                    cfg};
+    REQUIRE( eventually([&] { return primary.acked(2); }) );
+    REQUIRE( primary.resyncEpoch == 0 );                  // asked for a snapshot
+    {
+        const std::lock_guard lock{primary.mtx};
+        for (const auto& [follows, seq] : primary.acks)
+            REQUIRE( (follows > 1 || seq < 2) );          // the failed BOOK never acked
+    }
+    REQUIRE( standby.repository()->freeSeats(1, 101).size() == 19 );
+}
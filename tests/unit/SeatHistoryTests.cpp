@@ -0,0 +1,82 @@
+//  SeatHistoryTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the stress_scenario history checker
+//  (tests/load/SeatHistory.hpp): hand-written histories with and without
+//  each kind of violation.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <unordered_map>
+#include <vector>
+#include "SeatHistory.hpp"
+
+using namespace stress;
+
+namespace {
+Event book(std::int64_t inv, std::int64_t rep, Mask seats, bool ok)
+{
+    return Event{inv, rep, 1, seats, true, ok};
+}
+Event list(std::int64_t inv, std::int64_t rep, Mask taken)
+{
+    return Event{inv, rep, 1, taken, false, false};
+}
+Verdict run(std::vector<Event> h, Mask final)
+{
+    return check(std::move(h), {{1u, final}});
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Overlapping calls: any order a linearizable hall could produce passes
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("SeatHistory: concurrent but linearizable history passes")
+{
+    const Verdict v = run({
+        book(10, 50, 0b0011, true),     // A1+A2
+        book(20, 40, 0b0110, false),    // overlaps A2, concurrent with the winner
+        list(15, 30, 0b0011),           // may see the booking before it returns
+        list(15, 30, 0b0000),           // ... or not
+        list(60, 70, 0b0011),
+        book(80, 90, 0b1000, true),
+        list(85, 95, 0b1011),
+    }, 0b1011);
+    REQUIRE( v.events == 7 );
+    REQUIRE( v.halls == 1 );
+    REQUIRE( v.total() == 0 );
+    REQUIRE( v.examples.empty() );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Each anomaly is detected
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("SeatHistory: every anomaly kind is reported")
+{
+    REQUIRE( run({book(0, 10, 0b1, true), book(5, 15, 0b1, true)}, 0b1)
+                 [Anomaly::DoubleBooking] == 1 );
+    REQUIRE( run({book(0, 10, 0b1, true)}, 0)[Anomaly::LostBooking] == 1 );
+    REQUIRE( run({list(0, 10, 0)}, 0b100)[Anomaly::PhantomSeat] == 1 );
+
+    // failed before the only overlapping booking was even invoked
+    REQUIRE( run({book(0, 10, 0b1, false), book(20, 30, 0b1, true)}, 0b1)
+                 [Anomaly::FalseConflict] == 1 );
+
+    // seat seen taken before its booking began
+    REQUIRE( run({list(0, 10, 0b1), book(20, 30, 0b1, true)}, 0b1)
+                 [Anomaly::PhantomRead] == 1 );
+
+    // booking returned before the list started, list still sees it free
+    REQUIRE( run({book(0, 10, 0b1, true), list(20, 30, 0)}, 0b1)
+                 [Anomaly::StaleRead] == 1 );
+
+    // half of a two-seat booking visible
+    const Verdict torn = run({book(0, 50, 0b11, true), list(10, 20, 0b01)}, 0b11);
+    REQUIRE( torn[Anomaly::TornRead] == 1 );
+    REQUIRE( torn[Anomaly::StaleRead] == 0 );
+
+    // the second list starts after the first saw A1 taken, yet misses it
+    const Verdict back = run({book(0, 100, 0b1, true), list(10, 20, 0b1), list(30, 40, 0)}, 0b1);
+    REQUIRE( back[Anomaly::NonMonotonicRead] == 1 );
+    REQUIRE( back.total() == 1 );
+    REQUIRE( back.examples.size() == 1 );
+    REQUIRE( back.examples[0].find("non-monotonic-read: hall 1 seat A1") == 0 );
+}
@@ -0,0 +1,119 @@
+//  ShmTransportTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the shared-memory transport: the SPSC ring
+//  (transport/ShmRing.hpp) and a ShmServer / shm::Client round trip.
+//  Linux only.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+
+#ifdef __linux__
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unistd.h>
+#include "ShmServer.hpp"
+#include "booking/domain/Theater.hpp"
+#include "booking/service/IBookingRepository.hpp"
+#include "transport/ShmClient.hpp"
+
+namespace booking::service {
+    std::shared_ptr<IBookingRepository> makeInMemoryRepository();
+    std::shared_ptr<IBookingRepository> makeInMemoryRepository(const booking::domain::Theater::Rules& house);
+}
+
+using namespace transport::shm;
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Ring: FIFO across wrap-around, full / empty, cross-thread wake-ups
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("shm::Ring keeps order across threads and wrap-around")
+{
+    auto ring = std::make_unique<Ring<8>>();
+    Frame f;
+    REQUIRE_FALSE( ring->pop(f) );
+    for (std::uint64_t i = 0; i < 8; ++i) {
+        f.id = i;
+        REQUIRE( ring->push(f) );
+    }
+    REQUIRE_FALSE( ring->push(f) );                  // full
+    REQUIRE( ring->pop(f) );
+    REQUIRE( f.id == 0 );
+
+    // drain the rest, then stream 100k frames through 8 slots with the
+    // consumer sleeping on the futex whenever it gets ahead
+    while (ring->pop(f)) {}
+    constexpr std::uint64_t kFrames = 100'000;
+    std::atomic<int> outOfOrder{0};
+    std::thread consumer{[&] {
+        Frame g;
+        for (std::uint64_t want = 0; want < kFrames; ++want) {
+            while (!ring->popWait(g, 16, 50'000'000)) {}
+            if (g.id != want) outOfOrder.fetch_add(1);
+        }
+    }};
+    for (std::uint64_t i = 0; i < kFrames; ++i) {
+        Frame h;
+        h.id = i;
+        while (!ring->push(h)) std::this_thread::yield();
+    }
+    consumer.join();
+    REQUIRE( outOfOrder.load() == 0 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Round trip through ShmServer: same rules as the gRPC service
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("shm::Client books and lists seats through ShmServer")
+{
+    const std::string path = "/tmp/booking_test_" + std::to_string(::getpid()) + ".shm";
+    auto mgr = std::make_shared<booking::service::BookingManager>(
+        booking::service::makeInMemoryRepository());
+    ShmServer server{mgr, {path}};
+
+    Client client{path};
+    REQUIRE( client.ping() == Status::Ok );
+
+    std::uint32_t mask = 0;
+    REQUIRE( client.freeSeats(1, 101, mask) == Status::Ok );
+    REQUIRE( mask == 0xFFFFFu );                     // 20 free seats
+
+    REQUIRE( client.book(1, 101, 0b101) == Status::Ok );          // A1 + A3
+    REQUIRE( client.book(1, 101, 0b110) == Status::Conflict );    // A2 + A3
+    REQUIRE( client.freeSeats(1, 101, mask) == Status::Ok );
+    REQUIRE( mask == (0xFFFFFu & ~0b101u) );
+    REQUIRE( mgr->freeSeats(1, 101).size() == 18 );  // visible to gRPC too
+
+    REQUIRE( client.book(1, 101, 0) == Status::Invalid );
+    REQUIRE( client.book(1, 101, 1u << 20) == Status::Invalid );
+    REQUIRE( client.freeSeats(1, 999, mask) == Status::NotFound );
+    REQUIRE( client.book(1, 999, 0b1) == Status::NotFound );
+
+    {
+        Client second{path};
+        REQUIRE( second.book(1, 101, 0b10) == Status::Ok );
+        REQUIRE( server.connections() == 2 );
+    }
+    for (int i = 0; i < 100 && server.connections() != 1; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    REQUIRE( server.connections() == 1 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. Seating rules and the accessible flag, as in BookSeats
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("ShmServer applies the house seating rules")
+{
+    const std::string path = "/tmp/booking_rules_" + std::to_string(::getpid()) + ".shm";
+    booking::domain::Theater::Rules house;
+    house.accessible = 0b1;                          // seat A1 is a wheelchair bay
+    auto mgr = std::make_shared<booking::service::BookingManager>(
+        booking::service::makeInMemoryRepository(house));
+    ShmServer server{mgr, {path}};
+    Client client{path};
+
+    REQUIRE( client.book(1, 101, 0b1) == Status::Refused );
+    REQUIRE( client.book(1, 101, 0b1, 0, true) == Status::Ok );
+    REQUIRE( mgr->freeSeats(1, 101).size() == 19 );
+}
+#endif // __linux__
@@ -0,0 +1,116 @@
+//  TracerTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the sampled request tracer (booking/telemetry/Tracer.hpp).
+//  The tracer is process-wide, so every test starts with clear() and
+//  switches sampling off again at the end.
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <sstream>
+#include <string>
+#include <thread>
+#include "booking/telemetry/Tracer.hpp"
+
+using namespace booking::telemetry;
+
+namespace {
+void request(const char* root = "req")
+{
+    TraceRequest r{root};
+    TraceSpan outer{"outer"};
+    { TraceSpan inner{"inner"}; }
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Nothing is recorded while tracing is off
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Tracer records nothing when disabled")
+{
+    auto& t = Tracer::instance();
+    t.setSampling(0);
+    t.clear();
+
+    for (int i = 0; i < 100; ++i) request();
+    { TraceSpan orphan{"no-root"}; }            // spans outside a request
+
+    REQUIRE( t.collect().empty() );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. A sampled request yields nested spans sharing one request id
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Tracer records nested spans of a sampled request")
+{
+    auto& t = Tracer::instance();
+    t.clear();
+    t.setSampling(1);
+    request("root");
+    t.setSampling(0);
+
+    const auto ev = t.collect();
+    REQUIRE( ev.size() == 3 );
+
+    const auto find = [&](const std::string& n) {
+        return *std::find_if(ev.begin(), ev.end(),
+                             [&](const TraceEvent& e) { return n == e.name; });
+    };
+    const auto root = find("root"), outer = find("outer"), inner = find("inner");
+    REQUIRE( root.reqId != 0 );
+    REQUIRE( outer.reqId == root.reqId );
+    REQUIRE( inner.reqId == root.reqId );
+    REQUIRE( root.startNs <= outer.startNs );
+    REQUIRE( outer.startNs <= inner.startNs );
+    REQUIRE( inner.startNs + inner.durNs <= outer.startNs + outer.durNs );
+    REQUIRE( outer.startNs + outer.durNs <= root.startNs + root.durNs );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. 1-in-N sampling and ring wrap-around
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Tracer samples one in N and keeps the newest events")
+{
+    auto& t = Tracer::instance();
+    t.clear();
+    t.setSampling(4);
+    std::thread([] { for (int i = 0; i < 40; ++i) request(); }).join();
+    REQUIRE( t.collect().size() == 10 * 3 );
+
+    t.clear();
+    t.setSampling(1);
+    std::thread([] {
+        for (std::size_t i = 0; i < Tracer::kRingSize; ++i) request();
+    }).join();
+    t.setSampling(0);
+
+    const auto ev = t.collect();
+    REQUIRE( ev.size() == Tracer::kRingSize - 1 );      // slot being reused is skipped
+    const auto newest = std::max_element(ev.begin(), ev.end(),
+        [](const TraceEvent& a, const TraceEvent& b) { return a.reqId < b.reqId; })->reqId;
+    REQUIRE( std::count_if(ev.begin(), ev.end(),
+                           [&](const TraceEvent& e) { return e.reqId == newest; }) == 3 );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4. Chrome trace JSON carries complete events and thread metadata
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Tracer exports Chrome trace-event JSON")
+{
+    auto& t = Tracer::instance();
+    t.clear();
+    t.setSampling(1);
+    {
+        TraceRequest r{"BookSeats"};
+        r.arg("bytes", 42);
+    }
+    t.setSampling(0);
+
+    std::ostringstream os;
+    REQUIRE( t.writeChromeJson(os) == 1 );
+    const auto json = os.str();
+    REQUIRE( json.rfind("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", 0) == 0 );
+    REQUIRE( json.find("\"name\":\"BookSeats\",\"cat\":\"booking\",\"ph\":\"X\"") != std::string::npos );
+    REQUIRE( json.find("\"bytes\":42") != std::string::npos );
+    REQUIRE( json.find("\"ph\":\"M\"") != std::string::npos );
+    REQUIRE( json.substr(json.size() - 4) == "\n]}\n" );
+}
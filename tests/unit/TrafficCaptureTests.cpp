@@ -0,0 +1,101 @@
+//  TrafficCaptureTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for request capture (grpc/TrafficCapture.hpp) and the log
+//  reader used by booking_replay (transport/TrafficLog.hpp).
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <unistd.h>
+#include "EmbeddedServer.hpp"
+#include "TrafficCapture.hpp"
+#include "transport/TrafficLog.hpp"
+
+namespace cap = transport::capture;
+
+namespace {
+std::string tempLog(const char* tag)
+{
+    return "/tmp/booking_" + std::string{tag} + "_" + std::to_string(::getpid()) + ".bktl";
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Handlers record method, timing and the exact request payload
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("TrafficCapture logs service requests that read back unchanged")
+{
+    const auto path = tempLog("capture");
+    booking::BookingReq req;
+    req.set_movie_id(1);
+    req.set_theater_id(101);
+    auto* seat = req.add_seats();
+    seat->set_index(4);
+    seat->set_label("A5");
+    {
+        EmbeddedOptions opts;
+        opts.admin           = false;
+        opts.service.capture = std::make_shared<TrafficCapture>(TrafficCapture::Config{path});
+        EmbeddedServer server{opts};
+        auto stub = booking::Booking::NewStub(server.channel());
+
+        booking::TheaterReq tr;
+        tr.set_movie_id(1);
+        tr.set_theater_id(101);
+        booking::SeatList seats;
+        grpc::ClientContext c1;
+        REQUIRE( stub->ListFreeSeats(&c1, tr, &seats).ok() );
+
+        booking::BookingRep rep;
+        grpc::ClientContext c2;
+        REQUIRE( stub->BookSeats(&c2, req, &rep).ok() );
+        grpc::ClientContext c3;                          // conflicts are captured too
+        REQUIRE( stub->BookSeats(&c3, req, &rep).error_code() == grpc::StatusCode::ALREADY_EXISTS );
+
+        REQUIRE( opts.service.capture->records() == 3 );
+        REQUIRE( opts.service.capture->dropped() == 0 );
+    }                                                    // server gone -> log flushed
+
+    cap::FileHeader head{};
+    const auto recs = cap::readAll(path, &head);
+    std::remove(path.c_str());
+    REQUIRE( head.version == cap::kVersion );
+    REQUIRE( head.wallStartNs > 0 );
+    REQUIRE( recs.size() == 3 );
+    REQUIRE( recs[0].head.method == cap::Method::ListFreeSeats );
+    REQUIRE( recs[1].head.method == cap::Method::BookSeats );
+    REQUIRE( recs[0].start() <= recs[1].start() );
+    REQUIRE( recs[0].end() >= recs[0].start() );
+
+    booking::BookingReq back;
+    REQUIRE( back.ParseFromString(recs[2].payload) );
+    REQUIRE( back.SerializeAsString() == req.SerializeAsString() );
+    REQUIRE( cap::methodPath(recs[2].head.method) == "/booking.Booking/BookSeats" );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. A writer that falls behind drops records instead of blocking
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("TrafficCapture drops records beyond its pending budget")
+{
+    const auto path = tempLog("drop");
+    {
+        TrafficCapture::Config cfg{path};
+        cfg.maxPending = 40;                             // two 16 + 4 byte records
+        cfg.flushEvery = std::chrono::seconds{10};       // writer never catches up
+        TrafficCapture capture{cfg};
+
+        booking::TheaterReq tr;
+        tr.set_movie_id(1);
+        tr.set_theater_id(101);
+        const auto now = TrafficCapture::Clock::now();
+        for (int i = 0; i < 10; ++i) capture.record(cap::Method::ListFreeSeats, now, now, tr);
+        REQUIRE( capture.records() + capture.dropped() == 10 );
+        REQUIRE( capture.dropped() == 8 );
+    }
+    const auto recs = cap::readAll(path);
+    std::remove(path.c_str());
+    REQUIRE( recs.size() == 2 );
+    REQUIRE_THROWS_AS( cap::readAll(path), std::runtime_error );
+}
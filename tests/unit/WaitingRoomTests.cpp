@@ -0,0 +1,124 @@
+//  WaitingRoomTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the virtual waiting room (grpc/WaitingRoom.hpp).
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+#include "WaitingRoom.hpp"
+
+using namespace std::chrono_literals;
+
+namespace {
+WaitingRoom::Config gate(booking::domain::Movie::Id m, std::uint32_t batch)
+{
+    WaitingRoom::Config cfg;
+    cfg.movies   = {m};
+    cfg.tick     = 0ms;                 // paced by hand: room.tick()
+    cfg.minBatch = batch;
+    cfg.maxBatch = batch;
+    return cfg;
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Ungated movies never wait
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Ungated movie is admitted immediately")
+{
+    WaitingRoom room{gate(1, 1)};
+
+    REQUIRE_FALSE( room.gated(2) );
+    REQUIRE( room.join(2).admitted );
+    REQUIRE( room.admitted(2, 0) );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Clients are admitted in FIFO batches
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("FIFO batch admission")
+{
+    WaitingRoom room{gate(1, 2)};
+
+    const auto a = room.join(1), b = room.join(1), c = room.join(1);
+    REQUIRE( c.position > a.position );
+    REQUIRE_FALSE( room.admitted(1, a.token) );    // no tick yet
+
+    room.tick();                                   // first batch: 2 clients
+    REQUIRE( room.admitted(1, a.token) );
+    REQUIRE( room.admitted(1, b.token) );
+    REQUIRE_FALSE( room.admitted(1, c.token) );
+    REQUIRE( room.status(1, c.token).position == 1 );
+
+    room.tick();
+    REQUIRE( room.admitted(1, c.token) );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. Forged or missing tokens are rejected on the booking path
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Forged token is rejected")
+{
+    WaitingRoom room{gate(1, 8)};
+
+    const auto t = room.join(1);
+    room.tick();
+
+    REQUIRE( room.admitted(1, t.token) );
+    REQUIRE_FALSE( room.admitted(1, 0) );
+    REQUIRE_FALSE( room.admitted(1, t.token ^ 1) );
+    REQUIRE_FALSE( room.status(1, t.token ^ 1).admitted );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 4. tick() by hand only when there is no pacer thread
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Manual tick is refused while the pacer runs")
+{
+    auto cfg = gate(1, 1);
+    cfg.tick = 1h;
+    WaitingRoom room{cfg};
+    REQUIRE_THROWS_AS( room.tick(), std::logic_error );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 5. A token opens only its own movie's queue, for a few attempts
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Token is bound to its movie and its booking attempts are capped")
+{
+    WaitingRoom::Config cfg = gate(1, 8);
+    cfg.movies           = {1, 2};
+    cfg.bookingsPerToken = 2;
+    WaitingRoom room{cfg};
+
+    for (int i = 0; i < 20; ++i) (void)room.join(1);     // movie 1 is hot
+    const auto quiet = room.join(2);
+    room.tick();
+    REQUIRE( room.admitted(2, quiet.token) );
+    REQUIRE_FALSE( room.admitted(1, quiet.token) );       // seq 0 admitted on 1, but wrong movie
+    REQUIRE_FALSE( room.admit(1, quiet.token) );
+
+    REQUIRE( room.admit(2, quiet.token) );
+    REQUIRE( room.admit(2, quiet.token) );
+    REQUIRE_FALSE( room.admit(2, quiet.token) );          // used up
+    REQUIRE( room.admitted(2, quiet.token) );             // still admitted, just spent
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 6. No more than maxAdmitted admits are valid at once
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Admission window is bounded by maxAdmitted")
+{
+    WaitingRoom::Config cfg = gate(1, 8);
+    cfg.maxAdmitted = 4;
+    WaitingRoom room{cfg};
+
+    std::vector<WaitingRoom::Ticket> t;
+    for (int i = 0; i < 6; ++i) t.push_back(room.join(1));
+    room.tick();
+    room.tick();
+    REQUIRE( room.admitted(1, t[3].token) );
+    REQUIRE_FALSE( room.admitted(1, t[4].token) );        // waits for an admit to expire
+    REQUIRE( room.status(1, t[4].token).position == 1 );
+}
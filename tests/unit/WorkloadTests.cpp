@@ -0,0 +1,80 @@
+//  WorkloadTests.cpp
+//  ───────────────────────────────────────────────────────────────────────────
+//  Unit-tests for the booking_loadgen operation mix and seat distributions
+//  (loadgen/Workload.hpp).
+//  ───────────────────────────────────────────────────────────────────────────
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "Workload.hpp"
+
+using namespace loadgen;
+
+namespace {
+std::vector<int> histogram(const SeatPicker& p, int draws)
+{
+    std::mt19937_64 rng{42};
+    std::vector<int> n(p.size());
+    for (int i = 0; i < draws; ++i) ++n[p(rng)];
+    return n;
+}
+} // namespace
+
+// ────────────────────────────────────────────────────────────────────────────
+// 1. Mix parsing and proportional picking
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Workload: mix parses weights and picks proportionally")
+{
+    const Mix m = Mix::parse("list=1,book=3");
+    REQUIRE( m.pick(0.00) == Op::List );
+    REQUIRE( m.pick(0.24) == Op::List );
+    REQUIRE( m.pick(0.26) == Op::Book );
+    REQUIRE( m.pick(0.99) == Op::Book );          // hold has weight 0
+    REQUIRE( m.str() == "list=1,book=3,hold=0" );
+
+    REQUIRE_THROWS_AS( Mix::parse("list"),       std::invalid_argument );
+    REQUIRE_THROWS_AS( Mix::parse("sell=1"),     std::invalid_argument );
+    REQUIRE_THROWS_AS( Mix::parse("book=0"),     std::invalid_argument );
+    REQUIRE_THROWS_AS( parseDist("gaussian"),    std::invalid_argument );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 2. Uniform and hot-hall draws stay in range with the expected skew
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Workload: uniform and hot-hall seat selection")
+{
+    const SeatPicker uni{Dist::Uniform, 4, 20, 0};
+    const auto u = histogram(uni, 80'000);
+    for (int n : u) {
+        REQUIRE( n > 700 );                       // expected 1000 each
+        REQUIRE( n < 1300 );
+    }
+
+    const SeatPicker hot{Dist::Hot, 10, 20, 0.9};
+    const auto h = histogram(hot, 100'000);
+    int hall0 = 0;
+    for (std::size_t i = 0; i < 20; ++i) hall0 += h[i];
+    REQUIRE( hall0 > 90'000 );                    // 0.9 + 0.1 / 10 = 91 %
+    REQUIRE( hall0 < 92'000 );
+
+    REQUIRE_THROWS_AS( SeatPicker(Dist::Hot, 1, 20, 1.5), std::invalid_argument );
+    REQUIRE_THROWS_AS( SeatPicker(Dist::Uniform, 0, 20, 0), std::invalid_argument );
+}
+
+// ────────────────────────────────────────────────────────────────────────────
+// 3. Zipf: frequency falls off as 1 / rank^s
+// ────────────────────────────────────────────────────────────────────────────
+TEST_CASE("Workload: zipf seat selection favours low ranks")
+{
+    const SeatPicker z{Dist::Zipf, 5, 20, 1.0};
+    const auto n = histogram(z, 200'000);
+
+    REQUIRE( n[0] > n[1] );
+    REQUIRE( n[1] > n[3] );
+    REQUIRE( n[3] > n[99] );
+    // rank 1 vs rank 2 should be ~2 : 1 for s = 1
+    const double ratio = static_cast<double>(n[0]) / n[1];
+    REQUIRE( ratio > 1.8 );
+    REQUIRE( ratio < 2.2 );
+}